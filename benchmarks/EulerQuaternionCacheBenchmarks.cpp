@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "m1_mathematics/EulerQuaternionCache.h"
+
+namespace {
+
+constexpr size_t INPUT_COUNT = 4096;
+
+// Controller input quantized to 0.1 degree steps
+std::vector<Mach1::Float3> MakeQuantizedInput() {
+    std::vector<Mach1::Float3> input(INPUT_COUNT);
+    for (size_t i = 0; i < INPUT_COUNT; i++) {
+        input[i] = {0.1f * float(int(i * 7) % 3600 - 1800), 0.1f * float(int(i * 3) % 1800 - 900), 0.1f * float(int(i) % 600 - 300)};
+    }
+    return input;
+}
+
+} // namespace
+
+static void BM_EulerDegrees_Trigonometry(benchmark::State &state) {
+    std::vector<Mach1::Float3> input = MakeQuantizedInput();
+    std::vector<Mach1::Quaternion> output(INPUT_COUNT);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < INPUT_COUNT; i++) {
+            output[i] = Mach1::Quaternion::FromEulerDegrees(input[i]);
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * INPUT_COUNT);
+}
+BENCHMARK(BM_EulerDegrees_Trigonometry);
+
+static void BM_EulerDegrees_Cache(benchmark::State &state) {
+    Mach1::EulerQuaternionCache cache(3600);
+    std::vector<Mach1::Float3> input = MakeQuantizedInput();
+    std::vector<Mach1::Quaternion> output(INPUT_COUNT);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < INPUT_COUNT; i++) {
+            output[i] = cache.FromEulerDegrees(input[i]);
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * INPUT_COUNT);
+}
+BENCHMARK(BM_EulerDegrees_Cache);
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "m1_mathematics/Orientation.h"
+#include "m1_mathematics/OrientationPool.h"
+
+namespace {
+
+constexpr size_t OBJECT_COUNT = 4096;
+
+std::vector<float> MakeYawOffsets() {
+    std::vector<float> offsets(OBJECT_COUNT);
+    for (size_t i = 0; i < OBJECT_COUNT; i++) {
+        offsets[i] = 0.001f * static_cast<float>(i % 97) - 0.05f;
+    }
+    return offsets;
+}
+
+} // namespace
+
+// The path ApplyRotation_YawAxis used to take: a full Euler conversion and a dense product
+static void BM_YawOffset_FullEulerPath(benchmark::State &state) {
+    std::vector<Mach1::Orientation> objects(OBJECT_COUNT);
+    std::vector<float> offsets = MakeYawOffsets();
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < OBJECT_COUNT; i++) {
+            objects[i].ApplyRotation(Mach1::Quaternion::FromEulerRadians({offsets[i], 0, 0}));
+        }
+        benchmark::DoNotOptimize(objects.data());
+    }
+    state.SetItemsProcessed(state.iterations() * OBJECT_COUNT);
+}
+BENCHMARK(BM_YawOffset_FullEulerPath);
+
+static void BM_YawOffset_SingleAxisPath(benchmark::State &state) {
+    std::vector<Mach1::Orientation> objects(OBJECT_COUNT);
+    std::vector<float> offsets = MakeYawOffsets();
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < OBJECT_COUNT; i++) {
+            objects[i].ApplyRotation_YawAxis(offsets[i]);
+        }
+        benchmark::DoNotOptimize(objects.data());
+    }
+    state.SetItemsProcessed(state.iterations() * OBJECT_COUNT);
+}
+BENCHMARK(BM_YawOffset_SingleAxisPath);
+
+static void BM_YawOffset_PoolBatch(benchmark::State &state) {
+    Mach1::OrientationPool pool;
+    for (size_t i = 0; i < OBJECT_COUNT; i++) {
+        pool.Create();
+    }
+    std::vector<float> offsets = MakeYawOffsets();
+
+    for (auto _ : state) {
+        pool.ApplyRotation_YawAxis(0, OBJECT_COUNT, offsets.data());
+        benchmark::DoNotOptimize(pool.GetLocalRotations().W());
+    }
+    state.SetItemsProcessed(state.iterations() * OBJECT_COUNT);
+}
+BENCHMARK(BM_YawOffset_PoolBatch);
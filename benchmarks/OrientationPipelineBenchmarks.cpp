@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include "m1_mathematics/OrientationPipeline.h"
+
+namespace {
+
+constexpr size_t TRACK_COUNT = 64;
+constexpr size_t FRAME_COUNT = 256;
+
+// Refills the chunk with the same frames on every pull, standing in for a resampler
+struct RepeatSource {
+    Mach1::QuaternionBatch frames;
+
+    size_t Fill(Mach1::QuaternionBatch &chunk) {
+        chunk = frames;
+        return FRAME_COUNT;
+    }
+};
+
+Mach1::QuaternionBatch MakeFrames() {
+    Mach1::QuaternionBatch frames(FRAME_COUNT * TRACK_COUNT);
+    for (size_t i = 0; i < frames.Size(); i++) {
+        float step = static_cast<float>(i % 97);
+        frames.Set(i, Mach1::Quaternion::FromEulerDegrees({0.5f * step, 0.1f * step, -0.2f * step}));
+    }
+    return frames;
+}
+
+// Runs one stage over a whole buffer, the way a hand-wired chain processes one step at a time
+template <typename Stage>
+void RunStage(Stage &stage, const Mach1::QuaternionBatch &input, Mach1::QuaternionBatch &output) {
+    output.Resize(input.Size());
+    for (size_t i = 0; i < input.Size(); i++) {
+        float w = input.W()[i], x = input.X()[i], y = input.Y()[i], z = input.Z()[i];
+        stage.Process(i % TRACK_COUNT, w, x, y, z);
+        output.W()[i] = w;
+        output.X()[i] = x;
+        output.Y()[i] = y;
+        output.Z()[i] = z;
+    }
+}
+
+} // namespace
+
+// Smooth, predict and recenter as separate passes, copying between intermediate buffers
+static void BM_OrientationChain_SeparatePasses(benchmark::State &state) {
+    Mach1::QuaternionBatch frames = MakeFrames();
+    Mach1::SmoothStage smooth(0.5f);
+    Mach1::PredictStage predict(2.0f);
+    Mach1::RecenterStage recenter;
+    smooth.Resize(TRACK_COUNT);
+    predict.Resize(TRACK_COUNT);
+    recenter.Resize(TRACK_COUNT);
+
+    Mach1::QuaternionBatch input, smoothed, predicted, output;
+    for (auto _ : state) {
+        input = frames;
+        RunStage(smooth, input, smoothed);
+        RunStage(predict, smoothed, predicted);
+        RunStage(recenter, predicted, output);
+        benchmark::DoNotOptimize(output.W());
+    }
+    state.SetItemsProcessed(state.iterations() * FRAME_COUNT * TRACK_COUNT);
+}
+BENCHMARK(BM_OrientationChain_SeparatePasses);
+
+static void BM_OrientationChain_FusedPipeline(benchmark::State &state) {
+    auto pipeline = Mach1::MakeOrientationPipeline(TRACK_COUNT, RepeatSource{MakeFrames()},
+                                                   Mach1::SmoothStage(0.5f), Mach1::PredictStage(2.0f),
+                                                   Mach1::RecenterStage());
+
+    Mach1::QuaternionBatch chunk;
+    for (auto _ : state) {
+        pipeline.Pull(chunk);
+        benchmark::DoNotOptimize(chunk.W());
+    }
+    state.SetItemsProcessed(state.iterations() * FRAME_COUNT * TRACK_COUNT);
+}
+BENCHMARK(BM_OrientationChain_FusedPipeline);
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "m1_mathematics/RelativeRotation.h"
+
+namespace {
+
+constexpr size_t LISTENER_COUNT = 16;
+constexpr size_t OBJECT_COUNT = 4096;
+
+Mach1::QuaternionBatch MakeRotations(size_t count) {
+    Mach1::QuaternionBatch batch(count);
+    for (size_t i = 0; i < count; i++) {
+        batch.Set(i, Mach1::Quaternion::FromEulerDegrees({float(i % 360) - 180.0f, float(i % 90) - 45.0f, float(i % 45)}));
+    }
+    return batch;
+}
+
+} // namespace
+
+// Nested loops over Quaternion::operator*, as multi-listener sessions used to compute it
+static void BM_RelativeRotation_Scalar(benchmark::State &state) {
+    Mach1::QuaternionBatch listeners = MakeRotations(LISTENER_COUNT);
+    Mach1::QuaternionBatch objects = MakeRotations(OBJECT_COUNT);
+    std::vector<Mach1::Quaternion> output(LISTENER_COUNT * OBJECT_COUNT);
+
+    for (auto _ : state) {
+        for (size_t l = 0; l < LISTENER_COUNT; l++) {
+            Mach1::Quaternion inverse = listeners.Get(l).Inversed();
+            for (size_t o = 0; o < OBJECT_COUNT; o++) {
+                output[l * OBJECT_COUNT + o] = inverse * objects.Get(o);
+            }
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * LISTENER_COUNT * OBJECT_COUNT);
+}
+BENCHMARK(BM_RelativeRotation_Scalar);
+
+static void BM_RelativeRotation_Tiled(benchmark::State &state) {
+    Mach1::QuaternionBatch listeners = MakeRotations(LISTENER_COUNT);
+    Mach1::QuaternionBatch objects = MakeRotations(OBJECT_COUNT);
+    Mach1::QuaternionBatch output;
+    auto threads = static_cast<unsigned>(state.range(0));
+
+    for (auto _ : state) {
+        Mach1::RelativeRotation::Compute(listeners, objects, output, threads);
+        benchmark::DoNotOptimize(output.W());
+    }
+    state.SetItemsProcessed(state.iterations() * LISTENER_COUNT * OBJECT_COUNT);
+}
+BENCHMARK(BM_RelativeRotation_Tiled)->Arg(1)->Arg(4)->UseRealTime();
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+#include <random>
+
+#include "m1_mathematics/Float3.h"
+#include "m1_mathematics/QuaternionBatch.h"
+
+namespace {
+
+constexpr size_t OBJECT_COUNT = 4096;
+
+Mach1::QuaternionBatch MakeHeadRotations() {
+    std::mt19937 rng(49);
+    std::uniform_real_distribution<float> angle(-2.0f, 2.0f);
+
+    Mach1::QuaternionBatch rotations(OBJECT_COUNT);
+    for (size_t i = 0; i < OBJECT_COUNT; i++) {
+        rotations.Set(i, Mach1::Quaternion::FromEulerRadians({angle(rng), angle(rng) * 0.5f, angle(rng)}));
+    }
+    return rotations;
+}
+
+} // namespace
+
+// The per-object conditioning the swing-twist clamp replaces: to Euler degrees, clamp, and back
+static void BM_NeckLimit_EulerClamp(benchmark::State &state) {
+    Mach1::QuaternionBatch source = MakeHeadRotations();
+    Mach1::QuaternionBatch rotations;
+    Mach1::Float3 min{-60.0f, -30.0f, -20.0f};
+    Mach1::Float3 max{60.0f, 30.0f, 20.0f};
+
+    for (auto _ : state) {
+        rotations = source;
+        for (size_t i = 0; i < OBJECT_COUNT; i++) {
+            Mach1::Float3 euler = rotations.Get(i).ToEulerDegrees().Clamped(min, max);
+            rotations.Set(i, Mach1::Quaternion::FromEulerDegrees(euler));
+        }
+        benchmark::DoNotOptimize(rotations.W());
+    }
+    state.SetItemsProcessed(state.iterations() * OBJECT_COUNT);
+}
+BENCHMARK(BM_NeckLimit_EulerClamp);
+
+static void BM_NeckLimit_SwingTwistScalar(benchmark::State &state) {
+    Mach1::QuaternionBatch source = MakeHeadRotations();
+    Mach1::QuaternionBatch rotations;
+
+    for (auto _ : state) {
+        rotations = source;
+        for (size_t i = 0; i < OBJECT_COUNT; i++) {
+            rotations.Set(i, rotations.Get(i).ClampedSwingTwist({1, 0, 0}, 0.6f, -1.05f, 1.05f));
+        }
+        benchmark::DoNotOptimize(rotations.W());
+    }
+    state.SetItemsProcessed(state.iterations() * OBJECT_COUNT);
+}
+BENCHMARK(BM_NeckLimit_SwingTwistScalar);
+
+static void BM_NeckLimit_SwingTwistBatch(benchmark::State &state) {
+    Mach1::QuaternionBatch source = MakeHeadRotations();
+    Mach1::QuaternionBatch rotations;
+
+    for (auto _ : state) {
+        rotations = source;
+        rotations.ClampSwingTwist({1, 0, 0}, 0.6f, -1.05f, 1.05f);
+        benchmark::DoNotOptimize(rotations.W());
+    }
+    state.SetItemsProcessed(state.iterations() * OBJECT_COUNT);
+}
+BENCHMARK(BM_NeckLimit_SwingTwistBatch);
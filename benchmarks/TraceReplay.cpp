@@ -0,0 +1,497 @@
+/**
+ * Replays recorded OrientationTrace files through the library and reports throughput, per-op latency percentiles and,
+ * on Linux where perf_event is permitted, hardware counters.
+ *
+ *     m1_mathematics_trace_replay [--threads N] [--repeat N] <trace>...
+ *     m1_mathematics_trace_replay --generate <trace> [--objects N] [--seconds N]
+ *
+ * Multi-threaded replay gives every thread the objects with index % threads == thread and replays their events in
+ * recorded order, matching how callers shard Orientations that are not shared between threads. Timestamps are kept in
+ * the trace for analysis but replay runs as fast as possible.
+ *
+ * --generate writes a synthetic trace with bursty tracker packets, recenter storms and quiet periods, for use until
+ * production traces are available in benchmarks/traces.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "m1_mathematics/Orientation.h"
+#include "m1_mathematics/OrientationTrace.h"
+#include "m1_mathematics/Quaternion.h"
+
+using namespace Mach1;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t TYPE_COUNT = static_cast<size_t>(OrientationTraceEvent::Type::GetGlobalRotationDegrees) + 1;
+
+// ===================================================== PERF COUNTERS =====================================================
+
+enum Counter {
+    CYCLES,
+    INSTRUCTIONS,
+    CACHE_REFERENCES,
+    CACHE_MISSES,
+    L1D_READ_MISSES,
+    COUNTER_COUNT
+};
+
+const char *const COUNTER_NAMES[COUNTER_COUNT] = {
+        "cycles", "instructions", "cache-references", "cache-misses", "L1d-read-misses"
+};
+
+/**
+ * Hardware counters for the calling thread, opened individually so that one unsupported event does not disable the
+ * rest. Every method is a no-op where perf_event is unavailable.
+ */
+class PerfCounters {
+public:
+    PerfCounters() {
+        std::fill(m_fds, m_fds + COUNTER_COUNT, -1);
+#if defined(__linux__)
+        const uint64_t l1d_read_miss = PERF_COUNT_HW_CACHE_L1D |
+                                       (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                       (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        Open(CYCLES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        Open(INSTRUCTIONS, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        Open(CACHE_REFERENCES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES);
+        Open(CACHE_MISSES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+        Open(L1D_READ_MISSES, PERF_TYPE_HW_CACHE, l1d_read_miss);
+#endif
+    }
+
+    ~PerfCounters() {
+#if defined(__linux__)
+        for (int fd : m_fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    void Start() {
+#if defined(__linux__)
+        for (int fd : m_fds) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    /**
+     * Stop counting and add the counts to totals; counters that could not be opened are left at -1
+     */
+    void Stop(int64_t *totals) {
+#if defined(__linux__)
+        for (int i = 0; i < COUNTER_COUNT; i++) {
+            if (m_fds[i] < 0) {
+                continue;
+            }
+            ioctl(m_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+            uint64_t value = 0;
+            if (read(m_fds[i], &value, sizeof(value)) == sizeof(value)) {
+                totals[i] = std::max<int64_t>(totals[i], 0) + static_cast<int64_t>(value);
+            }
+        }
+#else
+        (void)totals;
+#endif
+    }
+
+private:
+#if defined(__linux__)
+    void Open(Counter counter, uint32_t type, uint64_t config) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        m_fds[counter] = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+#endif
+
+    int m_fds[COUNTER_COUNT];
+};
+
+// ===================================================== REPLAY =====================================================
+
+struct ReplayResult {
+    double seconds = 0;
+    size_t events = 0;
+    int64_t counters[COUNTER_COUNT];
+    std::vector<uint32_t> latencies_ns[TYPE_COUNT];
+    float checksum = 0;
+
+    ReplayResult() {
+        std::fill(counters, counters + COUNTER_COUNT, -1);
+    }
+};
+
+/**
+ * Split the events into one ordered list per thread, sharding by object
+ */
+std::vector<std::vector<OrientationTraceEvent>> Shard(const OrientationTrace &trace, unsigned thread_count) {
+    std::vector<std::vector<OrientationTraceEvent>> shards(thread_count);
+    for (const OrientationTraceEvent &event : trace.GetEvents()) {
+        shards[event.object % thread_count].push_back(event);
+    }
+    return shards;
+}
+
+/**
+ * Estimate what a pair of back-to-back Clock::now() calls costs, so it can be taken out of each latency sample
+ */
+int64_t MeasureTimerOverhead() {
+    std::vector<int64_t> samples(1000);
+    for (int64_t &sample : samples) {
+        Clock::time_point start = Clock::now();
+        Clock::time_point end = Clock::now();
+        sample = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    }
+    std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+    return samples[samples.size() / 2];
+}
+
+/**
+ * Replay every shard on its own thread. The throughput pass runs untimed per event and is the one the counters cover;
+ * the latency pass then times each event individually
+ */
+ReplayResult Replay(const OrientationTrace &trace, unsigned thread_count, unsigned repeat) {
+    std::vector<std::vector<OrientationTraceEvent>> shards = Shard(trace, thread_count);
+    int64_t timer_overhead = MeasureTimerOverhead();
+
+    ReplayResult result;
+    std::vector<ReplayResult> thread_results(thread_count);
+    std::atomic<unsigned> ready(0);
+    std::atomic<bool> go(false);
+    Clock::time_point start;
+
+    auto worker = [&](unsigned thread) {
+        const std::vector<OrientationTraceEvent> &events = shards[thread];
+        ReplayResult &local = thread_results[thread];
+        std::vector<Orientation> objects(trace.ObjectCount());
+        for (auto &latencies : local.latencies_ns) {
+            latencies.reserve(events.size() * repeat / TYPE_COUNT + 1);
+        }
+        PerfCounters counters;
+
+        ready.fetch_add(1);
+        while (!go.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+
+        float checksum = 0;
+        counters.Start();
+        for (unsigned r = 0; r < repeat; r++) {
+            for (const OrientationTraceEvent &event : events) {
+                checksum += OrientationTrace::Apply(event, objects[event.object]);
+            }
+        }
+        counters.Stop(local.counters);
+        local.events = events.size() * repeat;
+
+        // The throughput pass has finished on this thread; the clock stops once every thread reaches this point
+        ready.fetch_sub(1);
+
+        for (auto &object : objects) {
+            object.Reset();
+        }
+        for (unsigned r = 0; r < repeat; r++) {
+            for (const OrientationTraceEvent &event : events) {
+                Clock::time_point event_start = Clock::now();
+                checksum += OrientationTrace::Apply(event, objects[event.object]);
+                Clock::time_point event_end = Clock::now();
+                int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(event_end - event_start).count();
+                local.latencies_ns[static_cast<size_t>(event.type)].push_back(
+                        static_cast<uint32_t>(std::max<int64_t>(ns - timer_overhead, 0)));
+            }
+        }
+        local.checksum = checksum;
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned thread = 0; thread < thread_count; thread++) {
+        threads.emplace_back(worker, thread);
+    }
+    while (ready.load() < thread_count) {
+        std::this_thread::yield();
+    }
+    start = Clock::now();
+    go.store(true, std::memory_order_release);
+    while (ready.load() > 0) {
+        std::this_thread::yield();
+    }
+    result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (const ReplayResult &local : thread_results) {
+        result.events += local.events;
+        result.checksum += local.checksum;
+        for (int i = 0; i < COUNTER_COUNT; i++) {
+            if (local.counters[i] >= 0) {
+                result.counters[i] = std::max<int64_t>(result.counters[i], 0) + local.counters[i];
+            }
+        }
+        for (size_t type = 0; type < TYPE_COUNT; type++) {
+            result.latencies_ns[type].insert(result.latencies_ns[type].end(),
+                                             local.latencies_ns[type].begin(), local.latencies_ns[type].end());
+        }
+    }
+    return result;
+}
+
+uint32_t Percentile(const std::vector<uint32_t> &sorted, double percentile) {
+    size_t index = static_cast<size_t>(percentile / 100.0 * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+void Report(const char *path, const OrientationTrace &trace, unsigned thread_count, ReplayResult &result) {
+    std::printf("%s: %zu events, %zu objects, %u thread(s)\n", path, trace.Size(), trace.ObjectCount(), thread_count);
+    std::printf("  throughput  %.2f M events/s (%.3f ms)\n",
+                static_cast<double>(result.events) / result.seconds * 1e-6, result.seconds * 1e3);
+
+    std::printf("  %-16s %10s %8s %8s %8s %8s %8s  (ns)\n", "op", "count", "p50", "p90", "p99", "p99.9", "max");
+    for (size_t type = 0; type < TYPE_COUNT; type++) {
+        std::vector<uint32_t> &latencies = result.latencies_ns[type];
+        if (latencies.empty()) {
+            continue;
+        }
+        std::sort(latencies.begin(), latencies.end());
+        std::printf("  %-16s %10zu %8u %8u %8u %8u %8u\n",
+                    OrientationTrace::GetTypeName(static_cast<OrientationTraceEvent::Type>(type)), latencies.size(),
+                    Percentile(latencies, 50), Percentile(latencies, 90), Percentile(latencies, 99),
+                    Percentile(latencies, 99.9), latencies.back());
+    }
+
+    bool any_counter = false;
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        if (result.counters[i] < 0) {
+            continue;
+        }
+        any_counter = true;
+        std::printf("  %-16s %14lld  (%.3f per event)\n", COUNTER_NAMES[i], static_cast<long long>(result.counters[i]),
+                    static_cast<double>(result.counters[i]) / static_cast<double>(result.events));
+    }
+    if (!any_counter) {
+        std::printf("  perf counters unavailable\n");
+    }
+    std::printf("  checksum %g\n", static_cast<double>(result.checksum));
+}
+
+// ===================================================== GENERATOR =====================================================
+
+/**
+ * Write a synthetic session: a head tracker whose packets arrive in bursts, objects updated by automation, a reader
+ * polling every object once per audio block, recenter storms, and quiet periods where only the reads continue
+ */
+OrientationTrace Generate(uint32_t object_count, uint32_t seconds) {
+    constexpr uint64_t BLOCK_US = 10667;        // 512 samples at 48 kHz
+    constexpr uint64_t TRACKER_PERIOD_US = 5000;
+    constexpr uint32_t LISTENER = 0;
+
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_int_distribution<uint32_t> pick(1, std::max<uint32_t>(object_count - 1, 1));
+
+    OrientationTrace trace;
+    uint64_t end_us = static_cast<uint64_t>(seconds) * 1000000;
+    uint64_t next_tracker_us = 0;
+    uint64_t quiet_until_us = 0;
+    uint64_t storm_until_us = 0;
+    bool stormed = false;
+
+    for (uint64_t block_us = 0; block_us < end_us; block_us += BLOCK_US) {
+        uint64_t block_end_us = block_us + BLOCK_US;
+        bool quiet = block_us < quiet_until_us;
+
+        if (!quiet && random() % 400 == 0) {
+            quiet_until_us = block_us + 500000 + random() % 1500000;
+            quiet = true;
+        }
+        if (!quiet && random() % 300 == 0) {
+            storm_until_us = block_us + 50000;
+            stormed = true;
+        }
+        // Short sessions may not roll a storm, so one is forced halfway through, cutting any quiet period short
+        if (!stormed && block_us >= end_us / 2) {
+            quiet_until_us = 0;
+            quiet = false;
+            storm_until_us = block_us + 50000;
+            stormed = true;
+        }
+
+        // Tracker packets are produced every 5 ms but delivered in bursts of one to four per block
+        if (!quiet) {
+            uint64_t delivered_us = block_us + random() % BLOCK_US;
+            while (next_tracker_us < block_end_us) {
+                float yaw = 0.01f * unit(random), pitch = 0.004f * unit(random), roll = 0.002f * unit(random);
+                Quaternion delta = Quaternion::FromEulerRadians({yaw, pitch, roll});
+                trace.Add(delivered_us, LISTENER, OrientationTraceEvent::Type::ApplyRotation,
+                          delta.GetW(), delta.GetX(), delta.GetY(), delta.GetZ());
+                next_tracker_us += TRACKER_PERIOD_US;
+            }
+        } else {
+            next_tracker_us = block_end_us;
+        }
+
+        if (block_us < storm_until_us) {
+            trace.Add(block_us + 100, LISTENER, OrientationTraceEvent::Type::Recenter);
+        }
+
+        if (!quiet && object_count > 1) {
+            for (int i = 0; i < 4; i++) {
+                uint32_t object = pick(random);
+                switch (random() % 4) {
+                    case 0:
+                        trace.Add(block_us + 200, object, OrientationTraceEvent::Type::ApplyRotationYaw,
+                                  0.05f * unit(random));
+                        break;
+                    case 1:
+                        trace.Add(block_us + 200, object, OrientationTraceEvent::Type::ApplyRotationDegrees,
+                                  5.0f * unit(random), 2.0f * unit(random), 0);
+                        break;
+                    case 2: {
+                        Quaternion q = Quaternion::FromEulerRadians({3.0f * unit(random), 1.0f * unit(random), 0});
+                        trace.Add(block_us + 200, object, OrientationTraceEvent::Type::SetRotation,
+                                  q.GetW(), q.GetX(), q.GetY(), q.GetZ());
+                        break;
+                    }
+                    default:
+                        if (random() % 50 == 0) {
+                            trace.Add(block_us + 200, object, OrientationTraceEvent::Type::Reset);
+                        }
+                        break;
+                }
+            }
+        }
+
+        // The audio thread reads the listener and every object once per block
+        trace.Add(block_us + 300, LISTENER, OrientationTraceEvent::Type::GetGlobalRotationDegrees);
+        for (uint32_t object = 1; object < object_count; object++) {
+            trace.Add(block_us + 300, object, OrientationTraceEvent::Type::GetGlobalRotation);
+        }
+    }
+
+    // A tracker burst is delivered at a random point in its block, after that block's automation and reads may
+    // already have been added, so events are written in timestamp order. The sort is stable to keep same-time events
+    // in the order they were generated
+    std::vector<OrientationTraceEvent> events = trace.GetEvents();
+    std::stable_sort(events.begin(), events.end(), [](const OrientationTraceEvent &a, const OrientationTraceEvent &b) {
+        return a.timestamp_us < b.timestamp_us;
+    });
+    OrientationTrace sorted;
+    for (const OrientationTraceEvent &event : events) {
+        sorted.Add(event);
+    }
+    return sorted;
+}
+
+void PrintUsage() {
+    std::fprintf(stderr,
+                 "usage: m1_mathematics_trace_replay [--threads N] [--repeat N] <trace>...\n"
+                 "       m1_mathematics_trace_replay --generate <trace> [--objects N] [--seconds N]\n");
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    unsigned thread_count = 1;
+    unsigned repeat = 1;
+    uint32_t object_count = 16;
+    uint32_t seconds = 10;
+    const char *generate_path = nullptr;
+    std::vector<const char *> paths;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--threads" && has_value) {
+            thread_count = static_cast<unsigned>(std::max(std::atoi(argv[++i]), 1));
+        } else if (arg == "--repeat" && has_value) {
+            repeat = static_cast<unsigned>(std::max(std::atoi(argv[++i]), 1));
+        } else if (arg == "--objects" && has_value) {
+            object_count = static_cast<uint32_t>(std::max(std::atoi(argv[++i]), 1));
+        } else if (arg == "--seconds" && has_value) {
+            seconds = static_cast<uint32_t>(std::max(std::atoi(argv[++i]), 1));
+        } else if (arg == "--generate" && has_value) {
+            generate_path = argv[++i];
+        } else if (!arg.empty() && arg[0] != '-') {
+            paths.push_back(argv[i]);
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    if (generate_path) {
+        std::ofstream file(generate_path);
+        if (!file) {
+            std::fprintf(stderr, "cannot write %s\n", generate_path);
+            return 1;
+        }
+        OrientationTrace trace = Generate(object_count, seconds);
+        file << "# synthetic session: " << object_count << " objects, " << seconds << " s\n";
+        trace.Write(file);
+        std::printf("wrote %zu events to %s\n", trace.Size(), generate_path);
+        return 0;
+    }
+
+    if (paths.empty()) {
+        PrintUsage();
+        return 1;
+    }
+
+    for (const char *path : paths) {
+        std::ifstream file(path);
+        OrientationTrace trace;
+        std::string error;
+        if (!file) {
+            std::fprintf(stderr, "cannot read %s\n", path);
+            return 1;
+        }
+        if (!trace.Read(file, &error)) {
+            std::fprintf(stderr, "%s: %s\n", path, error.c_str());
+            return 1;
+        }
+        if (trace.Size() == 0) {
+            std::fprintf(stderr, "%s: no events\n", path);
+            continue;
+        }
+
+        ReplayResult result = Replay(trace, thread_count, repeat);
+        Report(path, trace, thread_count, result);
+    }
+    return 0;
+}
@@ -0,0 +1,45 @@
+#ifndef M1_ORIENTATIONMANAGER_ALIGNEDALLOCATOR_H
+#define M1_ORIENTATIONMANAGER_ALIGNEDALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+
+namespace Mach1 {
+
+/**
+ * @brief Standard allocator handing out storage aligned to `Alignment` bytes (a cache line by default), so that
+ * SoA component arrays start on a cache line and vector loads never straddle one
+ */
+template<typename T, size_t Alignment = 64>
+class AlignedAllocator {
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept {}
+
+    T *allocate(size_t count) {
+        return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T *pointer, size_t) noexcept {
+        ::operator delete(pointer, std::align_val_t(Alignment));
+    }
+
+    template<typename U>
+    bool operator==(const AlignedAllocator<U, Alignment> &) const noexcept { return true; }
+
+    template<typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment> &) const noexcept { return false; }
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_ALIGNEDALLOCATOR_H
@@ -0,0 +1,93 @@
+#ifndef M1_ORIENTATIONMANAGER_CONTINUOUSEULERCONVERTER_H
+#define M1_ORIENTATIONMANAGER_CONTINUOUSEULERCONVERTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "AlignedAllocator.h"
+#include "Float3.h"
+#include "Float3Batch.h"
+#include "Quaternion.h"
+#include "QuaternionBatch.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Converts streams of Quaternions to Euler radians that never wrap, so downstream parameter smoothers see
+ * continuous values.
+ *
+ * Angles follow Quaternion::ToEulerRadians (Yaw-Pitch-Roll order), but each track remembers its previous output and
+ * unwraps yaw and roll by whole turns, e.g. yaw keeps growing past PI instead of jumping to -PI. Pitch stays within
+ * [-PI/2, PI/2].
+ *
+ * Near pitch +-PI/2 (gimbal lock) yaw and roll are no longer separable, and the plain conversion swings both
+ * wildly. A track locks once pitch comes within `lock_margin` of +-PI/2. While locked, roll is held at its value
+ * from before the lock and the whole remaining rotation goes into yaw. The track releases when pitch falls back
+ * below `release_margin`, which is wider, so a pitch hovering at the edge does not chatter between the two.
+ */
+class ContinuousEulerConverter {
+public:
+    /**
+     * @param lock_margin_radians distance from +-PI/2 at which a track locks
+     * @param release_margin_radians distance from +-PI/2 at which a locked track releases, at least lock_margin
+     */
+    explicit ContinuousEulerConverter(size_t track_count = 1, float lock_margin_radians = 0.01f,
+                                      float release_margin_radians = 0.03f);
+
+    /**
+     * @brief Set the number of tracks. New tracks start fresh on their next conversion
+     */
+    void Resize(size_t track_count);
+
+    size_t GetTrackCount() const;
+
+    void SetLockMargins(float lock_margin_radians, float release_margin_radians);
+    float GetLockMargin() const;
+    float GetReleaseMargin() const;
+
+    /**
+     * @brief Forget a track's history, so its next output is the plain wrapped conversion
+     */
+    void Reset(size_t track);
+
+    /**
+     * @brief Forget the history of every track
+     */
+    void Reset();
+
+    /**
+     * @brief Check whether a track is currently held in its gimbal lock state
+     */
+    bool IsLocked(size_t track) const;
+
+    /**
+     * @brief Convert the next rotation of one track
+     * @return Float3 of continuous (yaw, pitch, roll) radians
+     */
+    Float3 Convert(size_t track, Quaternion rotation);
+
+    /**
+     * @brief Convert the next rotation of every track at once, track i taking rotations[i]. Resizes the tracks to
+     * match the batch, and the output to the batch's size
+     */
+    void Convert(const QuaternionBatch &rotations, Float3Batch &output);
+
+private:
+    using AlignedFloats = std::vector<float, AlignedAllocator<float>>;
+
+    float m_lock_margin;
+    float m_release_margin;
+    float m_lock_sin;
+    float m_release_sin;
+
+    AlignedFloats m_yaw;
+    AlignedFloats m_pitch;
+    AlignedFloats m_roll;
+    std::vector<uint8_t> m_started;
+    std::vector<uint8_t> m_locked;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_CONTINUOUSEULERCONVERTER_H
@@ -0,0 +1,142 @@
+#ifndef M1_ORIENTATIONMANAGER_DUALQUATERNION_H
+#define M1_ORIENTATIONMANAGER_DUALQUATERNION_H
+
+#include <cstddef>
+#include <string>
+
+#include "Float3.h"
+#include "Float3Batch.h"
+#include "Quaternion.h"
+
+namespace Mach1 {
+
+class Orientation;
+
+/**
+ * @brief A rigid transform (rotation followed by translation) stored as a unit dual quaternion.
+ *
+ * The real part is the rotation Quaternion and the dual part is half the translation times the rotation, so
+ * composing transforms is a pair of Quaternion products and poses interpolate along a screw motion. Positions follow
+ * the vector convention of Quaternion::Rotate: components along the up (yaw), left (pitch) and forward (roll) axes.
+ */
+class DualQuaternion {
+public:
+    DualQuaternion();
+    DualQuaternion(Quaternion real, Quaternion dual);
+
+    /**
+     * @brief Construct a transform that rotates by the given Quaternion, then translates by the given vector
+     */
+    static DualQuaternion FromRotationTranslation(Quaternion rotation, Float3 translation);
+
+    /**
+     * @brief Construct a transform with the given Orientation's global rotation, placed at the given position
+     */
+    static DualQuaternion FromOrientation(const Orientation &orientation, Float3 position);
+
+    /**
+     * @brief Construct a pure rotation transform
+     */
+    static DualQuaternion FromRotation(Quaternion rotation);
+
+    /**
+     * @brief Construct a pure translation transform
+     */
+    static DualQuaternion FromTranslation(Float3 translation);
+
+    /**
+     * @brief Screw-linear interpolation between two transforms, moving at a constant rate along the screw axis
+     * that carries one into the other; takes the shorter path. Returns from at t = 0 and to at t = 1
+     */
+    static DualQuaternion Sclerp(DualQuaternion from, DualQuaternion to, float t);
+
+    /**
+     * @brief Dual quaternion linear blending: the normalized weighted sum of the given transforms, a cheap and
+     * order-independent approximation of a screw average. Transforms are aligned with the first before summing
+     */
+    static DualQuaternion Blend(const DualQuaternion *transforms, const float *weights, size_t count);
+
+    /**
+     * @brief Get the rotation part of this transform
+     */
+    Quaternion GetRotation() const;
+
+    /**
+     * @brief Get the translation part of this transform
+     */
+    Float3 GetTranslation() const;
+
+    /**
+     * @brief Get the real (rotation) Quaternion
+     */
+    Quaternion GetReal() const;
+
+    /**
+     * @brief Get the dual Quaternion
+     */
+    Quaternion GetDual() const;
+
+    /**
+     * @brief Get the inverse transform, such that it multiplied by this transform results in the identity
+     */
+    DualQuaternion Inversed() const;
+
+    /**
+     * @brief Get this transform with a unit real part and a dual part orthogonal to it, correcting
+     * drift from long chains of products
+     */
+    DualQuaternion Normalized() const;
+
+    /**
+     * @brief Transform a point: rotate it, then translate it
+     */
+    Float3 TransformPoint(Float3 point) const;
+
+    /**
+     * @brief Rotate a direction, ignoring translation
+     */
+    Float3 TransformDirection(Float3 direction) const;
+
+    /**
+     * @brief Transform every point of a batch. The transform is expanded to a 3x4 matrix once, then applied in
+     * a single SoA loop. Output is resized to match the input and may be the same batch
+     */
+    void TransformPoints(const Float3Batch &points, Float3Batch &output) const;
+
+    /**
+     * @brief Check whether this transform is equal to the given transform within a margin of error
+     */
+    bool IsApproximatelyEqual(const DualQuaternion &rhs) const;
+
+    /**
+     * @brief Check whether this transform represents the same rigid motion as the given one, treating a
+     * negated dual quaternion as equal
+     */
+    bool IsEquivalent(const DualQuaternion &rhs) const;
+
+    /**
+     * @brief Get the string representation of this DualQuaternion
+     * @return string of the format "DualQuaternion(real: `real`, dual: `dual`)"
+     */
+    std::string ToString() const;
+
+    void operator*=(const DualQuaternion &rhs);
+
+    bool operator==(const DualQuaternion &rhs) const;
+    bool operator!=(const DualQuaternion &rhs) const;
+
+    /**
+     * @brief Compose two transforms; the right-hand transform is applied first, as with Quaternion products
+     */
+    DualQuaternion operator*(const DualQuaternion &rhs) const;
+    DualQuaternion operator*(float scalar) const;
+    DualQuaternion operator+(const DualQuaternion &rhs) const;
+
+private:
+    Quaternion m_real;
+    Quaternion m_dual;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_DUALQUATERNION_H
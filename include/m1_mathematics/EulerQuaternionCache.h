@@ -0,0 +1,87 @@
+#ifndef M1_ORIENTATIONMANAGER_EULERQUATERNIONCACHE_H
+#define M1_ORIENTATIONMANAGER_EULERQUATERNIONCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "AlignedAllocator.h"
+#include "Float3.h"
+#include "Float3Batch.h"
+#include "Quaternion.h"
+#include "QuaternionBatch.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Euler to Quaternion conversion for inputs quantized to fixed steps, such as controller knobs, OSC
+ * surfaces or MIDI, without any trigonometry per call.
+ *
+ * A full turn is divided into `steps_per_turn` steps starting at -180 degrees, and the sine and cosine of every
+ * step's half angle are computed once. Conversions snap each angle to the nearest step, look up the three axes and
+ * assemble the Quaternion from products alone. One table serves all three axes, using 8 bytes per step.
+ *
+ * Results equal Quaternion::FromEulerDegrees of the snapped angles wrapped into [-180, 180), which is the same
+ * rotation as the unwrapped angles, though possibly with the opposite Quaternion sign.
+ */
+class EulerQuaternionCache {
+public:
+    /**
+     * @param steps_per_turn resolution of each axis, such as 3600 for 0.1 degree steps or 128 for 7-bit MIDI
+     * @param memory_budget_bytes the largest table to build; the resolution is lowered to fit if needed
+     */
+    explicit EulerQuaternionCache(uint32_t steps_per_turn = 3600, size_t memory_budget_bytes = 64 * 1024);
+
+    /**
+     * @brief Get the resolution in effect, after fitting the memory budget
+     */
+    uint32_t GetStepsPerTurn() const;
+
+    /**
+     * @brief Get the size of one step in degrees
+     */
+    float GetStepDegrees() const;
+
+    /**
+     * @brief Get the memory held by the table, in bytes
+     */
+    size_t GetMemoryUsage() const;
+
+    /**
+     * @brief Convert step indices directly, as sent by stepped controllers. Step i is at -180 + i * GetStepDegrees()
+     * degrees; indices outside [0, steps per turn) wrap around
+     */
+    Quaternion FromEulerSteps(int32_t yaw_step, int32_t pitch_step, int32_t roll_step) const;
+
+    /**
+     * @brief Convert Euler degrees, snapping each angle to the nearest step
+     */
+    Quaternion FromEulerDegrees(Float3 euler_degrees) const;
+
+    /**
+     * @brief Convert Euler radians, snapping each angle to the nearest step
+     */
+    Quaternion FromEulerRadians(Float3 euler_radians) const;
+
+    /**
+     * @brief Convert every Euler degrees Float3 of a batch into `output`, resizing it to match
+     */
+    void FromEulerDegrees(const Float3Batch &euler_degrees, QuaternionBatch &output) const;
+
+    /**
+     * @brief Get the step nearest to the given angle in degrees, within [0, steps per turn)
+     */
+    int32_t ToStep(float degrees) const;
+
+private:
+    Quaternion Assemble(int32_t yaw_step, int32_t pitch_step, int32_t roll_step) const;
+
+    uint32_t m_steps_per_turn;
+    float m_steps_per_degree;
+    // Interleaved (sin, cos) of the half angle of every step, so one lookup touches a single cache line
+    std::vector<float, AlignedAllocator<float>> m_half_angle_sin_cos;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_EULERQUATERNIONCACHE_H
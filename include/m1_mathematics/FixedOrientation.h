@@ -0,0 +1,73 @@
+#ifndef M1_ORIENTATIONMANAGER_FIXEDORIENTATION_H
+#define M1_ORIENTATIONMANAGER_FIXEDORIENTATION_H
+
+#include <cstdint>
+
+#include "FixedQuaternion.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Fixed-point counterpart to Orientation, with the same local and parent semantics, for accumulating
+ * tracker updates on targets without a fast FPU. The local Quaternion is renormalized after every rotation so
+ * its length does not drift. Rounding still adds up to about 1e-5 radians per update with Q1.15, against about
+ * 1e-8 with Q1.31, so prefer OrientationQ31 for long runs of small updates
+ */
+template<typename T>
+class FixedOrientation {
+public:
+    FixedOrientation();
+
+    /**
+     * @brief Get the absolute rotation of this FixedOrientation, which equates to this FixedOrientation's local
+     * Quaternion, relative to the parent Quaternion
+     */
+    FixedQuaternion<T> GetGlobalRotation() const;
+
+    /**
+     * @brief Get the absolute rotation of this FixedOrientation as Euler half-turns
+     */
+    FixedFloat3<T> GetGlobalRotationAsEuler() const;
+
+    /**
+     * @brief Rotate this FixedOrientation's local Quaternion by the specified Quaternion adding it to the current rotation
+     */
+    void ApplyRotation(FixedQuaternion<T> quaternion);
+
+    /**
+     * @brief Rotate this FixedOrientation's local Quaternion by the specified Euler half-turns adding it to the current rotation
+     */
+    void ApplyRotation(FixedFloat3<T> euler);
+
+    /**
+     * @brief Set this FixedOrientation's local Quaternion, this still incorporates recentered offsets
+     */
+    void SetRotation(FixedQuaternion<T> quaternion);
+
+    /**
+     * @brief Set this FixedOrientation's local Quaternion and set the parent Quaternion to identity, resetting all
+     * offsets from recentering
+     */
+    void SetGlobalRotation(FixedQuaternion<T> quaternion);
+
+    /**
+     * @brief Set this FixedOrientation's local and parent Quaternion to identity
+     */
+    void Reset();
+
+    /**
+     * @brief Set this FixedOrientation's parent Quaternion to a value, such that the global rotation is identity
+     */
+    void Recenter();
+
+private:
+    FixedQuaternion<T> m_local;
+    FixedQuaternion<T> m_parent;
+};
+
+using OrientationQ15 = FixedOrientation<int16_t>;
+using OrientationQ31 = FixedOrientation<int32_t>;
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_FIXEDORIENTATION_H
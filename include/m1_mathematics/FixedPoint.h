@@ -0,0 +1,92 @@
+#ifndef M1_ORIENTATIONMANAGER_FIXEDPOINT_H
+#define M1_ORIENTATIONMANAGER_FIXEDPOINT_H
+
+#include <cstdint>
+
+namespace Mach1 {
+
+/**
+ * @brief Storage properties of the supported fixed-point formats: Q1.15 in int16_t and Q1.31 in int32_t.
+ * Wide is the accumulator type for products of two values
+ */
+template<typename T>
+struct FixedPointTraits;
+
+template<>
+struct FixedPointTraits<int16_t> {
+    using Wide = int32_t;
+    static constexpr int FRACTION_BITS = 15;
+};
+
+template<>
+struct FixedPointTraits<int32_t> {
+    using Wide = int64_t;
+    static constexpr int FRACTION_BITS = 31;
+};
+
+/**
+ * @brief Integer-only math primitives for the fixed-point Quaternion path, for targets without a fast FPU.
+ *
+ * Angles are binary angles in Q1.31 half-turns: INT32_MIN..INT32_MAX covers [-PI, PI), so wrapping is integer
+ * overflow. Sine and cosine use CORDIC rotation, atan2 uses CORDIC vectoring; both are accurate to a few units in
+ * the last place of Q1.30. Values of one saturate to the largest representable fraction.
+ */
+class FixedPoint {
+public:
+    /**
+     * @brief Convert a float to the given fixed-point format, rounding to nearest and saturating
+     */
+    template<typename T>
+    static T FromFloat(float value);
+
+    /**
+     * @brief Convert a fixed-point value to float
+     */
+    template<typename T>
+    static float ToFloat(T value);
+
+    /**
+     * @brief Convert between the Q1.15 / Q1.31 formats, rounding to nearest when narrowing
+     */
+    template<typename T>
+    static int32_t ToQ31(T value);
+
+    template<typename T>
+    static T FromQ31(int32_t value);
+
+    /**
+     * @brief Clamp a wide intermediate to the int32_t range
+     */
+    static int32_t Saturate32(int64_t value);
+
+    /**
+     * @brief Shift right by `shift` bits, rounding half away from negative infinity; shifts left when negative
+     */
+    static int64_t RoundingShift(int64_t value, int shift);
+
+    /**
+     * @brief Compute the sine and cosine of a Q1.31 half-turn angle, as Q1.31 values
+     */
+    static void SinCos(int32_t angle, int32_t &sine, int32_t &cosine);
+
+    /**
+     * @brief Compute the angle of the vector (x, y) as a Q1.31 half-turn angle. x and y may share any scale.
+     * The direction along negative x is reported as -PI, the one representable half-turn
+     */
+    static int32_t Atan2(int64_t y, int64_t x);
+
+    /**
+     * @brief Get floor(sqrt(value))
+     */
+    static uint32_t Sqrt(uint64_t value);
+
+    /**
+     * @brief Compute 1 / sqrt(value / 2^fraction_bits) by table lookup and Newton iterations, as
+     * `result / 2^shift` with result in [2^30, 2^31]. value must be non-zero
+     */
+    static uint32_t ReciprocalSqrt(uint64_t value, int fraction_bits, int &shift);
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_FIXEDPOINT_H
@@ -0,0 +1,107 @@
+#ifndef M1_ORIENTATIONMANAGER_FIXEDQUATERNION_H
+#define M1_ORIENTATIONMANAGER_FIXEDQUATERNION_H
+
+#include <cstdint>
+
+#include "FixedPoint.h"
+#include "Float3.h"
+#include "Quaternion.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Fixed-point Euler angles as binary angles: Q1.15 / Q1.31 half-turns, so the full range of T covers
+ * [-PI, PI). Components are in the same Yaw, Pitch, Roll order as Euler Float3s
+ */
+template<typename T>
+struct FixedFloat3 {
+    T yaw = 0;
+    T pitch = 0;
+    T roll = 0;
+
+    /**
+     * @brief Convert Euler radians to half-turns; angles outside [-PI, PI) wrap around
+     */
+    static FixedFloat3 FromEulerRadians(Float3 euler_radians);
+
+    /**
+     * @brief Convert to Euler radians within [-PI, PI)
+     */
+    Float3 ToEulerRadians() const;
+};
+
+/**
+ * @brief Fixed-point counterpart to Quaternion for targets without a fast FPU, stored as Q1.15 (int16_t) or
+ * Q1.31 (int32_t) components and computed with integer arithmetic only.
+ *
+ * Components saturate at the largest representable fraction, so the identity stores w as 1 - 2^-15 or 1 - 2^-31.
+ * Products round to nearest; Normalized uses an integer reciprocal square root, and Euler conversions use CORDIC
+ * trigonometry at Q1.31 for both formats, following the same formulas as Quaternion so results can be checked
+ * against the float path.
+ */
+template<typename T>
+class FixedQuaternion {
+public:
+    FixedQuaternion();
+    FixedQuaternion(T qw, T qx, T qy, T qz);
+
+    /**
+     * @brief Convert a float Quaternion, rounding each component to nearest and saturating
+     */
+    static FixedQuaternion FromQuaternion(Quaternion quaternion);
+
+    /**
+     * @brief Construct from Euler angles, in the Yaw-Pitch-Roll order of Quaternion::FromEulerRadians
+     */
+    static FixedQuaternion FromEuler(FixedFloat3<T> euler);
+
+    /**
+     * @brief Convert to a float Quaternion
+     */
+    Quaternion ToQuaternion() const;
+
+    /**
+     * @brief Convert to Euler angles, as Quaternion::ToEulerRadians does
+     */
+    FixedFloat3<T> ToEuler() const;
+
+    /**
+     * @brief Get this Quaternion scaled to unit length; a zero Quaternion yields the identity
+     */
+    FixedQuaternion Normalized() const;
+
+    /**
+     * @brief Get the conjugate, which is the inverse of a unit Quaternion
+     */
+    FixedQuaternion Inversed() const;
+
+    T GetW() const;
+    T GetX() const;
+    T GetY() const;
+    T GetZ() const;
+
+    void operator*=(const FixedQuaternion &rhs);
+
+    bool operator==(const FixedQuaternion &rhs) const;
+    bool operator!=(const FixedQuaternion &rhs) const;
+
+    /**
+     * @brief Hamilton product of unit Quaternions, as Quaternion::operator*
+     */
+    FixedQuaternion operator*(const FixedQuaternion &rhs) const;
+
+private:
+    T m_qw;
+    T m_qx;
+    T m_qy;
+    T m_qz;
+};
+
+using FixedFloat3Q15 = FixedFloat3<int16_t>;
+using FixedFloat3Q31 = FixedFloat3<int32_t>;
+using QuaternionQ15 = FixedQuaternion<int16_t>;
+using QuaternionQ31 = FixedQuaternion<int32_t>;
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_FIXEDQUATERNION_H
@@ -37,16 +37,24 @@ public:
 
     /**
      * @brief Create a Float3, whose components are clamped between the components of the given Float3 instances
-     * @return Float3, whose components are <= those of max and >= those of min
+     * @return Float3, whose components are <= those of max and >= those of min; where a component of min exceeds
+     * that of max, min wins, see MathUtility::Clamp
      */
     Float3 Clamped(Float3 min, Float3 max) const;
     
     /**
      * @brief Create a Float3, whose components are always modulus within the min and max components of the given Float3 instances
-     * @return Float3, whose components are the remainder <= those of max and >= those of min
+     * @return Float3, whose components are wrapped into [min, max), see Wrapped
      */
     Float3 Modulus(Float3 min_fmod, Float3 max_fmod) const;
 
+    /**
+     * @brief Create a Float3, whose components are wrapped into the half-open ranges [min, max) given by the
+     * components of the given Float3 instances, e.g. Euler degrees into [-180, 180)
+     * @return Float3, whose components are >= those of min and < those of max
+     */
+    Float3 Wrapped(Float3 min, Float3 max) const;
+
     /**
      * @brief Create a Float3, whose components are this Float3's components, proportionally remapped from the
      * input range to the given output range.
@@ -0,0 +1,117 @@
+#ifndef M1_ORIENTATIONMANAGER_FLOAT3BATCH_H
+#define M1_ORIENTATIONMANAGER_FLOAT3BATCH_H
+
+#include <cstddef>
+#include <vector>
+
+#include "AlignedAllocator.h"
+#include "Float3.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Structure-of-arrays storage for many Float3s, keeping yaw, pitch and roll components in their own cache-line
+ * aligned arrays.
+ *
+ * The operations mirror those of Float3, but transform the whole batch in place with straight loops the compiler can
+ * vectorize; none of them allocate.
+ */
+class Float3Batch {
+public:
+    Float3Batch();
+    explicit Float3Batch(size_t size);
+
+    size_t Size() const;
+
+    /**
+     * @brief Resize this batch, filling any new entries with zero
+     */
+    void Resize(size_t size);
+
+    /**
+     * @brief Reserve storage for the given number of Float3s, so that growing up to it does not allocate
+     */
+    void Reserve(size_t capacity);
+
+    Float3 Get(size_t index) const;
+    void Set(size_t index, Float3 value);
+
+    float *Yaw();
+    float *Pitch();
+    float *Roll();
+
+    const float *Yaw() const;
+    const float *Pitch() const;
+    const float *Roll() const;
+
+    /**
+     * @brief Get the length of every Float3, writing Size() values into `output`
+     */
+    void Length(float *output) const;
+
+    /**
+     * @brief Scale every Float3 to a length of 1, leaving zero-length ones at zero
+     * @see Float3::Normalized
+     */
+    void Normalize();
+
+    /**
+     * @brief Convert every Float3 from radians to degrees
+     * @see Float3::EulerDegrees
+     */
+    void ToEulerDegrees();
+
+    /**
+     * @brief Convert every Float3 from degrees to radians
+     * @see Float3::EulerRadians
+     */
+    void ToEulerRadians();
+
+    /**
+     * @see Float3::Clamped
+     */
+    void Clamp(Float3 min, Float3 max);
+
+    /**
+     * @see Float3::Modulus
+     */
+    void Modulus(Float3 min_fmod, Float3 max_fmod);
+
+    /**
+     * @see Float3::Wrapped
+     */
+    void Wrap(Float3 min, Float3 max);
+
+    /**
+     * @see Float3::Map
+     */
+    void Map(float from_min, float from_max, float to_min, float to_max);
+
+    /**
+     * @brief Component-wise operators against another batch of the same size
+     */
+    Float3Batch &operator+=(const Float3Batch &rhs);
+    Float3Batch &operator-=(const Float3Batch &rhs);
+    Float3Batch &operator*=(const Float3Batch &rhs);
+    Float3Batch &operator/=(const Float3Batch &rhs);
+
+    /**
+     * @brief Component-wise operators applying the same Float3 to every entry
+     */
+    Float3Batch &operator+=(Float3 rhs);
+    Float3Batch &operator-=(Float3 rhs);
+    Float3Batch &operator*=(Float3 rhs);
+    Float3Batch &operator/=(Float3 rhs);
+
+    Float3Batch &operator*=(float rhs_scalar);
+    Float3Batch &operator/=(float rhs_scalar);
+
+private:
+    std::vector<float, AlignedAllocator<float>> m_yaw;
+    std::vector<float, AlignedAllocator<float>> m_pitch;
+    std::vector<float, AlignedAllocator<float>> m_roll;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_FLOAT3BATCH_H
@@ -0,0 +1,70 @@
+#ifndef M1_ORIENTATIONMANAGER_LISTENERTRANSFORM_H
+#define M1_ORIENTATIONMANAGER_LISTENERTRANSFORM_H
+
+#include <cstddef>
+
+#include "Float3.h"
+#include "Float3Batch.h"
+#include "Orientation.h"
+#include "Pose.h"
+#include "Quaternion.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Expresses source positions relative to a listener's pose, as azimuth, elevation and distance.
+ *
+ * The listener's inverse global rotation is cached as a rotation matrix when the listener is set, so transforming
+ * each source costs a subtract, nine multiply-adds and a square root. Positions follow the vector convention of
+ * Quaternion::Rotate: components along the up (yaw), left (pitch) and forward (roll) axes.
+ *
+ * Azimuth is in radians within [-PI, PI], positive to the listener's left (the same sense as positive yaw), zero
+ * straight ahead. Elevation is in radians within [-PI/2, PI/2], positive upward. A source exactly at the listener's
+ * position reports zero for all three.
+ */
+class ListenerTransform {
+public:
+    ListenerTransform();
+    ListenerTransform(const Orientation &listener, Float3 listener_position);
+
+    /**
+     * @brief Set the listener's pose from its Orientation's global rotation and its position
+     */
+    void SetListener(const Orientation &listener, Float3 listener_position);
+
+    /**
+     * @brief Set the listener's pose from a 6DoF Pose's global transform
+     */
+    void SetListener(const Pose &listener);
+
+    /**
+     * @brief Set the listener's pose from a global rotation Quaternion and its position
+     */
+    void SetListener(Quaternion global_rotation, Float3 listener_position);
+
+    /**
+     * @brief Get the given world position relative to the listener, in the listener's own frame
+     */
+    Float3 ToListenerSpace(Float3 world_position) const;
+
+    /**
+     * @brief Get the azimuth, elevation and distance of a single source
+     * @return Float3 of (azimuth, elevation, distance)
+     */
+    Float3 GetDirection(Float3 world_position) const;
+
+    /**
+     * @brief Compute azimuth, elevation and distance for every source, each output holding source_positions.Size()
+     * values. Runs as a single branch-free loop using a polynomial atan2 (within 2e-6 radians of std::atan2)
+     */
+    void GetDirections(const Float3Batch &source_positions, float *azimuth, float *elevation, float *distance) const;
+
+private:
+    // Rows of the inverse rotation matrix, in (x, y, z) = (forward, left, up) order
+    float m_matrix[3][3];
+    Float3 m_position;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_LISTENERTRANSFORM_H
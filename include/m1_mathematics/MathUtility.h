@@ -11,18 +11,78 @@ public:
     static constexpr float FLOAT_COMPARISON_EPSILON = 0.00001;
     static constexpr float FLOAT_COMPARISON_ONE_MINUS_EPSILON = 1 - FLOAT_COMPARISON_EPSILON;
 
+    static constexpr float DEGREES_TO_RADIANS = 3.14159265358979323846 / 180.0;
+    static constexpr float RADIANS_TO_DEGREES = 180.0 / 3.14159265358979323846;
+
     static bool IsApproximatelyEqual(float a, float b) {
 
         if (a == b) {
             return true;
         }
 
-        float tolerance = FLOAT_COMPARISON_EPSILON * abs(a);
+        float tolerance = FLOAT_COMPARISON_EPSILON * std::fabs(a);
         if (tolerance < FLOAT_COMPARISON_EPSILON) {
             tolerance = FLOAT_COMPARISON_EPSILON;
         }
 
-        return abs(a - b) < tolerance;
+        return std::fabs(a - b) < tolerance;
+    }
+
+    /**
+     * @brief Clamp a value into [min, max]. Unlike std::clamp this is defined when min > max: the value is clamped to
+     * max first and to min last, so min wins and every value maps to min. Selects only, so it vectorizes in a loop
+     */
+    static float Clamp(float value, float min, float max) {
+        value = (max < value) ? max : value;
+        return (value < min) ? min : value;
+    }
+
+    /**
+     * @brief Wrap a value into the half-open range [min, max), e.g. an angle into [-180, 180) or [0, 360).
+     * Branch-free: a floor-multiply instead of std::fmod, with selects (rather than jumps) fixing up rounding,
+     * so it costs the same for every input and vectorizes when used in a loop. Requires min < max
+     */
+    static float Wrap(float value, float min, float max) {
+        float range = max - min;
+        float wrapped = value - std::floor((value - min) * (1.0f / range)) * range;
+
+        // Rounding in the quotient can leave the result a hair outside the range
+        wrapped = (wrapped >= max) ? wrapped - range : wrapped;
+        wrapped = (wrapped < min) ? wrapped + range : wrapped;
+        return (wrapped >= max) ? min : wrapped;
+    }
+
+    /**
+     * @brief Sine usable in constant expressions, for building rotation tables at compile time. Reduces the angle to
+     * [-PI/2, PI/2] and sums the Taylor series to double precision; prefer std::sin at run time
+     */
+    static constexpr double ConstexprSin(double radians) {
+        constexpr double pi = 3.14159265358979323846;
+
+        double turns = radians / (2.0 * pi);
+        auto whole_turns = static_cast<long long>(turns + (turns >= 0.0 ? 0.5 : -0.5));
+        double x = radians - static_cast<double>(whole_turns) * 2.0 * pi;
+
+        // sin(PI - x) == sin(x)
+        x = (x > 0.5 * pi) ? pi - x : x;
+        x = (x < -0.5 * pi) ? -pi - x : x;
+
+        double x_squared = x * x;
+        double term = x;
+        double sum = x;
+        for (int n = 1; n <= 12; n++) {
+            term *= -x_squared / static_cast<double>((2 * n) * (2 * n + 1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    /**
+     * @brief Cosine usable in constant expressions
+     * @see ConstexprSin
+     */
+    static constexpr double ConstexprCos(double radians) {
+        return ConstexprSin(radians + 0.5 * 3.14159265358979323846);
     }
 };
 
@@ -0,0 +1,87 @@
+#ifndef M1_ORIENTATIONMANAGER_ORIENTATIONCHANGEDETECTOR_H
+#define M1_ORIENTATIONMANAGER_ORIENTATIONCHANGEDETECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "AlignedAllocator.h"
+#include "QuaternionBatch.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Finds which of many orientations moved by more than an angular threshold since they were last reported,
+ * so only those need to be sent downstream.
+ *
+ * Each track remembers the rotation it had when it was last flagged dirty, not the previous block's rotation, so a
+ * slow drift is still reported once it adds up to the threshold. The test is a single 4D dot product per track:
+ * a track is dirty when the angle between its current and reported rotation exceeds the threshold, which holds
+ * exactly when |dot| < cos(threshold / 2). Results are available both as a sorted index list and as a bitmask
+ * with bit (i % 64) of word (i / 64) set for track i.
+ */
+class OrientationChangeDetector {
+public:
+    /**
+     * @param threshold_radians smallest angle between the reported and current rotation that counts as a change
+     */
+    explicit OrientationChangeDetector(size_t track_count = 0, float threshold_radians = 0.001f);
+
+    /**
+     * @brief Set the number of tracks. New tracks are reported dirty on the next detection
+     */
+    void Resize(size_t track_count);
+
+    size_t GetTrackCount() const;
+
+    void SetThreshold(float threshold_radians);
+    float GetThreshold() const;
+
+    /**
+     * @brief Force every track to be reported dirty on the next detection, such as after downstream was reset
+     */
+    void Invalidate();
+
+    /**
+     * @brief Compare the given rotations against the last reported ones, resizing to match their count
+     * @return number of dirty tracks
+     */
+    size_t Detect(const QuaternionBatch &rotations);
+
+    /**
+     * @brief Compare SoA rotation components, one value per track, against the last reported ones
+     * @return number of dirty tracks
+     */
+    size_t Detect(const float *w, const float *x, const float *y, const float *z, size_t count);
+
+    /**
+     * @brief Get the indices of the tracks found dirty by the last detection, in ascending order
+     */
+    const std::vector<uint32_t> &GetDirtyIndices() const;
+
+    /**
+     * @brief Get the dirty bitmask of the last detection, holding (track count + 63) / 64 words
+     */
+    const std::vector<uint64_t> &GetDirtyMask() const;
+
+    bool IsDirty(size_t track) const;
+
+private:
+    using AlignedFloats = std::vector<float, AlignedAllocator<float>>;
+
+    float m_threshold;
+    float m_cos_half_threshold;
+
+    AlignedFloats m_reported_w;
+    AlignedFloats m_reported_x;
+    AlignedFloats m_reported_y;
+    AlignedFloats m_reported_z;
+
+    std::vector<uint8_t, AlignedAllocator<uint8_t>> m_flags;
+    std::vector<uint64_t> m_mask;
+    std::vector<uint32_t> m_dirty_indices;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_ORIENTATIONCHANGEDETECTOR_H
@@ -0,0 +1,106 @@
+#ifndef M1_ORIENTATIONMANAGER_ORIENTATIONCOMMANDQUEUE_H
+#define M1_ORIENTATIONMANAGER_ORIENTATIONCOMMANDQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "Orientation.h"
+#include "Quaternion.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Lock-free queue of Orientation operations, written by any number of producer threads and applied to an
+ * Orientation by a single consumer thread, typically the audio thread at each block boundary.
+ *
+ * The queue is a bounded ring allocated once at construction; pushing never allocates or blocks and fails when the
+ * ring is full. Draining multiplies runs of consecutive ApplyRotation commands into one Quaternion before touching
+ * the Orientation.
+ *
+ * Commands are applied in the order their pushes claimed a slot in the ring, not the order in which the pushes
+ * returned. Pushes from one thread therefore keep their order; pushes racing on different threads are ordered by
+ * whichever claimed first. A producer claims its slot and then writes the command into it, and Drain stops at the
+ * first slot that has been claimed but not yet written. A producer preempted between the two steps holds back every
+ * command claimed after it until it resumes, even ones already written, and the ring can fill up behind it.
+ */
+class OrientationCommandQueue {
+public:
+    enum class CommandType : uint8_t {
+        ApplyRotation,
+        SetRotation,
+        SetGlobalRotation,
+        Recenter,
+        Reset
+    };
+
+    /**
+     * @brief Construct a queue holding at least the given number of pending commands, rounded up to a power of two
+     */
+    explicit OrientationCommandQueue(size_t capacity = 1024);
+
+    OrientationCommandQueue(const OrientationCommandQueue &) = delete;
+    OrientationCommandQueue &operator=(const OrientationCommandQueue &) = delete;
+
+    /**
+     * @brief Get the number of commands the queue can hold
+     */
+    size_t Capacity() const;
+
+    /**
+     * @brief Queue Orientation::ApplyRotation. Safe to call from any thread
+     * @return false if the queue is full
+     */
+    bool PushApplyRotation(Quaternion quaternion);
+
+    /**
+     * @brief Queue Orientation::SetRotation. Safe to call from any thread
+     * @return false if the queue is full
+     */
+    bool PushSetRotation(Quaternion quaternion);
+
+    /**
+     * @brief Queue Orientation::SetGlobalRotation. Safe to call from any thread
+     * @return false if the queue is full
+     */
+    bool PushSetGlobalRotation(Quaternion quaternion);
+
+    /**
+     * @brief Queue Orientation::Recenter. Safe to call from any thread
+     * @return false if the queue is full
+     */
+    bool PushRecenter();
+
+    /**
+     * @brief Queue Orientation::Reset. Safe to call from any thread
+     * @return false if the queue is full
+     */
+    bool PushReset();
+
+    /**
+     * @brief Apply every queued command to the given Orientation. Must only be called from the consumer thread.
+     * Consumes at most Capacity() commands; commands pushed while draining, and any queued behind a push that has not
+     * finished writing, are left for a later call
+     * @return number of commands consumed
+     */
+    size_t Drain(Orientation &orientation);
+
+private:
+    struct alignas(64) Cell {
+        std::atomic<size_t> sequence;
+        CommandType type;
+        Quaternion quaternion;
+    };
+
+    bool Push(CommandType type, Quaternion quaternion);
+
+    std::unique_ptr<Cell[]> m_cells;
+    size_t m_mask;
+    alignas(64) std::atomic<size_t> m_enqueue_position;
+    alignas(64) size_t m_dequeue_position;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_ORIENTATIONCOMMANDQUEUE_H
@@ -0,0 +1,307 @@
+#ifndef M1_ORIENTATIONMANAGER_ORIENTATIONPIPELINE_H
+#define M1_ORIENTATIONMANAGER_ORIENTATIONPIPELINE_H
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "AlignedAllocator.h"
+#include "OrientationResampler.h"
+#include "Quaternion.h"
+#include "QuaternionBatch.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Pulls chunks of orientation frames from a source and runs a fixed chain of stages over them in place, as a
+ * single pass over memory.
+ *
+ * A chunk is a QuaternionBatch in the frame-major layout of OrientationResampler::Process: the orientation of `track`
+ * at frame `f` is at index `f * track_count + track`. The caller owns the chunk and reuses it between pulls, so the
+ * pipeline needs no intermediate buffers and, once the chunk has reached its size, does not allocate.
+ *
+ * The chain is fixed by the template arguments. Every stage's Process is inline, so the compiler fuses the whole
+ * chain into the body of one loop: each Quaternion is loaded once, passed through the stages in registers, and
+ * stored once.
+ *
+ * A source provides `size_t Fill(QuaternionBatch &chunk)`, which writes the next frames and returns how many it wrote,
+ * with 0 meaning the stream has ended. A source that knows its track count may also provide
+ * `size_t GetTrackCount() const`, which debug builds check against the pipeline's. A stage provides
+ * `void Resize(size_t track_count)` and `void Process(size_t track, float &w, float &x, float &y, float &z)`, keeping
+ * any state per track.
+ *
+ * A live source such as ResamplerSource never ends, so it is pulled once per block rather than drained:
+ * @code
+ * auto pipeline = MakeOrientationPipeline(ResamplerSource(resampler, 32),
+ *                                         SmoothStage(0.6f), PredictStage(2.0f), RecenterStage());
+ * // in the audio callback
+ * size_t frame_count = pipeline.Pull(chunk);
+ * @endcode
+ */
+template <typename Source, typename... Stages>
+class OrientationPipeline {
+public:
+    OrientationPipeline(size_t track_count, Source source, Stages... stages)
+            : m_track_count(track_count), m_source(std::move(source)), m_stages(std::move(stages)...) {
+        // A source laying out more or fewer tracks per frame than the pipeline walks would be read out of step
+        assert(SourceTrackCount(m_source, 0) == track_count);
+        std::apply([track_count](Stages &... stage) { (stage.Resize(track_count), ...); }, m_stages);
+    }
+
+    size_t GetTrackCount() const {
+        return m_track_count;
+    }
+
+    Source &GetSource() {
+        return m_source;
+    }
+
+    /**
+     * @brief Get a stage by its position in the chain, such as to recenter or reset it
+     */
+    template <size_t Index>
+    auto &GetStage() {
+        return std::get<Index>(m_stages);
+    }
+
+    /**
+     * @brief Fill the chunk from the source and run every stage over it
+     * @return number of frames produced, 0 once the source has ended
+     */
+    size_t Pull(QuaternionBatch &chunk) {
+        size_t frame_count = m_source.Fill(chunk);
+        Process(chunk, frame_count);
+        return frame_count;
+    }
+
+    /**
+     * @brief Run every stage over the first `frame_count` frames of a chunk filled elsewhere
+     */
+    void Process(QuaternionBatch &chunk, size_t frame_count) {
+        float *w = chunk.W();
+        float *x = chunk.X();
+        float *y = chunk.Y();
+        float *z = chunk.Z();
+
+        for (size_t frame = 0; frame < frame_count; frame++) {
+            size_t base = frame * m_track_count;
+            for (size_t track = 0; track < m_track_count; track++) {
+                size_t i = base + track;
+                float qw = w[i], qx = x[i], qy = y[i], qz = z[i];
+                std::apply([&](Stages &... stage) { (stage.Process(track, qw, qx, qy, qz), ...); }, m_stages);
+                w[i] = qw;
+                x[i] = qx;
+                y[i] = qy;
+                z[i] = qz;
+            }
+        }
+    }
+
+private:
+    template <typename S>
+    auto SourceTrackCount(const S &source, int) const -> decltype(source.GetTrackCount()) {
+        return source.GetTrackCount();
+    }
+
+    // Sources that do not report a track count are taken at the pipeline's word
+    template <typename S>
+    size_t SourceTrackCount(const S &, long) const {
+        return m_track_count;
+    }
+
+    size_t m_track_count;
+    Source m_source;
+    std::tuple<Stages...> m_stages;
+};
+
+/**
+ * @brief Build an OrientationPipeline, deducing its source and stage types
+ */
+template <typename Source, typename... Stages>
+OrientationPipeline<Source, Stages...> MakeOrientationPipeline(size_t track_count, Source source, Stages... stages) {
+    return OrientationPipeline<Source, Stages...>(track_count, std::move(source), std::move(stages)...);
+}
+
+/**
+ * @brief Source that resamples timestamped tracker samples onto the output clock, a fixed number of frames per chunk.
+ * It is a live source: every Fill produces a full chunk, holding the last sample while the tracker is silent, so it
+ * never reports the end of the stream
+ */
+class ResamplerSource {
+public:
+    ResamplerSource(OrientationResampler &resampler, size_t frames_per_chunk);
+
+    size_t GetTrackCount() const;
+
+    size_t Fill(QuaternionBatch &chunk);
+
+private:
+    OrientationResampler *m_resampler;
+    size_t m_frames_per_chunk;
+};
+
+/**
+ * @brief Build an OrientationPipeline over a ResamplerSource, taking the track count from its resampler
+ */
+template <typename... Stages>
+OrientationPipeline<ResamplerSource, Stages...> MakeOrientationPipeline(ResamplerSource source, Stages... stages) {
+    size_t track_count = source.GetTrackCount();
+    return OrientationPipeline<ResamplerSource, Stages...>(track_count, std::move(source), std::move(stages)...);
+}
+
+/**
+ * @brief One-pole smoothing of each track towards its incoming rotation, by normalized linear interpolation along
+ * the shorter arc. The first frame of a track passes through unchanged
+ */
+class SmoothStage {
+public:
+    /**
+     * @param smoothing 0 passes rotations through, values towards 1 follow them ever more slowly; clamped to
+     * [0, 0.999]
+     */
+    explicit SmoothStage(float smoothing = 0.5f);
+
+    void SetSmoothing(float smoothing);
+    float GetSmoothing() const;
+
+    void Resize(size_t track_count);
+
+    /**
+     * @brief Forget the smoothed state, so each track's next frame passes through unchanged
+     */
+    void Reset();
+
+    void Process(size_t track, float &w, float &x, float &y, float &z) {
+        float sw = m_w[track], sx = m_x[track], sy = m_y[track], sz = m_z[track];
+
+        // The state starts at zero, which makes the first interpolation land exactly on the incoming rotation
+        float sign = sw * w + sx * x + sy * y + sz * z < 0.0f ? -1.0f : 1.0f;
+        float follow = m_follow;
+        sw += follow * (sign * w - sw);
+        sx += follow * (sign * x - sx);
+        sy += follow * (sign * y - sy);
+        sz += follow * (sign * z - sz);
+
+        float inverse_length = 1.0f / std::sqrt(sw * sw + sx * sx + sy * sy + sz * sz);
+        w = m_w[track] = sw * inverse_length;
+        x = m_x[track] = sx * inverse_length;
+        y = m_y[track] = sy * inverse_length;
+        z = m_z[track] = sz * inverse_length;
+    }
+
+private:
+    using AlignedFloats = std::vector<float, AlignedAllocator<float>>;
+
+    float m_smoothing;
+    float m_follow;
+    AlignedFloats m_w, m_x, m_y, m_z;
+};
+
+/**
+ * @brief Extrapolates each track ahead by a number of frames at its current rate of rotation, to hide the latency
+ * between tracker and renderer. The step is linear on the unit sphere and renormalized, which stays within a
+ * fraction of a degree of true constant-velocity prediction for the small per-frame rotations of head tracking
+ */
+class PredictStage {
+public:
+    explicit PredictStage(float lookahead_frames = 1.0f);
+
+    void SetLookahead(float lookahead_frames);
+    float GetLookahead() const;
+
+    void Resize(size_t track_count);
+
+    /**
+     * @brief Forget the previous frames, so each track's next frame passes through unchanged
+     */
+    void Reset();
+
+    void Process(size_t track, float &w, float &x, float &y, float &z) {
+        float pw = m_w[track], px = m_x[track], py = m_y[track], pz = m_z[track];
+        m_w[track] = w;
+        m_x[track] = x;
+        m_y[track] = y;
+        m_z[track] = z;
+
+        // Compare against the previous frame on the same side of the double cover; a zero previous frame (no
+        // history yet) gives a step along the rotation itself, which renormalizes back to it
+        float sign = pw * w + px * x + py * y + pz * z < 0.0f ? -1.0f : 1.0f;
+        float lookahead = m_lookahead;
+        float ew = w + lookahead * (w - sign * pw);
+        float ex = x + lookahead * (x - sign * px);
+        float ey = y + lookahead * (y - sign * py);
+        float ez = z + lookahead * (z - sign * pz);
+
+        float inverse_length = 1.0f / std::sqrt(ew * ew + ex * ex + ey * ey + ez * ez);
+        w = ew * inverse_length;
+        x = ex * inverse_length;
+        y = ey * inverse_length;
+        z = ez * inverse_length;
+    }
+
+private:
+    using AlignedFloats = std::vector<float, AlignedAllocator<float>>;
+
+    float m_lookahead;
+    AlignedFloats m_w, m_x, m_y, m_z;
+};
+
+/**
+ * @brief Applies a per-track parent rotation, as Orientation does: the output is parent * input. Recentering a track
+ * sets its parent to the inverse of the rotation it last passed through, making that rotation the new zero
+ */
+class RecenterStage {
+public:
+    void Resize(size_t track_count);
+
+    /**
+     * @brief Make the last rotation seen on the track its new zero, as Orientation::Recenter
+     */
+    void Recenter(size_t track);
+
+    /**
+     * @brief Recenter every track
+     */
+    void RecenterAll();
+
+    /**
+     * @brief Set the parent rotation of a track directly
+     */
+    void SetParent(size_t track, Quaternion parent);
+    Quaternion GetParent(size_t track) const;
+
+    /**
+     * @brief Set every parent back to identity, as Orientation::Reset does
+     */
+    void Reset();
+
+    void Process(size_t track, float &w, float &x, float &y, float &z) {
+        m_local_w[track] = w;
+        m_local_x[track] = x;
+        m_local_y[track] = y;
+        m_local_z[track] = z;
+
+        float pw = m_parent_w[track], px = m_parent_x[track], py = m_parent_y[track], pz = m_parent_z[track];
+        float rw = pw * w - px * x - py * y - pz * z;
+        float rx = pw * x + px * w + py * z - pz * y;
+        float ry = pw * y + py * w + pz * x - px * z;
+        float rz = pw * z + pz * w + px * y - py * x;
+        w = rw;
+        x = rx;
+        y = ry;
+        z = rz;
+    }
+
+private:
+    using AlignedFloats = std::vector<float, AlignedAllocator<float>>;
+
+    AlignedFloats m_parent_w, m_parent_x, m_parent_y, m_parent_z;
+    AlignedFloats m_local_w, m_local_x, m_local_y, m_local_z;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_ORIENTATIONPIPELINE_H
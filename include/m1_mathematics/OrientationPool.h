@@ -0,0 +1,182 @@
+#ifndef M1_ORIENTATIONMANAGER_ORIENTATIONPOOL_H
+#define M1_ORIENTATIONMANAGER_ORIENTATIONPOOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Float3.h"
+#include "Quaternion.h"
+#include "QuaternionBatch.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Stable reference to an Orientation stored in an OrientationPool. A handle goes stale once its Orientation is
+ * destroyed, even if the slot is later reused. Default-constructed handles are never valid
+ */
+struct OrientationHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0;
+
+    bool operator==(const OrientationHandle &rhs) const { return index == rhs.index && generation == rhs.generation; }
+    bool operator!=(const OrientationHandle &rhs) const { return !(*this == rhs); }
+};
+
+/**
+ * @brief Bulk storage for many Orientations, holding every local and parent Quaternion in contiguous, cache-line
+ * aligned SoA arrays instead of one heap object per Orientation.
+ *
+ * Live Orientations are kept densely packed in positions [0, Size()), so whole-pool passes are straight loops.
+ * Destroying an Orientation moves the last one into its place, which keeps create and destroy O(1) but means dense
+ * positions are not stable; hold on to handles, and translate with GetDenseIndex / GetHandle when needed.
+ *
+ * Every Orientation operation is available by handle, and over a dense range [first, first + count), where per-item
+ * inputs and outputs are indexed from 0 to count - 1. Operations given a stale handle do nothing, and getters return
+ * the identity rotation, so a handle kept past Destroy can never reach the Orientation that reuses its slot.
+ */
+class OrientationPool {
+public:
+    OrientationPool();
+
+    /**
+     * @brief Reserve room for the given number of Orientations, so that Create does not allocate until it is exceeded
+     */
+    void Reserve(size_t capacity);
+
+    /**
+     * @brief Create an Orientation with zero local and parent rotations
+     */
+    OrientationHandle Create();
+
+    /**
+     * @brief Destroy the referenced Orientation
+     * @return false if the handle was already stale
+     */
+    bool Destroy(OrientationHandle handle);
+
+    /**
+     * @brief Destroy every Orientation, invalidating all handles
+     */
+    void Clear();
+
+    bool IsValid(OrientationHandle handle) const;
+
+    /**
+     * @brief Get the number of live Orientations
+     */
+    size_t Size() const;
+
+    /**
+     * @brief Get the current dense position of the referenced Orientation, or Size() if the handle is stale
+     */
+    size_t GetDenseIndex(OrientationHandle handle) const;
+
+    /**
+     * @brief Get the handle of the Orientation at the given dense position
+     */
+    OrientationHandle GetHandle(size_t dense_index) const;
+
+    // ================================================== BY HANDLE ===================================================
+
+    /** @see Orientation::GetGlobalRotationAsEulerDegrees */
+    Float3 GetGlobalRotationAsEulerDegrees(OrientationHandle handle) const;
+    /** @see Orientation::GetGlobalRotationAsEulerRadians */
+    Float3 GetGlobalRotationAsEulerRadians(OrientationHandle handle) const;
+    /** @see Orientation::GetGlobalRotationAsQuaternion */
+    Quaternion GetGlobalRotationAsQuaternion(OrientationHandle handle) const;
+
+    /** @see Orientation::ApplyRotation */
+    void ApplyRotation(OrientationHandle handle, Quaternion quaternion);
+    /** @see Orientation::ApplyRotationDegrees */
+    void ApplyRotationDegrees(OrientationHandle handle, Float3 rotationDegrees);
+    /** @see Orientation::ApplyRotationDegrees_YawAxis */
+    void ApplyRotationDegrees_YawAxis(OrientationHandle handle, float yaw);
+    /** @see Orientation::ApplyRotationDegrees_PitchAxis */
+    void ApplyRotationDegrees_PitchAxis(OrientationHandle handle, float pitch);
+    /** @see Orientation::ApplyRotationDegrees_RollAxis */
+    void ApplyRotationDegrees_RollAxis(OrientationHandle handle, float roll);
+    /** @see Orientation::ApplyRotation */
+    void ApplyRotation(OrientationHandle handle, Float3 rotationRadians);
+    /** @see Orientation::ApplyRotation_YawAxis */
+    void ApplyRotation_YawAxis(OrientationHandle handle, float yaw);
+    /** @see Orientation::ApplyRotation_PitchAxis */
+    void ApplyRotation_PitchAxis(OrientationHandle handle, float pitch);
+    /** @see Orientation::ApplyRotation_RollAxis */
+    void ApplyRotation_RollAxis(OrientationHandle handle, float roll);
+
+    /** @see Orientation::SetRotation */
+    void SetRotation(OrientationHandle handle, Float3 rotationRadians);
+    /** @see Orientation::SetRotation */
+    void SetRotation(OrientationHandle handle, Quaternion quaternion);
+    /** @see Orientation::SetGlobalRotation */
+    void SetGlobalRotation(OrientationHandle handle, Float3 rotationRadians);
+    /** @see Orientation::SetGlobalRotation */
+    void SetGlobalRotation(OrientationHandle handle, Quaternion quaternion);
+
+    /** @see Orientation::Reset */
+    void Reset(OrientationHandle handle);
+    /** @see Orientation::Recenter */
+    void Recenter(OrientationHandle handle);
+
+    // =================================================== BY RANGE ===================================================
+
+    void GetGlobalRotationAsEulerDegrees(size_t first, size_t count, Float3 *output) const;
+    void GetGlobalRotationAsEulerRadians(size_t first, size_t count, Float3 *output) const;
+
+    /**
+     * @brief Write the global rotations of the range into `output`, which is resized to `count` if needed
+     */
+    void GetGlobalRotationAsQuaternion(size_t first, size_t count, QuaternionBatch &output) const;
+
+    /**
+     * @brief Apply `quaternions[i]` to the Orientation at dense position `first + i`
+     */
+    void ApplyRotation(size_t first, size_t count, const QuaternionBatch &quaternions);
+
+    /**
+     * @brief Apply the same Quaternion to every Orientation in the range
+     */
+    void ApplyRotation(size_t first, size_t count, Quaternion quaternion);
+
+    void ApplyRotationDegrees(size_t first, size_t count, const Float3 *rotationsDegrees);
+    void ApplyRotationDegrees_YawAxis(size_t first, size_t count, const float *yaw);
+    void ApplyRotationDegrees_PitchAxis(size_t first, size_t count, const float *pitch);
+    void ApplyRotationDegrees_RollAxis(size_t first, size_t count, const float *roll);
+    void ApplyRotation(size_t first, size_t count, const Float3 *rotationsRadians);
+    void ApplyRotation_YawAxis(size_t first, size_t count, const float *yaw);
+    void ApplyRotation_PitchAxis(size_t first, size_t count, const float *pitch);
+    void ApplyRotation_RollAxis(size_t first, size_t count, const float *roll);
+
+    void SetRotation(size_t first, size_t count, const Float3 *rotationsRadians);
+    void SetRotation(size_t first, size_t count, const QuaternionBatch &quaternions);
+    void SetGlobalRotation(size_t first, size_t count, const Float3 *rotationsRadians);
+    void SetGlobalRotation(size_t first, size_t count, const QuaternionBatch &quaternions);
+
+    void Reset(size_t first, size_t count);
+    void Recenter(size_t first, size_t count);
+
+    /**
+     * @brief Direct access to the dense SoA storage, for custom kernels
+     */
+    const QuaternionBatch &GetLocalRotations() const;
+    const QuaternionBatch &GetParentRotations() const;
+
+private:
+    Quaternion GetLocal(size_t dense) const;
+    void SetLocal(size_t dense, Quaternion quaternion);
+    void ApplyLocal(size_t dense, Quaternion quaternion);
+
+    QuaternionBatch m_local;
+    QuaternionBatch m_parent;
+    std::vector<uint32_t> m_denseToSlot;
+
+    std::vector<uint32_t> m_slotToDense;
+    std::vector<uint32_t> m_slotGeneration;
+    std::vector<uint32_t> m_freeSlots;
+    size_t m_size;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_ORIENTATIONPOOL_H
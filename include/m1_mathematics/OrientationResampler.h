@@ -0,0 +1,96 @@
+#ifndef M1_ORIENTATIONMANAGER_ORIENTATIONRESAMPLER_H
+#define M1_ORIENTATIONMANAGER_ORIENTATIONRESAMPLER_H
+
+#include <cstddef>
+#include <vector>
+
+#include "Quaternion.h"
+#include "QuaternionBatch.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Resamples many parallel streams of timestamped Quaternion samples, arriving at jittery and non-uniform
+ * times, onto a fixed-rate output clock (e.g. audio block boundaries).
+ *
+ * Every track keeps a fixed-capacity history of samples, so memory is bounded regardless of how long the stream runs
+ * or how irregularly Process is called. Samples are held in structure-of-arrays form across all tracks.
+ */
+class OrientationResampler {
+public:
+    enum class Interpolation {
+        Slerp,
+        Squad
+    };
+
+    /**
+     * @param track_count number of independent orientation streams
+     * @param output_rate number of output frames per unit of timestamp (e.g. blocks per second)
+     * @param interpolation how to interpolate between the samples surrounding an output frame
+     * @param history_capacity maximum number of pending samples held per track, at least 4
+     */
+    OrientationResampler(size_t track_count, double output_rate,
+                         Interpolation interpolation = Interpolation::Slerp, size_t history_capacity = 16);
+
+    size_t GetTrackCount() const;
+    double GetOutputRate() const;
+    Interpolation GetInterpolation() const;
+
+    /**
+     * @brief Get the timestamp at which the next output frame will be produced
+     */
+    double GetOutputTime() const;
+
+    /**
+     * @brief Move the output clock, so that the next output frame is produced at the given timestamp.
+     * Trailing the incoming samples by a little latency lets every frame be interpolated rather than held
+     */
+    void SetOutputTime(double time);
+
+    /**
+     * @brief Add a sample to the given track. Samples must arrive in increasing timestamp order; when the track's
+     * history is full, its oldest sample is dropped
+     * @return false if the sample was rejected, because its timestamp is not newer than the track's latest sample
+     */
+    bool PushSample(size_t track, double timestamp, Quaternion quaternion);
+
+    /**
+     * @brief Get the number of samples currently held for the given track
+     */
+    size_t GetPendingSampleCount(size_t track) const;
+
+    /**
+     * @brief Produce `frame_count` output frames for every track, advancing the output clock.
+     * Output is frame-major: the orientation of `track` at frame `f` lands at index `f * GetTrackCount() + track`.
+     * Before a track's first sample or after its last one, the nearest sample is held
+     */
+    void Process(size_t frame_count, QuaternionBatch &output);
+
+    /**
+     * @brief Drop all samples from every track and rewind the output clock to zero
+     */
+    void Reset();
+
+private:
+    size_t SlotOf(size_t track, size_t offset) const;
+    Quaternion Evaluate(size_t track, double time);
+    void DropOldest(size_t track);
+
+    size_t m_trackCount;
+    size_t m_capacity;
+    double m_outputRate;
+    Interpolation m_interpolation;
+
+    double m_outputStartTime;
+    size_t m_framesProduced;
+
+    std::vector<double> m_times;
+    QuaternionBatch m_samples;
+    std::vector<size_t> m_head;
+    std::vector<size_t> m_count;
+    std::vector<size_t> m_cursor;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_ORIENTATIONRESAMPLER_H
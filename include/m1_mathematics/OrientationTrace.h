@@ -0,0 +1,116 @@
+#ifndef M1_ORIENTATIONMANAGER_ORIENTATIONTRACE_H
+#define M1_ORIENTATIONMANAGER_ORIENTATIONTRACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "Float3.h"
+#include "Orientation.h"
+#include "Quaternion.h"
+
+namespace Mach1 {
+
+/**
+ * @brief One recorded call on an Orientation, addressed by object index
+ */
+struct OrientationTraceEvent {
+    enum class Type : uint8_t {
+        ApplyRotation,              ///< values: w, x, y, z
+        ApplyRotationRadians,       ///< values: yaw, pitch, roll
+        ApplyRotationDegrees,       ///< values: yaw, pitch, roll
+        ApplyRotationYaw,           ///< values: radians
+        ApplyRotationPitch,         ///< values: radians
+        ApplyRotationRoll,          ///< values: radians
+        SetRotation,                ///< values: w, x, y, z
+        SetGlobalRotation,          ///< values: w, x, y, z
+        Recenter,
+        Reset,
+        GetGlobalRotation,          ///< GetGlobalRotationAsQuaternion
+        GetGlobalRotationDegrees    ///< GetGlobalRotationAsEulerDegrees
+    };
+
+    uint64_t timestamp_us = 0;
+    uint32_t object = 0;
+    Type type = Type::GetGlobalRotation;
+    float values[4] = {0, 0, 0, 0};
+};
+
+/**
+ * @brief A recorded sequence of Orientation operations, used to replay real update patterns (bursty tracker packets,
+ * recenter storms, quiet periods) through the library.
+ *
+ * Traces are stored as text, one event per line:
+ *
+ *     <timestamp_us> <object> <op> [values...]
+ *
+ * where op is one of apply, apply_euler, apply_euler_deg, apply_yaw, apply_pitch, apply_roll, set, set_global,
+ * recenter, reset, get and get_euler_deg. Quaternion values are written w x y z and Euler values yaw pitch roll in the
+ * units the op names. Blank lines and lines starting with '#' are ignored.
+ */
+class OrientationTrace {
+public:
+    /**
+     * @brief Append an event. Recording code calls this next to the Orientation call it mirrors
+     */
+    void Add(const OrientationTraceEvent &event);
+
+    /**
+     * @brief Append an event of the given type with up to four values
+     */
+    void Add(uint64_t timestamp_us, uint32_t object, OrientationTraceEvent::Type type,
+             float v0 = 0, float v1 = 0, float v2 = 0, float v3 = 0);
+
+    /**
+     * @brief Remove all events
+     */
+    void Clear();
+
+    /**
+     * @brief Get the number of events
+     */
+    size_t Size() const;
+
+    /**
+     * @brief Get one more than the highest object index referenced, i.e. the number of Orientations a replay needs
+     */
+    size_t ObjectCount() const;
+
+    /**
+     * @brief Get the events in recorded order
+     */
+    const std::vector<OrientationTraceEvent> &GetEvents() const;
+
+    /**
+     * @brief Replace this trace with the events parsed from a stream
+     * @param error receives a message naming the offending line when parsing fails, if not null
+     * @return false if any line could not be parsed, in which case the trace is left empty
+     */
+    bool Read(std::istream &stream, std::string *error = nullptr);
+
+    /**
+     * @brief Write this trace to a stream in the format Read accepts
+     */
+    void Write(std::ostream &stream) const;
+
+    /**
+     * @brief Get the trace name of an event type, e.g. "apply_yaw"
+     */
+    static const char *GetTypeName(OrientationTraceEvent::Type type);
+
+    /**
+     * @brief Perform one event on an Orientation
+     * @return the sum of the components read by Get events, or 0 for writes, so callers can keep reads observable
+     */
+    static float Apply(const OrientationTraceEvent &event, Orientation &orientation);
+
+private:
+    std::vector<OrientationTraceEvent> m_events;
+    size_t m_object_count = 0;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_ORIENTATIONTRACE_H
@@ -0,0 +1,89 @@
+#ifndef M1_ORIENTATIONMANAGER_POSE_H
+#define M1_ORIENTATIONMANAGER_POSE_H
+
+#include "DualQuaternion.h"
+#include "Float3.h"
+#include "Orientation.h"
+#include "Quaternion.h"
+
+namespace Mach1 {
+
+/**
+ * @brief A 6DoF counterpart to Orientation: a local rigid transform relative to a parent transform, with the same
+ * recentering semantics. Recentering makes the current pose the origin, so later movement is reported relative to
+ * where the pose was, both in rotation and in position
+ */
+class Pose {
+public:
+    Pose();
+
+    /**
+     * @brief Construct a Pose from an Orientation's global rotation, placed at the given position
+     */
+    Pose(const Orientation &orientation, Float3 position);
+
+    /**
+     * @brief Get the absolute transform of this Pose, which equates to this Pose's local transform,
+     * relative to the parent transform
+     */
+    DualQuaternion GetGlobalTransform() const;
+
+    /**
+     * @brief Get the rotation of the absolute transform as a Quaternion
+     */
+    Quaternion GetGlobalRotationAsQuaternion() const;
+
+    /**
+     * @brief Get the position of the absolute transform
+     */
+    Float3 GetGlobalPosition() const;
+
+    /**
+     * @brief Apply the specified transform to this Pose's local transform, in the local frame
+     */
+    void ApplyTransform(DualQuaternion transform);
+
+    /**
+     * @brief Rotate this Pose's local transform by the specified Quaternion, in the local frame
+     */
+    void ApplyRotation(Quaternion quaternion);
+
+    /**
+     * @brief Move this Pose's local transform by the specified vector, given in the local frame
+     */
+    void ApplyTranslation(Float3 translation);
+
+    /**
+     * @brief Set this Pose's local transform, this still incorporates recentered offsets
+     */
+    void SetTransform(DualQuaternion transform);
+
+    /**
+     * @brief Set this Pose's local transform from a rotation and position, this still incorporates recentered offsets
+     */
+    void SetTransform(Quaternion rotation, Float3 position);
+
+    /**
+     * @brief Set this Pose's local transform and set the parent transform to identity, resetting all offsets from
+     * recentering
+     */
+    void SetGlobalTransform(DualQuaternion transform);
+
+    /**
+     * @brief Set this Pose's local and parent transforms to identity
+     */
+    void Reset();
+
+    /**
+     * @brief Set this Pose's parent transform to a value, such that the global transform is identity
+     */
+    void Recenter();
+
+private:
+    DualQuaternion m_local;
+    DualQuaternion m_parent;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_POSE_H
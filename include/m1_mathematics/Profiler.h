@@ -0,0 +1,131 @@
+#ifndef M1_ORIENTATIONMANAGER_PROFILER_H
+#define M1_ORIENTATIONMANAGER_PROFILER_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace Mach1 {
+
+/**
+ * @brief Per-kernel hardware counter statistics for the library's hottest scalar kernels, as deployed.
+ *
+ * With M1_MATHEMATICS_PROFILING defined, the library wraps each Kernel in a Scope that reads the calling thread's
+ * counters on entry and exit and adds the difference to process-wide totals. On Linux the counters are a perf_event
+ * group of user-space cycles, instructions and cache misses; where perf_event cannot be opened, e.g. without
+ * permission, only cycles are counted, from rdtsc on x86 and from a steady clock in nanoseconds elsewhere. Without
+ * M1_MATHEMATICS_PROFILING the kernels carry no Scope at all and every statistic stays zero.
+ *
+ * A perf_event Scope costs two read system calls, far more than the kernels themselves, so counts are for
+ * attributing cost between kernels and builds rather than for timing the surrounding program. Counters are opened
+ * once per thread on first use, which is not real-time safe; call AttachThread beforehand on audio threads.
+ */
+class Profiler {
+public:
+    enum class Kernel : uint8_t {
+        QuaternionMultiply,
+        QuaternionFromEulerRadians,
+        QuaternionToEulerRadians,
+        Float3Normalized,
+        Count
+    };
+
+    enum class Backend : uint8_t {
+        PerfEvent,
+        Rdtsc,
+        SteadyClock
+    };
+
+    /**
+     * @brief Totals of one Kernel across all threads since the last Reset
+     */
+    struct KernelStats {
+        uint64_t calls = 0;
+
+        /// CPU cycles with PerfEvent, timestamp counter ticks with Rdtsc, nanoseconds with SteadyClock
+        uint64_t cycles = 0;
+
+        /// Zero unless the backend is PerfEvent and the counter could be opened, see HasInstructions
+        uint64_t instructions = 0;
+
+        /// Zero unless the backend is PerfEvent and the counter could be opened, see HasCacheMisses
+        uint64_t cache_misses = 0;
+
+        double CyclesPerCall() const {
+            return calls ? static_cast<double>(cycles) / static_cast<double>(calls) : 0.0;
+        }
+
+        double InstructionsPerCall() const {
+            return calls ? static_cast<double>(instructions) / static_cast<double>(calls) : 0.0;
+        }
+
+        double CacheMissesPerCall() const {
+            return calls ? static_cast<double>(cache_misses) / static_cast<double>(calls) : 0.0;
+        }
+    };
+
+    /**
+     * @brief Counts one call of a Kernel on the current thread, from construction to destruction
+     */
+    class Scope {
+    public:
+        explicit Scope(Kernel kernel);
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        Kernel m_kernel;
+        uint64_t m_start[3];
+    };
+
+    /**
+     * @brief Check whether the library was built with M1_MATHEMATICS_PROFILING, i.e. whether its kernels count
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Get the counter source, chosen once per process on first use
+     */
+    static Backend GetBackend();
+
+    static bool HasInstructions();
+    static bool HasCacheMisses();
+
+    /**
+     * @brief Open the calling thread's counters now rather than in its first Scope
+     */
+    static void AttachThread();
+
+    /**
+     * @brief Get the name of a Kernel as it appears in the JSON dump, e.g. "Quaternion::operator*="
+     */
+    static const char *GetKernelName(Kernel kernel);
+
+    static const char *GetBackendName(Backend backend);
+
+    static KernelStats GetStats(Kernel kernel);
+
+    /**
+     * @brief Zero the statistics of every Kernel
+     */
+    static void Reset();
+
+    /**
+     * @brief Write every Kernel's statistics as a JSON object. Counters the backend does not provide are null
+     */
+    static void WriteJson(std::ostream &stream);
+
+    static std::string ToJson();
+};
+
+} // namespace Mach1
+
+#if defined(M1_MATHEMATICS_PROFILING)
+#define M1_PROFILE_KERNEL(kernel) ::Mach1::Profiler::Scope m1_profile_scope(::Mach1::Profiler::Kernel::kernel)
+#else
+#define M1_PROFILE_KERNEL(kernel) static_cast<void>(0)
+#endif
+
+#endif //M1_ORIENTATIONMANAGER_PROFILER_H
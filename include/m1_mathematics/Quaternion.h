@@ -9,8 +9,9 @@ class Float3;
 
 class Quaternion {
 public:
-    Quaternion();
-    Quaternion(float qw, float qx, float qy, float qz);
+    // Constructors and getters are constexpr so that rotation tables can be built at compile time, see StaticRotation
+    constexpr Quaternion() : m_qw(1.0f), m_qx(0.0f), m_qy(0.0f), m_qz(0.0f) {}
+    constexpr Quaternion(float qw, float qx, float qy, float qz) : m_qw(qw), m_qx(qx), m_qy(qy), m_qz(qz) {}
 
     /**
      * @brief Construct a Quaternion from a given Euler degrees Float3
@@ -26,6 +27,125 @@ public:
      */
     static Quaternion FromEulerRadians(Float3 euler_radians);
 
+    /**
+     * @brief Construct a Quaternion rotating by the given radians around the given axis
+     * @param axis Float3 direction of the rotation axis, with components along the Yaw (z), Pitch (y) and Roll (x)
+     * axes as in Euler Float3s; it does not need to be normalized. A zero axis yields the identity Quaternion
+     */
+    static Quaternion FromAxisAngle(Float3 axis, float angle);
+
+    /**
+     * @brief Get the rotation axis and angle of this unit Quaternion, choosing the angle within [0, PI].
+     * The identity Quaternion reports a zero angle around the Roll axis
+     * @param axis receives the normalized rotation axis, see FromAxisAngle for its components
+     * @param angle receives the rotation angle in radians
+     */
+    void ToAxisAngle(Float3 &axis, float &angle) const;
+
+    /**
+     * @brief Construct a Quaternion from a rotation vector (exponential map), whose direction is the rotation axis and
+     * whose length is the rotation angle in radians, e.g. a gyroscope rate multiplied by the time step.
+     * Components are as in FromAxisAngle, so {yaw, 0, 0} matches FromYawRadians(yaw). Small angles use a Taylor
+     * expansion instead of trig
+     */
+    static Quaternion FromRotationVector(Float3 rotation_vector);
+
+    /**
+     * @brief Get the rotation vector (logarithmic map) of this unit Quaternion, the inverse of FromRotationVector,
+     * taking the shorter of the two equivalent rotations so that its length is within [0, PI]
+     */
+    Float3 ToRotationVector() const;
+
+    /**
+     * @brief Split this unit Quaternion into a rotation around the given axis (twist) and a rotation around an axis
+     * perpendicular to it (swing), such that `swing * twist` equals this Quaternion. For a head with the Yaw axis
+     * {1, 0, 0} as its neck, twist is the head turn and swing the nod and tilt. The swing's w is never negative.
+     * When the rotation is a half turn around a perpendicular axis, the twist is undefined and reported as identity
+     * @param axis Float3 direction of the twist axis, see FromAxisAngle for its components; it does not need to be
+     * normalized. A zero axis reports the whole rotation as swing
+     */
+    void ToSwingTwist(Float3 axis, Quaternion &swing, Quaternion &twist) const;
+
+    /**
+     * @brief Get this unit Quaternion with its swing limited to a cone and its twist to a range, e.g. for neck or
+     * rig limits. The swing keeps its direction and the twist its axis, so a clamped rotation stays as close to the
+     * original as the limits allow, at any pitch
+     * @param axis twist axis, see ToSwingTwist
+     * @param max_swing half-angle of the swing cone in radians, within [0, PI]
+     * @param min_twist lowest twist angle around the axis in radians, within [-PI, PI]
+     * @param max_twist highest twist angle around the axis in radians, within [min_twist, PI]
+     */
+    Quaternion ClampedSwingTwist(Float3 axis, float max_swing, float min_twist, float max_twist) const;
+
+    /**
+     * @brief Construct a Quaternion rotating by the given radians around the Yaw axis only. Equivalent to
+     * FromEulerRadians({yaw, 0, 0}), but needs a single sine/cosine pair
+     */
+    static Quaternion FromYawRadians(float yaw);
+
+    /**
+     * @brief Construct a Quaternion rotating by the given radians around the Pitch axis only. Equivalent to
+     * FromEulerRadians({0, pitch, 0}), but needs a single sine/cosine pair
+     */
+    static Quaternion FromPitchRadians(float pitch);
+
+    /**
+     * @brief Construct a Quaternion rotating by the given radians around the Roll axis only. Equivalent to
+     * FromEulerRadians({0, 0, roll}), but needs a single sine/cosine pair
+     */
+    static Quaternion FromRollRadians(float roll);
+
+    /**
+     * @brief Multiply this Quaternion by a rotation of the given radians around the Yaw axis only. Equivalent to
+     * `*this *= FromYawRadians(yaw)`, using a sparse product that skips the zero components
+     */
+    void RotateYaw(float yaw);
+
+    /**
+     * @brief Multiply this Quaternion by a rotation of the given radians around the Pitch axis only. Equivalent to
+     * `*this *= FromPitchRadians(pitch)`, using a sparse product that skips the zero components
+     */
+    void RotatePitch(float pitch);
+
+    /**
+     * @brief Multiply this Quaternion by a rotation of the given radians around the Roll axis only. Equivalent to
+     * `*this *= FromRollRadians(roll)`, using a sparse product that skips the zero components
+     */
+    void RotateRoll(float roll);
+
+    /**
+     * @brief Spherically interpolate between two unit Quaternions along the shortest arc
+     * @param t interpolation factor, where 0 yields `from` and 1 yields `to` (or its antipode)
+     * @return unit Quaternion on the great arc between `from` and `to`
+     */
+    static Quaternion Slerp(Quaternion from, Quaternion to, float t);
+
+    /**
+     * @brief Spherical cubic (squad) interpolation between q1 and q2, shaped by their squad control points
+     * @param s1 control point of q1, see SquadControlPoint
+     * @param s2 control point of q2, see SquadControlPoint
+     * @param t interpolation factor, where 0 yields q1 and 1 yields q2
+     */
+    static Quaternion Squad(Quaternion q1, Quaternion q2, Quaternion s1, Quaternion s2, float t);
+
+    /**
+     * @brief Compute the squad control point of `current`, given its neighbouring keys on the curve.
+     * Neighbours are expected to lie in the same hemisphere as `current`
+     */
+    static Quaternion SquadControlPoint(Quaternion previous, Quaternion current, Quaternion next);
+
+    /**
+     * @brief Get the natural logarithm of this unit Quaternion
+     * @return pure Quaternion (w = 0), whose vector part is the rotation axis scaled by half the rotation angle
+     */
+    Quaternion Log() const;
+
+    /**
+     * @brief Get the exponential of this Quaternion, treating it as a pure Quaternion (w is ignored)
+     * @return unit Quaternion, the inverse of Log
+     */
+    Quaternion Exp() const;
+
     /**
      * @brief Construct a Euler degrees Float3 from this Quaternion
      * @return Float3, whose components are rotations in degrees around corresponding axes
@@ -38,6 +158,13 @@ public:
      */
     Float3 ToEulerRadians();
 
+    /**
+     * @brief Rotate a direction or position vector by this unit Quaternion.
+     * Vector components lie along the rotation axes of the matching Euler components: the Yaw axis (z, up), the
+     * Pitch axis (y, left) and the Roll axis (x, forward), as for FromAxisAngle
+     */
+    Float3 Rotate(Float3 vector) const;
+
     /**
      * @brief Check whether this Quaternion is equal to the given Quaternion within a margin of error
      */
@@ -77,22 +204,22 @@ public:
     /**
      * @brief Get the W
      */
-    float GetW() const;
+    constexpr float GetW() const { return m_qw; }
     
     /**
      * @brief Get the X
      */
-    float GetX() const;
+    constexpr float GetX() const { return m_qx; }
     
     /**
      * @brief Get the Y
      */
-    float GetY() const;
+    constexpr float GetY() const { return m_qy; }
 
     /**
      * @brief Get the Z value
      */
-    float GetZ() const;
+    constexpr float GetZ() const { return m_qz; }
 
     void operator*=(float scalar);
     void operator/=(float scalar);
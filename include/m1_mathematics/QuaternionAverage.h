@@ -0,0 +1,118 @@
+#ifndef M1_ORIENTATIONMANAGER_QUATERNIONAVERAGE_H
+#define M1_ORIENTATIONMANAGER_QUATERNIONAVERAGE_H
+
+#include <cstddef>
+#include <vector>
+
+#include "Quaternion.h"
+#include "QuaternionBatch.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Averaging of unit Quaternions, e.g. for smoothing noisy tracker samples
+ */
+class QuaternionAverage {
+public:
+    /**
+     * @brief Number of unique entries in the symmetric 4x4 second-moment matrix, sum(weight * q * q^T), stored
+     * row by row from the upper triangle: ww, wx, wy, wz, xx, xy, xz, yy, yz, zz
+     */
+    static constexpr size_t MOMENT_COUNT = 10;
+
+    /**
+     * @brief Fast weighted mean: flip each sample into the hemisphere of the running sum so far, add it, and
+     * normalize the total.
+     * Accurate while samples are clustered within a few tens of degrees of each other
+     * @param weights one weight per sample, or nullptr for equal weights
+     */
+    static Quaternion LinearMean(const QuaternionBatch &samples, const float *weights = nullptr);
+
+    /**
+     * @brief Weighted mean of Markley et al., the dominant eigenvector of the samples' second-moment matrix.
+     * Insensitive to sample signs and accurate for widely spread samples, at the cost of a 4x4 eigen solve
+     * @param weights one weight per sample, or nullptr for equal weights
+     */
+    static Quaternion MarkleyMean(const QuaternionBatch &samples, const float *weights = nullptr);
+
+    /**
+     * @brief Markley mean from an already accumulated second-moment matrix, see MOMENT_COUNT for its layout
+     */
+    static Quaternion FromMoments(const double *moments);
+
+    /**
+     * @brief Mean that ignores outliers: samples more than `max_angle` radians from the current mean are rejected
+     * and the mean recomputed, until no sample changes between inlier and outlier (or after at most 8 rounds)
+     * @param inlier_count optional output of how many samples contributed to the result; 0 when no sample lies
+     * within `max_angle` of the mean being refined, in which case that mean is returned unchanged
+     */
+    static Quaternion RobustMean(const QuaternionBatch &samples, float max_angle, size_t *inlier_count = nullptr);
+};
+
+/**
+ * @brief Moving average over the last `window_size` samples of many independent tracks.
+ *
+ * Running sums of the sign-aligned samples and of their second moments are kept per track, so pushing a sample and
+ * reading either mean are O(1) regardless of the window size. Sums are rebuilt from the window once per window length
+ * to stop floating point error from accumulating.
+ */
+class SlidingQuaternionAverage {
+public:
+    SlidingQuaternionAverage(size_t track_count, size_t window_size);
+
+    size_t GetTrackCount() const;
+    size_t GetWindowSize() const;
+
+    /**
+     * @brief Get the number of samples currently in the given track's window
+     */
+    size_t GetSampleCount(size_t track) const;
+
+    /**
+     * @brief Add a sample to the given track, evicting its oldest sample once the window is full
+     */
+    void Push(size_t track, Quaternion sample);
+
+    /**
+     * @brief Add one sample per track, where `samples` holds GetTrackCount() Quaternions
+     */
+    void Push(const QuaternionBatch &samples);
+
+    /**
+     * @brief Get the sign-aligned linear mean of the given track's window, or identity if it is empty
+     */
+    Quaternion GetLinearMean(size_t track) const;
+
+    /**
+     * @brief Get the Markley mean of the given track's window, or identity if it is empty
+     */
+    Quaternion GetMarkleyMean(size_t track) const;
+
+    /**
+     * @brief Write the linear mean of every track into the given batch
+     */
+    void GetLinearMeans(QuaternionBatch &output) const;
+
+    /**
+     * @brief Empty every track's window
+     */
+    void Reset();
+
+private:
+    void Rebuild(size_t track);
+
+    size_t m_trackCount;
+    size_t m_windowSize;
+
+    QuaternionBatch m_window;
+    std::vector<size_t> m_head;
+    std::vector<size_t> m_count;
+    std::vector<size_t> m_pushesSinceRebuild;
+
+    std::vector<double> m_sums;
+    std::vector<double> m_moments;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_QUATERNIONAVERAGE_H
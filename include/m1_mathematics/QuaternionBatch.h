@@ -0,0 +1,103 @@
+#ifndef M1_ORIENTATIONMANAGER_QUATERNIONBATCH_H
+#define M1_ORIENTATIONMANAGER_QUATERNIONBATCH_H
+
+#include <cstddef>
+#include <vector>
+
+#include "AlignedAllocator.h"
+#include "Float3Batch.h"
+#include "Quaternion.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Structure-of-arrays storage for many Quaternions, keeping each component in its own contiguous array
+ * so that batch kernels can stream through them with straight, vectorizable loops. Each array is cache-line aligned
+ */
+class QuaternionBatch {
+public:
+    QuaternionBatch();
+    explicit QuaternionBatch(size_t size);
+
+    /**
+     * @brief Get the number of Quaternions held by this batch
+     */
+    size_t Size() const;
+
+    /**
+     * @brief Resize this batch, filling any new entries with the identity Quaternion
+     */
+    void Resize(size_t size);
+
+    /**
+     * @brief Reserve storage for the given number of Quaternions, so that growing up to it does not allocate
+     */
+    void Reserve(size_t capacity);
+
+    /**
+     * @brief Gather the Quaternion stored at the given index
+     */
+    Quaternion Get(size_t index) const;
+
+    /**
+     * @brief Scatter the given Quaternion into the given index
+     */
+    void Set(size_t index, Quaternion quaternion);
+
+    /**
+     * @brief Replace the contents of this batch with the Quaternions of the given rotation vectors
+     * @see Quaternion::FromRotationVector
+     */
+    void FromRotationVectors(const Float3Batch &rotation_vectors);
+
+    /**
+     * @brief Write the rotation vector of every Quaternion into `output`, resizing it to match
+     * @see Quaternion::ToRotationVector
+     */
+    void ToRotationVectors(Float3Batch &output) const;
+
+    /**
+     * @brief Replace the contents of this batch with rotations of `angles[i]` radians around `axes[i]`
+     * @see Quaternion::FromAxisAngle
+     */
+    void FromAxisAngles(const Float3Batch &axes, const float *angles);
+
+    /**
+     * @brief Write the rotation axis of every Quaternion into `axes`, resizing it to match, and its angle into `angles`
+     * @see Quaternion::ToAxisAngle
+     */
+    void ToAxisAngles(Float3Batch &axes, float *angles) const;
+
+    /**
+     * @brief Split every Quaternion into a swing and a twist around the given axis, resizing both outputs to match
+     * @see Quaternion::ToSwingTwist
+     */
+    void ToSwingTwists(Float3 axis, QuaternionBatch &swings, QuaternionBatch &twists) const;
+
+    /**
+     * @brief Limit the swing and twist of every Quaternion in place. The sines and cosines of the limits are taken
+     * once for the whole batch, so each Quaternion costs a few multiplies and square roots
+     * @see Quaternion::ClampedSwingTwist
+     */
+    void ClampSwingTwist(Float3 axis, float max_swing, float min_twist, float max_twist);
+
+    float *W();
+    float *X();
+    float *Y();
+    float *Z();
+
+    const float *W() const;
+    const float *X() const;
+    const float *Y() const;
+    const float *Z() const;
+
+private:
+    std::vector<float, AlignedAllocator<float>> m_qw;
+    std::vector<float, AlignedAllocator<float>> m_qx;
+    std::vector<float, AlignedAllocator<float>> m_qy;
+    std::vector<float, AlignedAllocator<float>> m_qz;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_QUATERNIONBATCH_H
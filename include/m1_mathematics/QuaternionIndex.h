@@ -0,0 +1,79 @@
+#ifndef M1_ORIENTATIONMANAGER_QUATERNIONINDEX_H
+#define M1_ORIENTATIONMANAGER_QUATERNIONINDEX_H
+
+#include <cstddef>
+#include <vector>
+
+#include "Quaternion.h"
+#include "QuaternionBatch.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Nearest-orientation search over a fixed set of unit Quaternions (e.g. measured HRTF directions).
+ *
+ * Distances are rotation angles, so q and -q are treated as the same orientation. Stored Quaternions are folded into
+ * the w >= 0 hemisphere and arranged as an implicit k-d tree in 4D; queries search for both the query and its antipode
+ * at once. Sets no larger than BRUTE_FORCE_THRESHOLD skip the tree: all their distances are computed in one
+ * vectorizable pass, and the matches are then selected from those.
+ */
+class QuaternionIndex {
+public:
+    static constexpr size_t BRUTE_FORCE_THRESHOLD = 64;
+
+    struct Match {
+        /** Position of the matched Quaternion in the set passed to Build */
+        size_t index;
+        /** Rotation angle in radians between the query and the matched Quaternion */
+        float angle;
+    };
+
+    QuaternionIndex();
+
+    /**
+     * @brief Replace the indexed set with the given unit Quaternions
+     */
+    void Build(const QuaternionBatch &orientations);
+
+    /**
+     * @brief Get the number of indexed Quaternions
+     */
+    size_t Size() const;
+
+    /**
+     * @brief Find the indexed Quaternion closest in rotation angle to the query.
+     * With an empty index, the returned match has an index of Size() and an angle of infinity
+     */
+    Match FindNearest(Quaternion query) const;
+
+    /**
+     * @brief Find up to k indexed Quaternions closest to the query, sorted by increasing angle
+     * @param results caller-provided storage for at least k matches
+     * @return number of matches written, which is min(k, Size())
+     */
+    size_t FindKNearest(Quaternion query, size_t k, Match *results) const;
+
+    /**
+     * @brief Find every indexed Quaternion within the given rotation angle of the query, sorted by increasing angle
+     * @param results cleared, then filled with the matches; reserve it up front to avoid allocation
+     */
+    void FindWithinAngle(Quaternion query, float max_angle, std::vector<Match> &results) const;
+
+private:
+    struct Query;
+
+    const float *AxisData(int axis) const;
+    void BuildNode(size_t begin, size_t end);
+    void Scan(Query &query) const;
+    void Search(Query &query, size_t begin, size_t end) const;
+    void Visit(Query &query, size_t slot) const;
+    void Consider(Query &query, size_t slot, float distance) const;
+
+    QuaternionBatch m_points;
+    std::vector<size_t> m_sourceIndex;
+    std::vector<unsigned char> m_splitAxis;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_QUATERNIONINDEX_H
@@ -0,0 +1,72 @@
+#ifndef M1_ORIENTATIONMANAGER_QUATERNIONSPLINE_H
+#define M1_ORIENTATIONMANAGER_QUATERNIONSPLINE_H
+
+#include <cstddef>
+#include <vector>
+
+#include "Quaternion.h"
+#include "QuaternionBatch.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Smooth rotation curve through timestamped keyframes, evaluated with squad interpolation.
+ *
+ * Squad control points and the arc angles of every segment are cached when keyframes are added, so evaluation only
+ * needs the final blend. A cursor remembers the last evaluated segment, making sequential (playback-order) queries
+ * amortized O(1); random access falls back to a binary search.
+ */
+class QuaternionSpline {
+public:
+    QuaternionSpline();
+
+    /**
+     * @brief Append a keyframe to the end of the curve
+     * @return false if the keyframe was rejected, because its time is not later than the last keyframe's
+     */
+    bool AddKeyframe(double time, Quaternion rotation);
+
+    /**
+     * @brief Remove all keyframes
+     */
+    void Clear();
+
+    size_t GetKeyframeCount() const;
+    double GetStartTime() const;
+    double GetEndTime() const;
+
+    /**
+     * @brief Get the rotation of the curve at the given time. Before the first or after the last keyframe,
+     * that keyframe's rotation is held. With no keyframes, the identity Quaternion is returned
+     */
+    Quaternion Evaluate(double time);
+
+    /**
+     * @brief Evaluate `count` evenly spaced times, starting at `start_time`, into the given batch
+     */
+    void EvaluateRange(double start_time, double time_step, size_t count, QuaternionBatch &output);
+
+private:
+    struct Segment {
+        double startTime;
+        double inverseDuration;
+        float keyTheta;
+        float keyInverseSin;
+        float controlTheta;
+        float controlInverseSin;
+    };
+
+    size_t FindSegment(double time);
+    void UpdateControlPoint(size_t key);
+    void UpdateSegment(size_t segment);
+
+    std::vector<double> m_times;
+    std::vector<Quaternion> m_keys;
+    std::vector<Quaternion> m_controls;
+    std::vector<Segment> m_segments;
+    size_t m_cursor;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_QUATERNIONSPLINE_H
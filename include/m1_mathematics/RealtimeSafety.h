@@ -0,0 +1,81 @@
+#ifndef M1_ORIENTATIONMANAGER_REALTIMESAFETY_H
+#define M1_ORIENTATIONMANAGER_REALTIMESAFETY_H
+
+#include <cstddef>
+
+namespace Mach1 {
+
+/**
+ * @brief Verification that code meant for the audio thread neither allocates nor blocks.
+ *
+ * While a Scope is open on a thread, every allocation, lock acquisition or sleep reported from that thread counts as
+ * a violation. Reports come from the hooks in src/RealtimeSafetyHooks.cpp, which replace operator new and delete and,
+ * on glibc, interpose malloc, the pthread lock and wait functions, sem_wait and nanosleep. The hooks are linked into
+ * the library when it is built with M1_MATHEMATICS_REALTIME_CHECKS and always into the real-time safety test suite.
+ *
+ * With M1_MATHEMATICS_REALTIME_CHECKS defined, the library also marks its own entry points: M1_REALTIME_SAFE opens a
+ * Scope for the duration of a call that must be real-time safe, and M1_REALTIME_UNSAFE reports a call that is known
+ * not to be, such as ToString, when made inside a Scope. Without it both macros compile to nothing.
+ */
+class RealtimeSafety {
+public:
+    /**
+     * @brief Violations counted on the current thread since the last ResetViolations
+     */
+    struct Violations {
+        size_t allocations = 0;
+        size_t blocking_calls = 0;
+        size_t unsafe_calls = 0;
+
+        /// Name of the most recent violating call, e.g. "malloc" or "Quaternion::ToString"
+        const char *last = nullptr;
+
+        size_t Total() const {
+            return allocations + blocking_calls + unsafe_calls;
+        }
+    };
+
+    /**
+     * @brief Marks the current thread as running real-time code until destroyed. Scopes nest
+     */
+    class Scope {
+    public:
+        Scope();
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+    };
+
+    /**
+     * @brief Called on every violation inside a Scope, after it is counted; may log or abort. Allocations and locks
+     * made by the handler itself are not reported
+     */
+    using Handler = void (*)(const char *what);
+
+    static bool IsInScope();
+
+    static void ReportAllocation(const char *what);
+    static void ReportBlockingCall(const char *what);
+    static void ReportUnsafeCall(const char *what);
+
+    static Violations GetViolations();
+    static void ResetViolations();
+
+    /**
+     * @brief Set the handler shared by all threads, or nullptr to only count violations
+     */
+    static void SetHandler(Handler handler);
+};
+
+} // namespace Mach1
+
+#if defined(M1_MATHEMATICS_REALTIME_CHECKS)
+#define M1_REALTIME_SAFE ::Mach1::RealtimeSafety::Scope m1_realtime_safe_scope
+#define M1_REALTIME_UNSAFE(what) ::Mach1::RealtimeSafety::ReportUnsafeCall(what)
+#else
+#define M1_REALTIME_SAFE static_cast<void>(0)
+#define M1_REALTIME_UNSAFE(what) static_cast<void>(0)
+#endif
+
+#endif //M1_ORIENTATIONMANAGER_REALTIMESAFETY_H
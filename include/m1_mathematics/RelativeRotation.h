@@ -0,0 +1,42 @@
+#ifndef M1_ORIENTATIONMANAGER_RELATIVEROTATION_H
+#define M1_ORIENTATIONMANAGER_RELATIVEROTATION_H
+
+#include <cstddef>
+
+#include "QuaternionBatch.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Every listener's view of every object, `listener.Inversed() * object`, for N listeners by M objects.
+ *
+ * Output is listener-major: the rotation of object o relative to listener l is at index l * M + o, so each
+ * listener's row is contiguous. Objects are processed in tiles small enough to stay in L1 cache while every listener
+ * passes over them, and the inner loop over a tile is a straight SoA loop that vectorizes.
+ */
+class RelativeRotation {
+public:
+    /**
+     * @brief Objects per tile: four component arrays of this many floats take 4 KiB
+     */
+    static constexpr size_t TILE_SIZE = 256;
+
+    /**
+     * @brief Compute the full N x M product into `output`, resizing it to N * M. With thread_count above one, the
+     * objects are split into that many contiguous ranges, each computed on its own thread for this call; callers with
+     * their own job system can instead call ComputeRange from it
+     */
+    static void Compute(const QuaternionBatch &listeners, const QuaternionBatch &objects, QuaternionBatch &output,
+                        unsigned thread_count = 1);
+
+    /**
+     * @brief Compute the columns of objects [first_object, first_object + object_count) for every listener into an
+     * output already sized to listeners.Size() * objects.Size(). Calls on disjoint ranges may run concurrently
+     */
+    static void ComputeRange(const QuaternionBatch &listeners, const QuaternionBatch &objects, QuaternionBatch &output,
+                             size_t first_object, size_t object_count);
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_RELATIVEROTATION_H
@@ -0,0 +1,120 @@
+#ifndef M1_ORIENTATIONMANAGER_SOURCECULLER_H
+#define M1_ORIENTATIONMANAGER_SOURCECULLER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "AlignedAllocator.h"
+#include "Float3Batch.h"
+#include "Orientation.h"
+#include "Quaternion.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Ranks sources by their angular offset from the listener's forward axis, so a renderer can spend its budget
+ * on what the listener faces and drop or simplify the rest.
+ *
+ * Priority buckets are bounded by ascending angles: bucket 0 holds sources within the first angle of the forward
+ * axis, bucket 1 those within the second, and so on. Sources beyond the last angle are culled. Classification
+ * compares the cosine of each source's offset against the cosines of the bucket angles. That takes one dot product
+ * and one square root and division per source, in straight loops the compiler can vectorize, and no trigonometry.
+ *
+ * Directions follow the vector convention of Quaternion::Rotate: components along the up (yaw), left (pitch) and
+ * forward (roll) axes. They need not be normalized. A zero-length direction counts as straight ahead.
+ * Buffers grow to the largest source count seen, after which classifying and selecting do not allocate.
+ */
+class SourceCuller {
+public:
+    /**
+     * @brief Construct with buckets at 30, 60, 110 and 180 degrees, which culls nothing
+     */
+    SourceCuller();
+
+    /**
+     * @param bucket_edges_radians ascending upper angle of each bucket, at most 255 of them
+     */
+    explicit SourceCuller(std::vector<float> bucket_edges_radians);
+
+    /**
+     * @brief Replace the bucket angles; takes effect on the next classification
+     */
+    void SetBucketEdges(std::vector<float> bucket_edges_radians);
+
+    const std::vector<float> &GetBucketEdges() const;
+    size_t GetBucketCount() const;
+
+    /**
+     * @brief Set the listener from its global rotation
+     */
+    void SetListener(Quaternion global_rotation);
+
+    /**
+     * @brief Set the listener from its Orientation's global rotation
+     */
+    void SetListener(const Orientation &listener);
+
+    /**
+     * @brief Classify every direction of the batch into a priority bucket
+     * @return number of sources not culled
+     */
+    size_t Classify(const Float3Batch &source_directions);
+
+    /**
+     * @brief Classify SoA direction components, one value per source
+     * @return number of sources not culled
+     */
+    size_t Classify(const float *yaw, const float *pitch, const float *roll, size_t count);
+
+    /**
+     * @brief Get the indices of the sources that were not culled, grouped by bucket with the highest priority
+     * first and in ascending order within each bucket
+     */
+    const std::vector<uint32_t> &GetSortedIndices() const;
+
+    /**
+     * @brief Get where a bucket starts in GetSortedIndices(); the bucket ends where the next one starts
+     */
+    size_t GetBucketBegin(size_t bucket) const;
+    size_t GetBucketEnd(size_t bucket) const;
+
+    /**
+     * @brief Get the bucket of a source, or GetBucketCount() if it was culled
+     */
+    size_t GetBucket(size_t source) const;
+
+    /**
+     * @brief Get the cosine of each source's angular offset from the listener's forward axis
+     */
+    const float *GetCosines() const;
+
+    /**
+     * @brief Get the angular offset of a source from the listener's forward axis, in radians within [0, PI]
+     */
+    float GetAngularOffset(size_t source) const;
+
+    /**
+     * @brief Choose at most `budget` sources of the last classification, highest priority first. Whole buckets are
+     * taken in order; the bucket that does not fit contributes its sources closest to the forward axis
+     * @return the chosen source indices, valid until the next call
+     */
+    const std::vector<uint32_t> &Select(size_t budget);
+
+private:
+    using AlignedFloats = std::vector<float, AlignedAllocator<float>>;
+
+    std::vector<float> m_bucket_edges;
+    std::vector<float> m_bucket_cosines;
+    float m_forward[3];
+
+    AlignedFloats m_cosines;
+    std::vector<uint8_t, AlignedAllocator<uint8_t>> m_buckets;
+    std::vector<size_t> m_bucket_offsets;
+    std::vector<uint32_t> m_sorted_indices;
+    std::vector<uint32_t> m_selected;
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_SOURCECULLER_H
@@ -0,0 +1,125 @@
+#ifndef M1_ORIENTATIONMANAGER_STATICROTATION_H
+#define M1_ORIENTATIONMANAGER_STATICROTATION_H
+
+#include <array>
+#include <cstddef>
+
+#include "Float3.h"
+#include "MathUtility.h"
+#include "Quaternion.h"
+
+namespace Mach1 {
+
+/**
+ * @brief Constant Euler angles in degrees, in the Yaw, Pitch, Roll order of Euler Float3s, for compile-time tables
+ */
+struct EulerAngles {
+    float yaw = 0.0f;
+    float pitch = 0.0f;
+    float roll = 0.0f;
+};
+
+/**
+ * @brief 3x3 rotation matrix with rows and columns in (x, y, z) = (forward, left, up) order, the axes of the
+ * Quaternion x, y and z components. Multiplying a column vector applies the rotation
+ */
+struct RotationMatrix {
+    float m[3][3] = {};
+
+    /**
+     * @brief Rotate a direction or position vector, with components along the up (yaw), left (pitch) and forward
+     * (roll) axes as for Quaternion::Rotate
+     */
+    Float3 Rotate(Float3 vector) const;
+};
+
+/**
+ * @brief Compile-time rotation construction for fixed speaker layouts and mounting offsets.
+ *
+ * Everything here is constexpr, so a table such as
+ * @code
+ * constexpr EulerAngles LAYOUT[] = {{45, 0, 0}, {-45, 0, 0}, {135, 0, 0}, {-135, 0, 0}};
+ * constexpr auto ROTATIONS = StaticRotation::FromEulerDegrees(LAYOUT);
+ * @endcode
+ * is computed by the compiler and placed in read-only memory. Values agree with Quaternion::FromEulerDegrees to
+ * float precision, as the half-angle sines and cosines are evaluated in double.
+ */
+class StaticRotation {
+public:
+    static constexpr Quaternion FromEulerRadians(float yaw, float pitch, float roll) {
+        double cos_yaw = MathUtility::ConstexprCos(0.5 * yaw);
+        double sin_yaw = MathUtility::ConstexprSin(0.5 * yaw);
+        double cos_pitch = MathUtility::ConstexprCos(0.5 * pitch);
+        double sin_pitch = MathUtility::ConstexprSin(0.5 * pitch);
+        double cos_roll = MathUtility::ConstexprCos(0.5 * roll);
+        double sin_roll = MathUtility::ConstexprSin(0.5 * roll);
+
+        // Quaternion components computed in Yaw-Pitch-Roll order (Z-Y-X), as Quaternion::FromEulerRadians
+        return {static_cast<float>(cos_yaw * cos_pitch * cos_roll + sin_yaw * sin_pitch * sin_roll),
+                static_cast<float>(cos_yaw * cos_pitch * sin_roll - sin_yaw * sin_pitch * cos_roll),
+                static_cast<float>(cos_yaw * sin_pitch * cos_roll + sin_yaw * cos_pitch * sin_roll),
+                static_cast<float>(sin_yaw * cos_pitch * cos_roll - cos_yaw * sin_pitch * sin_roll)};
+    }
+
+    static constexpr Quaternion FromEulerDegrees(float yaw, float pitch, float roll) {
+        constexpr double degrees_to_radians = 3.14159265358979323846 / 180.0;
+        return FromEulerRadians(static_cast<float>(yaw * degrees_to_radians),
+                                static_cast<float>(pitch * degrees_to_radians),
+                                static_cast<float>(roll * degrees_to_radians));
+    }
+
+    static constexpr Quaternion FromEulerDegrees(EulerAngles angles) {
+        return FromEulerDegrees(angles.yaw, angles.pitch, angles.roll);
+    }
+
+    /**
+     * @brief Get the rotation matrix of a unit Quaternion
+     */
+    static constexpr RotationMatrix ToRotationMatrix(Quaternion quaternion) {
+        float w = quaternion.GetW(), x = quaternion.GetX(), y = quaternion.GetY(), z = quaternion.GetZ();
+
+        RotationMatrix matrix;
+        matrix.m[0][0] = 1.0f - 2.0f * (y * y + z * z);
+        matrix.m[0][1] = 2.0f * (x * y - w * z);
+        matrix.m[0][2] = 2.0f * (x * z + w * y);
+        matrix.m[1][0] = 2.0f * (x * y + w * z);
+        matrix.m[1][1] = 1.0f - 2.0f * (x * x + z * z);
+        matrix.m[1][2] = 2.0f * (y * z - w * x);
+        matrix.m[2][0] = 2.0f * (x * z - w * y);
+        matrix.m[2][1] = 2.0f * (y * z + w * x);
+        matrix.m[2][2] = 1.0f - 2.0f * (x * x + y * y);
+        return matrix;
+    }
+
+    static constexpr RotationMatrix MatrixFromEulerDegrees(EulerAngles angles) {
+        return ToRotationMatrix(FromEulerDegrees(angles));
+    }
+
+    /**
+     * @brief Build a table of Quaternions, one per entry of `angles`
+     */
+    template<size_t N>
+    static constexpr std::array<Quaternion, N> FromEulerDegrees(const EulerAngles (&angles)[N]) {
+        std::array<Quaternion, N> table{};
+        for (size_t i = 0; i < N; i++) {
+            table[i] = FromEulerDegrees(angles[i]);
+        }
+        return table;
+    }
+
+    /**
+     * @brief Build a table of rotation matrices, one per entry of `angles`
+     */
+    template<size_t N>
+    static constexpr std::array<RotationMatrix, N> MatricesFromEulerDegrees(const EulerAngles (&angles)[N]) {
+        std::array<RotationMatrix, N> table{};
+        for (size_t i = 0; i < N; i++) {
+            table[i] = MatrixFromEulerDegrees(angles[i]);
+        }
+        return table;
+    }
+};
+
+} // namespace Mach1
+
+#endif //M1_ORIENTATIONMANAGER_STATICROTATION_H
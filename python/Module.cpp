@@ -0,0 +1,351 @@
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <pybind11/numpy.h>
+#include <pybind11/operators.h>
+#include <pybind11/pybind11.h>
+
+#include "m1_mathematics/DualQuaternion.h"
+#include "m1_mathematics/Float3.h"
+#include "m1_mathematics/ListenerTransform.h"
+#include "m1_mathematics/Orientation.h"
+#include "m1_mathematics/Quaternion.h"
+
+namespace py = pybind11;
+using namespace Mach1;
+
+namespace {
+
+// Inputs are read in place when they already are C-contiguous float32, and converted once otherwise
+using InputArray = py::array_t<float, py::array::c_style | py::array::forcecast>;
+// Outputs are written in place, so they must already be C-contiguous float32
+using OutputArray = py::array_t<float, py::array::c_style>;
+
+/**
+ * Number of rows of an (N, columns) array, or 1 for a single row given as a (columns,) array
+ */
+py::ssize_t RowCount(const InputArray &array, py::ssize_t columns, const char *name) {
+    if (array.ndim() == 1 && array.shape(0) == columns) {
+        return 1;
+    }
+    if (array.ndim() != 2 || array.shape(1) != columns) {
+        throw std::invalid_argument(std::string(name) + " must have shape (N, " + std::to_string(columns) + ")");
+    }
+    return array.shape(0);
+}
+
+/**
+ * Row stride of an input that may be a single row broadcast against N rows
+ */
+py::ssize_t BroadcastStride(py::ssize_t rows, py::ssize_t expected_rows, py::ssize_t columns, const char *name) {
+    if (rows == expected_rows) {
+        return columns;
+    }
+    if (rows == 1) {
+        return 0;
+    }
+    throw std::invalid_argument(std::string(name) + " must have " + std::to_string(expected_rows) + " rows or one");
+}
+
+/**
+ * Use the caller's output array when given, checking its shape, or allocate a new one
+ */
+OutputArray PrepareOutput(const py::object &out, py::ssize_t rows, py::ssize_t columns) {
+    if (out.is_none()) {
+        return OutputArray(std::vector<py::ssize_t>{rows, columns});
+    }
+
+    // A cast that had to convert would write into a temporary copy instead of the caller's array, and one that cannot
+    // convert at all (e.g. from float64) throws cast_error; both are the same mistake to the caller
+    OutputArray array;
+    try {
+        array = out.cast<OutputArray>();
+    } catch (const py::cast_error &) {
+        throw std::invalid_argument("out must be a C-contiguous float32 array");
+    }
+    if (array.ptr() != out.ptr()) {
+        throw std::invalid_argument("out must be a C-contiguous float32 array");
+    }
+    if (array.ndim() != 2 || array.shape(0) != rows || array.shape(1) != columns) {
+        throw std::invalid_argument("out must have shape (" + std::to_string(rows) + ", " + std::to_string(columns) + ")");
+    }
+    return array;
+}
+
+// Rows are (w, x, y, z) for Quaternions and (yaw, pitch, roll) for Float3s
+Quaternion LoadQuaternion(const float *row) {
+    return {row[0], row[1], row[2], row[3]};
+}
+
+void StoreQuaternion(Quaternion quaternion, float *row) {
+    row[0] = quaternion.GetW();
+    row[1] = quaternion.GetX();
+    row[2] = quaternion.GetY();
+    row[3] = quaternion.GetZ();
+}
+
+Float3 LoadFloat3(const float *row) {
+    return {row[0], row[1], row[2]};
+}
+
+void StoreFloat3(Float3 value, float *row) {
+    row[0] = value.GetYaw();
+    row[1] = value.GetPitch();
+    row[2] = value.GetRoll();
+}
+
+OutputArray EulerToQuaternions(const InputArray &euler, const py::object &out, bool degrees) {
+    py::ssize_t count = RowCount(euler, 3, "euler");
+    OutputArray output = PrepareOutput(out, count, 4);
+    const float *input_data = euler.data();
+    float *output_data = output.mutable_data();
+
+    {
+        py::gil_scoped_release release;
+        for (py::ssize_t i = 0; i < count; i++) {
+            Float3 angles = LoadFloat3(input_data + i * 3);
+            StoreQuaternion(degrees ? Quaternion::FromEulerDegrees(angles) : Quaternion::FromEulerRadians(angles),
+                            output_data + i * 4);
+        }
+    }
+    return output;
+}
+
+OutputArray QuaternionsToEuler(const InputArray &quaternions, const py::object &out, bool degrees) {
+    py::ssize_t count = RowCount(quaternions, 4, "quaternions");
+    OutputArray output = PrepareOutput(out, count, 3);
+    const float *input_data = quaternions.data();
+    float *output_data = output.mutable_data();
+
+    {
+        py::gil_scoped_release release;
+        for (py::ssize_t i = 0; i < count; i++) {
+            Quaternion quaternion = LoadQuaternion(input_data + i * 4);
+            StoreFloat3(degrees ? quaternion.ToEulerDegrees() : quaternion.ToEulerRadians(), output_data + i * 3);
+        }
+    }
+    return output;
+}
+
+} // namespace
+
+PYBIND11_MODULE(m1_mathematics, m) {
+    m.doc() = "Mach1 orientation mathematics: Float3, Quaternion, Orientation and NumPy batch operations";
+
+    py::class_<Float3>(m, "Float3")
+            .def(py::init<>())
+            .def(py::init<float>(), py::arg("component"))
+            .def(py::init<float, float, float>(), py::arg("yaw"), py::arg("pitch"), py::arg("roll"))
+            .def_property_readonly("yaw", &Float3::GetYaw)
+            .def_property_readonly("pitch", &Float3::GetPitch)
+            .def_property_readonly("roll", &Float3::GetRoll)
+            .def("length", &Float3::Length)
+            .def("normalized", &Float3::Normalized)
+            .def("euler_degrees", &Float3::EulerDegrees)
+            .def("euler_radians", &Float3::EulerRadians)
+            .def("clamped", &Float3::Clamped, py::arg("min"), py::arg("max"))
+            .def("wrapped", &Float3::Wrapped, py::arg("min"), py::arg("max"))
+            .def("is_approximately_equal", &Float3::IsApproximatelyEqual, py::arg("other"))
+            .def("__getitem__", [](const Float3 &self, int axis) {
+                if (axis < 0 || axis > 2) {
+                    throw py::index_error();
+                }
+                return self[axis];
+            })
+            .def("__repr__", &Float3::ToString)
+            .def(py::self == py::self)
+            .def(py::self != py::self)
+            .def(py::self + py::self)
+            .def(py::self - py::self)
+            .def(py::self * py::self)
+            .def(py::self / py::self)
+            .def(py::self * float())
+            .def(py::self / float());
+
+    py::class_<Quaternion>(m, "Quaternion")
+            .def(py::init<>())
+            .def(py::init<float, float, float, float>(), py::arg("w"), py::arg("x"), py::arg("y"), py::arg("z"))
+            .def_static("from_euler_degrees", &Quaternion::FromEulerDegrees, py::arg("euler_degrees"))
+            .def_static("from_euler_radians", &Quaternion::FromEulerRadians, py::arg("euler_radians"))
+            .def_static("from_axis_angle", &Quaternion::FromAxisAngle, py::arg("axis"), py::arg("angle"))
+            .def_static("from_rotation_vector", &Quaternion::FromRotationVector, py::arg("rotation_vector"))
+            .def_static("slerp", &Quaternion::Slerp, py::arg("start"), py::arg("end"), py::arg("t"))
+            .def_property_readonly("w", &Quaternion::GetW)
+            .def_property_readonly("x", &Quaternion::GetX)
+            .def_property_readonly("y", &Quaternion::GetY)
+            .def_property_readonly("z", &Quaternion::GetZ)
+            .def("to_euler_degrees", [](Quaternion self) { return self.ToEulerDegrees(); })
+            .def("to_euler_radians", [](Quaternion self) { return self.ToEulerRadians(); })
+            .def("to_rotation_vector", &Quaternion::ToRotationVector)
+            .def("rotate", &Quaternion::Rotate, py::arg("vector"))
+            .def("dot", &Quaternion::DotProduct, py::arg("other"))
+            .def("length", &Quaternion::Length)
+            .def("normalized", &Quaternion::Normalized)
+            .def("inversed", &Quaternion::Inversed)
+            .def("is_approximately_equal", &Quaternion::IsApproximatelyEqual, py::arg("other"))
+            .def("__repr__", &Quaternion::ToString)
+            .def(py::self == py::self)
+            .def(py::self != py::self)
+            .def(py::self * py::self)
+            .def(py::self + py::self)
+            .def(py::self - py::self)
+            .def(py::self * float());
+
+    py::class_<Orientation>(m, "Orientation")
+            .def(py::init<>())
+            .def("get_global_rotation_as_quaternion", &Orientation::GetGlobalRotationAsQuaternion)
+            .def("get_global_rotation_as_euler_degrees", &Orientation::GetGlobalRotationAsEulerDegrees)
+            .def("get_global_rotation_as_euler_radians", &Orientation::GetGlobalRotationAsEulerRadians)
+            .def("apply_rotation", py::overload_cast<Quaternion>(&Orientation::ApplyRotation), py::arg("quaternion"))
+            .def("apply_rotation_radians", py::overload_cast<Float3>(&Orientation::ApplyRotation), py::arg("euler_radians"))
+            .def("apply_rotation_degrees", &Orientation::ApplyRotationDegrees, py::arg("euler_degrees"))
+            .def("set_rotation", py::overload_cast<Quaternion>(&Orientation::SetRotation), py::arg("quaternion"))
+            .def("set_global_rotation", py::overload_cast<Quaternion>(&Orientation::SetGlobalRotation), py::arg("quaternion"))
+            .def("recenter", &Orientation::Recenter)
+            .def("reset", &Orientation::Reset);
+
+    py::class_<DualQuaternion>(m, "DualQuaternion")
+            .def(py::init<>())
+            .def_static("from_rotation_translation", &DualQuaternion::FromRotationTranslation,
+                        py::arg("rotation"), py::arg("translation"))
+            .def_static("sclerp", &DualQuaternion::Sclerp, py::arg("start"), py::arg("end"), py::arg("t"))
+            .def("get_rotation", &DualQuaternion::GetRotation)
+            .def("get_translation", &DualQuaternion::GetTranslation)
+            .def("inversed", &DualQuaternion::Inversed)
+            .def("normalized", &DualQuaternion::Normalized)
+            .def("transform_point", &DualQuaternion::TransformPoint, py::arg("point"))
+            .def("__repr__", &DualQuaternion::ToString)
+            .def(py::self * py::self);
+
+    // ===== Batch operations =====
+    // Quaternion arrays have shape (N, 4) in (w, x, y, z) order, Float3 arrays (N, 3) in (yaw, pitch, roll) order.
+    // Every function reads its inputs in place and optionally writes into a caller-provided `out` array. The stateless
+    // ones run their loop without holding the GIL, so batches can be processed from several Python threads at once
+
+    m.def("euler_degrees_to_quaternions", [](const InputArray &euler, const py::object &out) {
+        return EulerToQuaternions(euler, out, true);
+    }, py::arg("euler"), py::arg("out") = py::none());
+
+    m.def("euler_radians_to_quaternions", [](const InputArray &euler, const py::object &out) {
+        return EulerToQuaternions(euler, out, false);
+    }, py::arg("euler"), py::arg("out") = py::none());
+
+    m.def("quaternions_to_euler_degrees", [](const InputArray &quaternions, const py::object &out) {
+        return QuaternionsToEuler(quaternions, out, true);
+    }, py::arg("quaternions"), py::arg("out") = py::none());
+
+    m.def("quaternions_to_euler_radians", [](const InputArray &quaternions, const py::object &out) {
+        return QuaternionsToEuler(quaternions, out, false);
+    }, py::arg("quaternions"), py::arg("out") = py::none());
+
+    m.def("multiply_quaternions", [](const InputArray &lhs, const InputArray &rhs, const py::object &out) {
+        py::ssize_t lhs_count = RowCount(lhs, 4, "lhs");
+        py::ssize_t rhs_count = RowCount(rhs, 4, "rhs");
+        py::ssize_t count = lhs_count > rhs_count ? lhs_count : rhs_count;
+        py::ssize_t lhs_stride = BroadcastStride(lhs_count, count, 4, "lhs");
+        py::ssize_t rhs_stride = BroadcastStride(rhs_count, count, 4, "rhs");
+
+        OutputArray output = PrepareOutput(out, count, 4);
+        const float *lhs_data = lhs.data();
+        const float *rhs_data = rhs.data();
+        float *output_data = output.mutable_data();
+
+        {
+            py::gil_scoped_release release;
+            for (py::ssize_t i = 0; i < count; i++) {
+                Quaternion product = LoadQuaternion(lhs_data + i * lhs_stride) * LoadQuaternion(rhs_data + i * rhs_stride);
+                StoreQuaternion(product, output_data + i * 4);
+            }
+        }
+        return output;
+    }, "Hamilton product of each pair of rows; either side may be a single Quaternion",
+       py::arg("lhs"), py::arg("rhs"), py::arg("out") = py::none());
+
+    m.def("slerp_quaternions", [](const InputArray &start, const InputArray &end, const InputArray &t,
+                                  const py::object &out) {
+        py::ssize_t count = RowCount(start, 4, "start");
+        if (RowCount(end, 4, "end") != count) {
+            throw std::invalid_argument("start and end must have the same number of rows");
+        }
+        if (t.ndim() != 1 || (t.shape(0) != count && t.shape(0) != 1)) {
+            throw std::invalid_argument("t must have shape (N,) or (1,)");
+        }
+        py::ssize_t t_stride = t.shape(0) == count ? 1 : 0;
+
+        OutputArray output = PrepareOutput(out, count, 4);
+        const float *start_data = start.data();
+        const float *end_data = end.data();
+        const float *t_data = t.data();
+        float *output_data = output.mutable_data();
+
+        {
+            py::gil_scoped_release release;
+            for (py::ssize_t i = 0; i < count; i++) {
+                Quaternion result = Quaternion::Slerp(LoadQuaternion(start_data + i * 4), LoadQuaternion(end_data + i * 4),
+                                                      t_data[i * t_stride]);
+                StoreQuaternion(result, output_data + i * 4);
+            }
+        }
+        return output;
+    }, py::arg("start"), py::arg("end"), py::arg("t"), py::arg("out") = py::none());
+
+    m.def("rotate_vectors", [](const InputArray &quaternions, const InputArray &vectors, const py::object &out) {
+        py::ssize_t quaternion_count = RowCount(quaternions, 4, "quaternions");
+        py::ssize_t vector_count = RowCount(vectors, 3, "vectors");
+        py::ssize_t count = quaternion_count > vector_count ? quaternion_count : vector_count;
+        py::ssize_t quaternion_stride = BroadcastStride(quaternion_count, count, 4, "quaternions");
+        py::ssize_t vector_stride = BroadcastStride(vector_count, count, 3, "vectors");
+
+        OutputArray output = PrepareOutput(out, count, 3);
+        const float *quaternion_data = quaternions.data();
+        const float *vector_data = vectors.data();
+        float *output_data = output.mutable_data();
+
+        {
+            py::gil_scoped_release release;
+            for (py::ssize_t i = 0; i < count; i++) {
+                Float3 rotated = LoadQuaternion(quaternion_data + i * quaternion_stride).Rotate(LoadFloat3(vector_data + i * vector_stride));
+                StoreFloat3(rotated, output_data + i * 3);
+            }
+        }
+        return output;
+    }, "Rotate each vector by its Quaternion; either side may be a single row",
+       py::arg("quaternions"), py::arg("vectors"), py::arg("out") = py::none());
+
+    m.def("accumulate_rotations", [](Orientation &orientation, const InputArray &rotations, const py::object &out) {
+        py::ssize_t count = RowCount(rotations, 4, "rotations");
+        OutputArray output = PrepareOutput(out, count, 4);
+        const float *rotation_data = rotations.data();
+        float *output_data = output.mutable_data();
+
+        // The Orientation is a Python-owned object that other Python threads may use, so the GIL stays held while
+        // it is mutated
+        for (py::ssize_t i = 0; i < count; i++) {
+            orientation.ApplyRotation(LoadQuaternion(rotation_data + i * 4));
+            StoreQuaternion(orientation.GetGlobalRotationAsQuaternion(), output_data + i * 4);
+        }
+        return output;
+    }, "Apply each rotation to the Orientation in turn, recording its global rotation after every step. Holds the GIL",
+       py::arg("orientation"), py::arg("rotations"), py::arg("out") = py::none());
+
+    m.def("listener_directions", [](Quaternion listener_rotation, Float3 listener_position, const InputArray &sources,
+                                    const py::object &out) {
+        py::ssize_t count = RowCount(sources, 3, "sources");
+        OutputArray output = PrepareOutput(out, count, 3);
+        const float *source_data = sources.data();
+        float *output_data = output.mutable_data();
+
+        {
+            py::gil_scoped_release release;
+            ListenerTransform transform;
+            transform.SetListener(listener_rotation, listener_position);
+            for (py::ssize_t i = 0; i < count; i++) {
+                StoreFloat3(transform.GetDirection(LoadFloat3(source_data + i * 3)), output_data + i * 3);
+            }
+        }
+        return output;
+    }, "Azimuth, elevation and distance in radians of each source position, relative to the listener",
+       py::arg("listener_rotation"), py::arg("listener_position"), py::arg("sources"), py::arg("out") = py::none());
+}
@@ -0,0 +1,177 @@
+"""Checks the NumPy batch functions of the m1_mathematics module against its scalar API.
+
+Run through ctest with M1_MATHEMATICS_BUILD_PYTHON=ON, or directly with the built module on PYTHONPATH:
+    PYTHONPATH=<build dir> python -m pytest python/tests
+"""
+
+import math
+
+import numpy as np
+import pytest
+
+import m1_mathematics as m1
+
+TOLERANCE = 1e-5
+
+rng = np.random.default_rng(1234)
+
+
+def random_quaternions(count):
+    quaternions = rng.normal(size=(count, 4)).astype(np.float32)
+    return quaternions / np.linalg.norm(quaternions, axis=1, keepdims=True)
+
+
+def random_euler_degrees(count):
+    return rng.uniform(-170.0, 170.0, size=(count, 3)).astype(np.float32)
+
+
+def to_quaternion(row):
+    return m1.Quaternion(*(float(value) for value in row))
+
+
+def to_float3(row):
+    return m1.Float3(*(float(value) for value in row))
+
+
+def quaternion_row(quaternion):
+    return [quaternion.w, quaternion.x, quaternion.y, quaternion.z]
+
+
+def float3_row(value):
+    return [value.yaw, value.pitch, value.roll]
+
+
+def test_euler_degrees_to_quaternions():
+    euler = random_euler_degrees(32)
+    result = m1.euler_degrees_to_quaternions(euler)
+
+    assert result.shape == (32, 4)
+    assert result.dtype == np.float32
+    for row, expected in zip(result, euler):
+        np.testing.assert_allclose(row, quaternion_row(m1.Quaternion.from_euler_degrees(to_float3(expected))),
+                                   atol=TOLERANCE)
+
+
+def test_euler_radians_to_quaternions():
+    euler = np.radians(random_euler_degrees(32))
+    result = m1.euler_radians_to_quaternions(euler)
+
+    for row, expected in zip(result, euler):
+        np.testing.assert_allclose(row, quaternion_row(m1.Quaternion.from_euler_radians(to_float3(expected))),
+                                   atol=TOLERANCE)
+
+
+def test_quaternions_to_euler():
+    quaternions = random_quaternions(32)
+    degrees = m1.quaternions_to_euler_degrees(quaternions)
+    radians = m1.quaternions_to_euler_radians(quaternions)
+
+    assert degrees.shape == (32, 3)
+    for degrees_row, radians_row, quaternion in zip(degrees, radians, quaternions):
+        scalar = to_quaternion(quaternion)
+        np.testing.assert_allclose(degrees_row, float3_row(scalar.to_euler_degrees()), atol=1e-3)
+        np.testing.assert_allclose(radians_row, float3_row(scalar.to_euler_radians()), atol=TOLERANCE)
+
+
+def test_multiply_quaternions():
+    lhs = random_quaternions(16)
+    rhs = random_quaternions(16)
+    result = m1.multiply_quaternions(lhs, rhs)
+
+    for row, a, b in zip(result, lhs, rhs):
+        np.testing.assert_allclose(row, quaternion_row(to_quaternion(a) * to_quaternion(b)), atol=TOLERANCE)
+
+    # A single Quaternion on either side is broadcast against every row of the other
+    single = m1.multiply_quaternions(lhs[0], rhs)
+    assert single.shape == (16, 4)
+    for row, b in zip(single, rhs):
+        np.testing.assert_allclose(row, quaternion_row(to_quaternion(lhs[0]) * to_quaternion(b)), atol=TOLERANCE)
+
+    with pytest.raises(ValueError):
+        m1.multiply_quaternions(lhs, rhs[:3])
+
+
+def test_slerp_quaternions():
+    start = random_quaternions(16)
+    end = random_quaternions(16)
+    t = rng.uniform(0.0, 1.0, size=16).astype(np.float32)
+    result = m1.slerp_quaternions(start, end, t)
+
+    for row, a, b, amount in zip(result, start, end, t):
+        expected = m1.Quaternion.slerp(to_quaternion(a), to_quaternion(b), float(amount))
+        np.testing.assert_allclose(row, quaternion_row(expected), atol=TOLERANCE)
+
+    shared = m1.slerp_quaternions(start, end, np.array([0.25], dtype=np.float32))
+    for row, a, b in zip(shared, start, end):
+        expected = m1.Quaternion.slerp(to_quaternion(a), to_quaternion(b), 0.25)
+        np.testing.assert_allclose(row, quaternion_row(expected), atol=TOLERANCE)
+
+    with pytest.raises(ValueError):
+        m1.slerp_quaternions(start, end, t[:3])
+
+
+def test_rotate_vectors():
+    quaternions = random_quaternions(16)
+    vectors = rng.normal(size=(16, 3)).astype(np.float32)
+    result = m1.rotate_vectors(quaternions, vectors)
+
+    for row, quaternion, vector in zip(result, quaternions, vectors):
+        expected = to_quaternion(quaternion).rotate(to_float3(vector))
+        np.testing.assert_allclose(row, float3_row(expected), atol=TOLERANCE)
+
+    single = m1.rotate_vectors(quaternions, vectors[0])
+    for row, quaternion in zip(single, quaternions):
+        expected = to_quaternion(quaternion).rotate(to_float3(vectors[0]))
+        np.testing.assert_allclose(row, float3_row(expected), atol=TOLERANCE)
+
+
+def test_accumulate_rotations():
+    rotations = m1.euler_degrees_to_quaternions(rng.uniform(-10.0, 10.0, size=(24, 3)).astype(np.float32))
+    batched = m1.Orientation()
+    result = m1.accumulate_rotations(batched, rotations)
+
+    sequential = m1.Orientation()
+    for row, rotation in zip(result, rotations):
+        sequential.apply_rotation(to_quaternion(rotation))
+        np.testing.assert_allclose(row, quaternion_row(sequential.get_global_rotation_as_quaternion()), atol=TOLERANCE)
+
+    # The Orientation passed in is left at the last recorded rotation
+    np.testing.assert_allclose(quaternion_row(batched.get_global_rotation_as_quaternion()), result[-1], atol=TOLERANCE)
+
+
+def test_listener_directions():
+    sources = np.array([[0.0, 0.0, 2.0], [0.0, 3.0, 0.0]], dtype=np.float32)
+    result = m1.listener_directions(m1.Quaternion(), m1.Float3(0.0, 0.0, 0.0), sources)
+
+    np.testing.assert_allclose(result[0], [0.0, 0.0, 2.0], atol=1e-4)
+    np.testing.assert_allclose(result[1], [math.pi / 2, 0.0, 3.0], atol=1e-4)
+
+
+def test_output_is_written_in_place():
+    euler = random_euler_degrees(8)
+    out = np.zeros((8, 4), dtype=np.float32)
+    result = m1.euler_degrees_to_quaternions(euler, out=out)
+
+    assert np.shares_memory(result, out)
+    np.testing.assert_allclose(out, m1.euler_degrees_to_quaternions(euler), atol=0.0)
+
+
+@pytest.mark.parametrize("out", [
+    np.zeros((7, 4), dtype=np.float32),
+    np.zeros((8, 4), dtype=np.float64),
+    np.zeros((4, 8), dtype=np.float32).T,
+])
+def test_unusable_output_is_rejected(out):
+    with pytest.raises(ValueError):
+        m1.euler_degrees_to_quaternions(random_euler_degrees(8), out=out)
+
+
+def test_inputs_are_converted():
+    euler = random_euler_degrees(8)
+    np.testing.assert_allclose(m1.euler_degrees_to_quaternions(euler.astype(np.float64)),
+                               m1.euler_degrees_to_quaternions(euler), atol=0.0)
+    np.testing.assert_allclose(m1.euler_degrees_to_quaternions(np.asfortranarray(euler)),
+                               m1.euler_degrees_to_quaternions(euler), atol=0.0)
+
+    with pytest.raises(ValueError):
+        m1.euler_degrees_to_quaternions(np.zeros((8, 4), dtype=np.float32))
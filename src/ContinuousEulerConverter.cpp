@@ -0,0 +1,150 @@
+#include "m1_mathematics/ContinuousEulerConverter.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+using namespace Mach1;
+
+namespace {
+
+constexpr float kTwoPi = static_cast<float>(2.0 * M_PI);
+
+/**
+ * Bring an angle difference into [-PI, PI), the shortest way round
+ */
+float WrapDelta(float delta) {
+    return delta - kTwoPi * std::floor(delta / kTwoPi + 0.5f);
+}
+
+/**
+ * Convert one rotation against its track's previous output, updating the track in place
+ */
+void ConvertTrack(float w, float x, float y, float z, float lock_sin, float release_sin,
+                  float &yaw, float &pitch, float &roll, uint8_t &started, uint8_t &locked) {
+    float length = std::sqrt(w * w + x * x + y * y + z * z);
+    if (length > 0.0f) {
+        w /= length;
+        x /= length;
+        y /= length;
+        z /= length;
+    } else {
+        w = 1.0f;
+        x = y = z = 0.0f;
+    }
+
+    // Same terms as Quaternion::ToEulerRadians; asin of the clamped sine is its copysign(PI/2) at the poles
+    float sinp = std::min(std::max(2.0f * (w * y - z * x), -1.0f), 1.0f);
+    float abs_sinp = std::fabs(sinp);
+    bool is_locked = locked ? abs_sinp >= release_sin : abs_sinp >= lock_sin;
+
+    float raw_yaw;
+    float raw_roll;
+    if (is_locked) {
+        // Hold roll (zero for a track starting inside the band) and take yaw from the rotation with that roll
+        // undone: its second column is (-sin(yaw), cos(yaw), 0), which stays well defined at the poles
+        raw_roll = started ? roll : 0.0f;
+        float c = std::cos(raw_roll);
+        float s = std::sin(raw_roll);
+        float r01 = 2.0f * (x * y - w * z);
+        float r02 = 2.0f * (x * z + w * y);
+        float r11 = 1.0f - 2.0f * (x * x + z * z);
+        float r12 = 2.0f * (y * z - w * x);
+        raw_yaw = std::atan2(s * r02 - c * r01, c * r11 - s * r12);
+    } else {
+        raw_yaw = std::atan2(2.0f * (w * z + x * y), 1.0f - 2.0f * (y * y + z * z));
+        raw_roll = std::atan2(2.0f * (w * x + y * z), 1.0f - 2.0f * (x * x + y * y));
+    }
+
+    if (started) {
+        yaw += WrapDelta(raw_yaw - yaw);
+        roll += WrapDelta(raw_roll - roll);
+    } else {
+        yaw = raw_yaw;
+        roll = raw_roll;
+    }
+    pitch = std::asin(sinp);
+    started = 1;
+    locked = static_cast<uint8_t>(is_locked);
+}
+
+} // namespace
+
+ContinuousEulerConverter::ContinuousEulerConverter(size_t track_count, float lock_margin_radians,
+                                                   float release_margin_radians) {
+    SetLockMargins(lock_margin_radians, release_margin_radians);
+    Resize(track_count);
+}
+
+void ContinuousEulerConverter::Resize(size_t track_count) {
+    m_yaw.resize(track_count, 0.0f);
+    m_pitch.resize(track_count, 0.0f);
+    m_roll.resize(track_count, 0.0f);
+    m_started.resize(track_count, 0);
+    m_locked.resize(track_count, 0);
+}
+
+size_t ContinuousEulerConverter::GetTrackCount() const {
+    return m_started.size();
+}
+
+void ContinuousEulerConverter::SetLockMargins(float lock_margin_radians, float release_margin_radians) {
+    m_lock_margin = std::min(std::max(lock_margin_radians, 0.0f), static_cast<float>(M_PI / 2.0));
+    m_release_margin = std::min(std::max(release_margin_radians, m_lock_margin), static_cast<float>(M_PI / 2.0));
+
+    // |sin(pitch)| is what the conversion measures; a margin of zero locks only at the existing clamp
+    m_lock_sin = std::cos(m_lock_margin);
+    m_release_sin = std::cos(m_release_margin);
+}
+
+float ContinuousEulerConverter::GetLockMargin() const {
+    return m_lock_margin;
+}
+
+float ContinuousEulerConverter::GetReleaseMargin() const {
+    return m_release_margin;
+}
+
+void ContinuousEulerConverter::Reset(size_t track) {
+    m_started[track] = 0;
+    m_locked[track] = 0;
+}
+
+void ContinuousEulerConverter::Reset() {
+    std::fill(m_started.begin(), m_started.end(), static_cast<uint8_t>(0));
+    std::fill(m_locked.begin(), m_locked.end(), static_cast<uint8_t>(0));
+}
+
+bool ContinuousEulerConverter::IsLocked(size_t track) const {
+    return m_locked[track] != 0;
+}
+
+Float3 ContinuousEulerConverter::Convert(size_t track, Quaternion rotation) {
+    ConvertTrack(rotation.GetW(), rotation.GetX(), rotation.GetY(), rotation.GetZ(), m_lock_sin, m_release_sin,
+                 m_yaw[track], m_pitch[track], m_roll[track], m_started[track], m_locked[track]);
+    return {m_yaw[track], m_pitch[track], m_roll[track]};
+}
+
+void ContinuousEulerConverter::Convert(const QuaternionBatch &rotations, Float3Batch &output) {
+    size_t count = rotations.Size();
+    if (count != GetTrackCount()) {
+        Resize(count);
+    }
+    output.Resize(count);
+
+    const float *w = rotations.W();
+    const float *x = rotations.X();
+    const float *y = rotations.Y();
+    const float *z = rotations.Z();
+    for (size_t i = 0; i < count; i++) {
+        ConvertTrack(w[i], x[i], y[i], z[i], m_lock_sin, m_release_sin,
+                     m_yaw[i], m_pitch[i], m_roll[i], m_started[i], m_locked[i]);
+    }
+
+    std::copy(m_yaw.begin(), m_yaw.end(), output.Yaw());
+    std::copy(m_pitch.begin(), m_pitch.end(), output.Pitch());
+    std::copy(m_roll.begin(), m_roll.end(), output.Roll());
+}
@@ -0,0 +1,215 @@
+#include "m1_mathematics/DualQuaternion.h"
+
+#include <cmath>
+#include <sstream>
+
+#include "m1_mathematics/MathUtility.h"
+#include "m1_mathematics/Orientation.h"
+#include "m1_mathematics/RealtimeSafety.h"
+
+using namespace Mach1;
+
+namespace {
+
+// Pure quaternion (0, v) for a vector; Quaternion x, y, z pair with the roll, pitch and yaw components
+Quaternion ToPureQuaternion(Float3 vector) {
+    return {0.0f, vector.GetRoll(), vector.GetPitch(), vector.GetYaw()};
+}
+
+Float3 FromPureQuaternion(Quaternion quaternion) {
+    return {quaternion.GetZ(), quaternion.GetY(), quaternion.GetX()};
+}
+
+} // namespace
+
+DualQuaternion::DualQuaternion() : m_real(), m_dual(0.0f, 0.0f, 0.0f, 0.0f) {
+}
+
+DualQuaternion::DualQuaternion(Quaternion real, Quaternion dual) : m_real(real), m_dual(dual) {
+}
+
+DualQuaternion DualQuaternion::FromRotationTranslation(Quaternion rotation, Float3 translation) {
+    return {rotation, ToPureQuaternion(translation) * rotation * 0.5f};
+}
+
+DualQuaternion DualQuaternion::FromOrientation(const Orientation &orientation, Float3 position) {
+    return FromRotationTranslation(orientation.GetGlobalRotationAsQuaternion(), position);
+}
+
+DualQuaternion DualQuaternion::FromRotation(Quaternion rotation) {
+    return {rotation, {0.0f, 0.0f, 0.0f, 0.0f}};
+}
+
+DualQuaternion DualQuaternion::FromTranslation(Float3 translation) {
+    return {{}, ToPureQuaternion(translation) * 0.5f};
+}
+
+DualQuaternion DualQuaternion::Sclerp(DualQuaternion from, DualQuaternion to, float t) {
+    if (from.m_real.DotProduct(to.m_real) < 0.0f) {
+        to = to * -1.0f;
+    }
+
+    // Raise the relative transform to the power t in screw coordinates, then reapply it to the start
+    DualQuaternion difference = from.Inversed() * to;
+    Quaternion real = difference.m_real;
+    Quaternion dual = difference.m_dual;
+
+    float sin_half_squared = real.GetX() * real.GetX() + real.GetY() * real.GetY() + real.GetZ() * real.GetZ();
+    if (sin_half_squared < MathUtility::FLOAT_COMPARISON_EPSILON * MathUtility::FLOAT_COMPARISON_EPSILON) {
+        // No rotation to speak of: the screw degenerates to a straight translation
+        Quaternion interpolated_real = Quaternion() * (1.0f - t) + real * t;
+        return (from * DualQuaternion(interpolated_real, dual * t)).Normalized();
+    }
+
+    float sin_half = std::sqrt(sin_half_squared);
+    float half_angle = std::atan2(sin_half, real.GetW());
+    Float3 axis = FromPureQuaternion(real) / sin_half;
+    float pitch = -2.0f * dual.GetW() / sin_half;
+    Float3 moment = (FromPureQuaternion(dual) - axis * (pitch * 0.5f * real.GetW())) / sin_half;
+
+    float scaled_half_angle = half_angle * t;
+    float scaled_pitch = pitch * t;
+    float s = std::sin(scaled_half_angle);
+    float c = std::cos(scaled_half_angle);
+
+    Quaternion power_real = {c, 0.0f, 0.0f, 0.0f};
+    power_real = power_real + ToPureQuaternion(axis * s);
+    Quaternion power_dual = {-0.5f * scaled_pitch * s, 0.0f, 0.0f, 0.0f};
+    power_dual = power_dual + ToPureQuaternion(moment * s + axis * (0.5f * scaled_pitch * c));
+
+    return from * DualQuaternion(power_real, power_dual);
+}
+
+DualQuaternion DualQuaternion::Blend(const DualQuaternion *transforms, const float *weights, size_t count) {
+    if (count == 0) {
+        return {};
+    }
+
+    DualQuaternion sum(Quaternion(0.0f, 0.0f, 0.0f, 0.0f), Quaternion(0.0f, 0.0f, 0.0f, 0.0f));
+    for (size_t i = 0; i < count; i++) {
+        float weight = weights[i];
+        if (transforms[0].m_real.DotProduct(transforms[i].m_real) < 0.0f) {
+            weight = -weight;
+        }
+        sum = sum + transforms[i] * weight;
+    }
+
+    if (sum.m_real.LengthSquared() < MathUtility::FLOAT_COMPARISON_EPSILON) {
+        return {};
+    }
+    return sum.Normalized();
+}
+
+Quaternion DualQuaternion::GetRotation() const {
+    return m_real;
+}
+
+Float3 DualQuaternion::GetTranslation() const {
+    return FromPureQuaternion(m_dual * m_real.Inversed()) * 2.0f;
+}
+
+Quaternion DualQuaternion::GetReal() const {
+    return m_real;
+}
+
+Quaternion DualQuaternion::GetDual() const {
+    return m_dual;
+}
+
+DualQuaternion DualQuaternion::Inversed() const {
+    return {m_real.Inversed(), m_dual.Inversed()};
+}
+
+DualQuaternion DualQuaternion::Normalized() const {
+    float length = m_real.Length();
+    if (length < MathUtility::FLOAT_COMPARISON_EPSILON) {
+        return {};
+    }
+
+    Quaternion real = m_real / length;
+    Quaternion dual = m_dual / length;
+    // A unit dual quaternion's dual part is orthogonal to its real part
+    dual = dual - real * real.DotProduct(dual);
+    return {real, dual};
+}
+
+Float3 DualQuaternion::TransformPoint(Float3 point) const {
+    return m_real.Rotate(point) + GetTranslation();
+}
+
+Float3 DualQuaternion::TransformDirection(Float3 direction) const {
+    return m_real.Rotate(direction);
+}
+
+void DualQuaternion::TransformPoints(const Float3Batch &points, Float3Batch &output) const {
+    float w = m_real.GetW(), x = m_real.GetX(), y = m_real.GetY(), z = m_real.GetZ();
+
+    // Rotation matrix rows in (x, y, z) = (forward, left, up) order, then the translation column
+    float m00 = 1.0f - 2.0f * (y * y + z * z), m01 = 2.0f * (x * y - w * z), m02 = 2.0f * (x * z + w * y);
+    float m10 = 2.0f * (x * y + w * z), m11 = 1.0f - 2.0f * (x * x + z * z), m12 = 2.0f * (y * z - w * x);
+    float m20 = 2.0f * (x * z - w * y), m21 = 2.0f * (y * z + w * x), m22 = 1.0f - 2.0f * (x * x + y * y);
+
+    Float3 translation = GetTranslation();
+    float t0 = translation.GetRoll(), t1 = translation.GetPitch(), t2 = translation.GetYaw();
+
+    size_t count = points.Size();
+    output.Resize(count);
+
+    const float *in_up = points.Yaw();
+    const float *in_left = points.Pitch();
+    const float *in_forward = points.Roll();
+    float *out_up = output.Yaw();
+    float *out_left = output.Pitch();
+    float *out_forward = output.Roll();
+
+    for (size_t i = 0; i < count; i++) {
+        float px = in_forward[i];
+        float py = in_left[i];
+        float pz = in_up[i];
+
+        out_forward[i] = m00 * px + m01 * py + m02 * pz + t0;
+        out_left[i] = m10 * px + m11 * py + m12 * pz + t1;
+        out_up[i] = m20 * px + m21 * py + m22 * pz + t2;
+    }
+}
+
+bool DualQuaternion::IsApproximatelyEqual(const DualQuaternion &rhs) const {
+    return m_real.IsApproximatelyEqual(rhs.m_real) && m_dual.IsApproximatelyEqual(rhs.m_dual);
+}
+
+bool DualQuaternion::IsEquivalent(const DualQuaternion &rhs) const {
+    return IsApproximatelyEqual(rhs) || IsApproximatelyEqual(rhs * -1.0f);
+}
+
+std::string DualQuaternion::ToString() const {
+    M1_REALTIME_UNSAFE("DualQuaternion::ToString");
+    std::stringstream s;
+    s << "DualQuaternion(real: " << m_real.ToString() << ", dual: " << m_dual.ToString() << ")";
+    return s.str();
+}
+
+// ===================================================== OPERATORS =====================================================
+
+void DualQuaternion::operator*=(const DualQuaternion &rhs) {
+    *this = *this * rhs;
+}
+
+bool DualQuaternion::operator==(const DualQuaternion &rhs) const {
+    return m_real == rhs.m_real && m_dual == rhs.m_dual;
+}
+
+bool DualQuaternion::operator!=(const DualQuaternion &rhs) const {
+    return !(*this == rhs);
+}
+
+DualQuaternion DualQuaternion::operator*(const DualQuaternion &rhs) const {
+    return {m_real * rhs.m_real, m_real * rhs.m_dual + m_dual * rhs.m_real};
+}
+
+DualQuaternion DualQuaternion::operator*(float scalar) const {
+    return {m_real * scalar, m_dual * scalar};
+}
+
+DualQuaternion DualQuaternion::operator+(const DualQuaternion &rhs) const {
+    return {m_real + rhs.m_real, m_dual + rhs.m_dual};
+}
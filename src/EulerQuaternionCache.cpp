@@ -0,0 +1,115 @@
+#include "m1_mathematics/EulerQuaternionCache.h"
+
+#include <cmath>
+
+#include "m1_mathematics/MathUtility.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+using namespace Mach1;
+
+namespace {
+
+constexpr size_t BYTES_PER_STEP = 2 * sizeof(float);
+
+} // namespace
+
+EulerQuaternionCache::EulerQuaternionCache(uint32_t steps_per_turn, size_t memory_budget_bytes) {
+    size_t affordable_steps = memory_budget_bytes / BYTES_PER_STEP;
+    m_steps_per_turn = steps_per_turn;
+    if (m_steps_per_turn > affordable_steps) {
+        m_steps_per_turn = static_cast<uint32_t>(affordable_steps);
+    }
+    if (m_steps_per_turn < 1) {
+        m_steps_per_turn = 1;
+    }
+    m_steps_per_degree = float(m_steps_per_turn) / 360.0f;
+
+    // Computed in double, so every entry is the correctly rounded float of its half angle
+    m_half_angle_sin_cos.resize(size_t(m_steps_per_turn) * 2);
+    for (uint32_t i = 0; i < m_steps_per_turn; i++) {
+        double half_angle = 0.5 * (-M_PI + 2.0 * M_PI * double(i) / double(m_steps_per_turn));
+        m_half_angle_sin_cos[2 * i] = float(std::sin(half_angle));
+        m_half_angle_sin_cos[2 * i + 1] = float(std::cos(half_angle));
+    }
+}
+
+uint32_t EulerQuaternionCache::GetStepsPerTurn() const {
+    return m_steps_per_turn;
+}
+
+float EulerQuaternionCache::GetStepDegrees() const {
+    return 360.0f / float(m_steps_per_turn);
+}
+
+size_t EulerQuaternionCache::GetMemoryUsage() const {
+    return m_half_angle_sin_cos.size() * sizeof(float);
+}
+
+int32_t EulerQuaternionCache::ToStep(float degrees) const {
+    float position = MathUtility::Wrap(degrees + 180.0f, 0.0f, 360.0f) * m_steps_per_degree;
+    // position is never negative, so truncating after adding a half rounds to nearest without a libm call
+    auto step = static_cast<int32_t>(position + 0.5f);
+    // Rounding up from the last step lands on the first one
+    return step >= int32_t(m_steps_per_turn) ? step - int32_t(m_steps_per_turn) : step;
+}
+
+Quaternion EulerQuaternionCache::FromEulerSteps(int32_t yaw_step, int32_t pitch_step, int32_t roll_step) const {
+    auto wrap = [this](int32_t step) {
+        int32_t steps = int32_t(m_steps_per_turn);
+        step %= steps;
+        return step < 0 ? step + steps : step;
+    };
+    return Assemble(wrap(yaw_step), wrap(pitch_step), wrap(roll_step));
+}
+
+Quaternion EulerQuaternionCache::FromEulerDegrees(Float3 euler_degrees) const {
+    return Assemble(ToStep(euler_degrees.GetYaw()), ToStep(euler_degrees.GetPitch()), ToStep(euler_degrees.GetRoll()));
+}
+
+Quaternion EulerQuaternionCache::FromEulerRadians(Float3 euler_radians) const {
+    return FromEulerDegrees(euler_radians.EulerDegrees());
+}
+
+void EulerQuaternionCache::FromEulerDegrees(const Float3Batch &euler_degrees, QuaternionBatch &output) const {
+    output.Resize(euler_degrees.Size());
+
+    const float *yaw = euler_degrees.Yaw();
+    const float *pitch = euler_degrees.Pitch();
+    const float *roll = euler_degrees.Roll();
+    float *qw = output.W();
+    float *qx = output.X();
+    float *qy = output.Y();
+    float *qz = output.Z();
+
+    for (size_t i = 0; i < euler_degrees.Size(); i++) {
+        Quaternion quaternion = Assemble(ToStep(yaw[i]), ToStep(pitch[i]), ToStep(roll[i]));
+        qw[i] = quaternion.GetW();
+        qx[i] = quaternion.GetX();
+        qy[i] = quaternion.GetY();
+        qz[i] = quaternion.GetZ();
+    }
+}
+
+Quaternion EulerQuaternionCache::Assemble(int32_t yaw_step, int32_t pitch_step, int32_t roll_step) const {
+    const float *table = m_half_angle_sin_cos.data();
+    float sinYaw = table[2 * yaw_step];
+    float cosYaw = table[2 * yaw_step + 1];
+    float sinPitch = table[2 * pitch_step];
+    float cosPitch = table[2 * pitch_step + 1];
+    float sinRoll = table[2 * roll_step];
+    float cosRoll = table[2 * roll_step + 1];
+
+    // Quaternion components computed in Yaw-Pitch-Roll order (Z-Y-X), as Quaternion::FromEulerRadians
+    float cy_cp = cosYaw * cosPitch;
+    float sy_sp = sinYaw * sinPitch;
+    float cy_sp = cosYaw * sinPitch;
+    float sy_cp = sinYaw * cosPitch;
+
+    return {cy_cp * cosRoll + sy_sp * sinRoll,
+            cy_cp * sinRoll - sy_sp * cosRoll,
+            cy_sp * cosRoll + sy_cp * sinRoll,
+            sy_cp * cosRoll - cy_sp * sinRoll};
+}
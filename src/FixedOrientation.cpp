@@ -0,0 +1,52 @@
+#include "m1_mathematics/FixedOrientation.h"
+
+using namespace Mach1;
+
+template<typename T>
+FixedOrientation<T>::FixedOrientation() : m_local(), m_parent() {
+}
+
+template<typename T>
+FixedQuaternion<T> FixedOrientation<T>::GetGlobalRotation() const {
+    return m_parent * m_local;
+}
+
+template<typename T>
+FixedFloat3<T> FixedOrientation<T>::GetGlobalRotationAsEuler() const {
+    return GetGlobalRotation().ToEuler();
+}
+
+template<typename T>
+void FixedOrientation<T>::ApplyRotation(FixedQuaternion<T> quaternion) {
+    m_local = (m_local * quaternion).Normalized();
+}
+
+template<typename T>
+void FixedOrientation<T>::ApplyRotation(FixedFloat3<T> euler) {
+    ApplyRotation(FixedQuaternion<T>::FromEuler(euler));
+}
+
+template<typename T>
+void FixedOrientation<T>::SetRotation(FixedQuaternion<T> quaternion) {
+    m_local = quaternion;
+}
+
+template<typename T>
+void FixedOrientation<T>::SetGlobalRotation(FixedQuaternion<T> quaternion) {
+    Reset();
+    SetRotation(quaternion);
+}
+
+template<typename T>
+void FixedOrientation<T>::Reset() {
+    m_local = {};
+    m_parent = {};
+}
+
+template<typename T>
+void FixedOrientation<T>::Recenter() {
+    m_parent = m_local.Inversed();
+}
+
+template class Mach1::FixedOrientation<int16_t>;
+template class Mach1::FixedOrientation<int32_t>;
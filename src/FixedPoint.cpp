@@ -0,0 +1,209 @@
+#include "m1_mathematics/FixedPoint.h"
+
+#include <cmath>
+#include <limits>
+
+using namespace Mach1;
+
+namespace {
+
+constexpr int CORDIC_ITERATIONS = 31;
+
+// atan(2^-i) as Q1.31 half-turns
+constexpr int32_t CORDIC_ANGLES[CORDIC_ITERATIONS] = {
+        536870912, 316933406, 167458907, 85004756, 42667331, 21354465, 10679838, 5340245, 2670163, 1335087,
+        667544, 333772, 166886, 83443, 41722, 20861, 10430, 5215, 2608, 1304,
+        652, 326, 163, 81, 41, 20, 10, 5, 3, 1,
+        1
+};
+
+// Reciprocal of the CORDIC gain, prod(1 / sqrt(1 + 2^-2i)), in Q2.30
+constexpr int64_t CORDIC_GAIN_INVERSE = 652032874;
+
+constexpr int32_t QUARTER_TURN = int32_t(1) << 30;
+
+// 1 / sqrt(m) in Q2.30 at the midpoints of [i / 16, (i + 1) / 16) for i = 4..15
+constexpr uint32_t RECIPROCAL_SQRT_SEEDS[12] = {
+        2024667000, 1831380208, 1684624773, 1568300315, 1473161629, 1393471397,
+        1325455684, 1266516759, 1214800200, 1168942037, 1127913670, 1090922784
+};
+
+int HighestSetBit(uint64_t value) {
+    int bit = 0;
+    for (int step = 32; step > 0; step >>= 1) {
+        if (value >> step) {
+            value >>= step;
+            bit += step;
+        }
+    }
+    return bit;
+}
+
+} // namespace
+
+template<typename T>
+T FixedPoint::FromFloat(float value) {
+    constexpr float scale = float(int64_t(1) << FixedPointTraits<T>::FRACTION_BITS);
+    float scaled = std::round(value * scale);
+    if (scaled >= float(std::numeric_limits<T>::max())) {
+        return std::numeric_limits<T>::max();
+    }
+    if (scaled <= float(std::numeric_limits<T>::min())) {
+        return std::numeric_limits<T>::min();
+    }
+    return static_cast<T>(scaled);
+}
+
+template<typename T>
+float FixedPoint::ToFloat(T value) {
+    constexpr float scale = 1.0f / float(int64_t(1) << FixedPointTraits<T>::FRACTION_BITS);
+    return float(value) * scale;
+}
+
+template<typename T>
+int32_t FixedPoint::ToQ31(T value) {
+    return int32_t(uint32_t(int32_t(value)) << (31 - FixedPointTraits<T>::FRACTION_BITS));
+}
+
+template<typename T>
+T FixedPoint::FromQ31(int32_t value) {
+    constexpr int shift = 31 - FixedPointTraits<T>::FRACTION_BITS;
+    int64_t rounded = RoundingShift(value, shift);
+    if (rounded > std::numeric_limits<T>::max()) {
+        return std::numeric_limits<T>::max();
+    }
+    return static_cast<T>(rounded);
+}
+
+template int16_t FixedPoint::FromFloat<int16_t>(float);
+template int32_t FixedPoint::FromFloat<int32_t>(float);
+template float FixedPoint::ToFloat<int16_t>(int16_t);
+template float FixedPoint::ToFloat<int32_t>(int32_t);
+template int32_t FixedPoint::ToQ31<int16_t>(int16_t);
+template int32_t FixedPoint::ToQ31<int32_t>(int32_t);
+template int16_t FixedPoint::FromQ31<int16_t>(int32_t);
+template int32_t FixedPoint::FromQ31<int32_t>(int32_t);
+
+int32_t FixedPoint::Saturate32(int64_t value) {
+    if (value > std::numeric_limits<int32_t>::max()) {
+        return std::numeric_limits<int32_t>::max();
+    }
+    if (value < std::numeric_limits<int32_t>::min()) {
+        return std::numeric_limits<int32_t>::min();
+    }
+    return static_cast<int32_t>(value);
+}
+
+int64_t FixedPoint::RoundingShift(int64_t value, int shift) {
+    if (shift <= 0) {
+        return value * (int64_t(1) << -shift);
+    }
+    return (value + (int64_t(1) << (shift - 1))) >> shift;
+}
+
+void FixedPoint::SinCos(int32_t angle, int32_t &sine, int32_t &cosine) {
+    // CORDIC converges within +-PI/2; fold the other half of the circle by rotating through PI
+    bool folded = angle > QUARTER_TURN || angle < -QUARTER_TURN;
+    int32_t z = folded ? int32_t(uint32_t(angle) + 0x80000000u) : angle;
+
+    int64_t x = CORDIC_GAIN_INVERSE;
+    int64_t y = 0;
+    for (int i = 0; i < CORDIC_ITERATIONS; i++) {
+        int64_t x_shifted = x >> i;
+        int64_t y_shifted = y >> i;
+        if (z >= 0) {
+            x -= y_shifted;
+            y += x_shifted;
+            z -= CORDIC_ANGLES[i];
+        } else {
+            x += y_shifted;
+            y -= x_shifted;
+            z += CORDIC_ANGLES[i];
+        }
+    }
+
+    if (folded) {
+        x = -x;
+        y = -y;
+    }
+    cosine = Saturate32(x * 2);
+    sine = Saturate32(y * 2);
+}
+
+int32_t FixedPoint::Atan2(int64_t y, int64_t x) {
+    if (x == 0 && y == 0) {
+        return 0;
+    }
+
+    // Rotate the left half-plane through PI; binary angles wrap, so the offset needs no special cases
+    uint32_t angle = 0;
+    if (x < 0) {
+        x = -x;
+        y = -y;
+        angle = 0x80000000u;
+    }
+
+    // Bring the larger magnitude to around 2^40: precise, with room for the CORDIC gain
+    uint64_t largest = uint64_t(x > (y < 0 ? -y : y) ? x : (y < 0 ? -y : y));
+    int scale = HighestSetBit(largest) - 40;
+    if (scale > 0) {
+        x >>= scale;
+        y >>= scale;
+    } else {
+        x *= int64_t(1) << -scale;
+        y *= int64_t(1) << -scale;
+    }
+
+    for (int i = 0; i < CORDIC_ITERATIONS; i++) {
+        int64_t x_shifted = x >> i;
+        int64_t y_shifted = y >> i;
+        if (y > 0) {
+            x += y_shifted;
+            y -= x_shifted;
+            angle += uint32_t(CORDIC_ANGLES[i]);
+        } else {
+            x -= y_shifted;
+            y += x_shifted;
+            angle -= uint32_t(CORDIC_ANGLES[i]);
+        }
+    }
+    return int32_t(angle);
+}
+
+uint32_t FixedPoint::Sqrt(uint64_t value) {
+    uint64_t result = 0;
+    uint64_t bit = uint64_t(1) << 62;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return static_cast<uint32_t>(result);
+}
+
+uint32_t FixedPoint::ReciprocalSqrt(uint64_t value, int fraction_bits, int &shift) {
+    // value = m * 4^e with m in [1/4, 1), so 1 / sqrt(value) = (1 / sqrt(m)) * 2^-e
+    int exponent = (HighestSetBit(value) + 2 - fraction_bits) >> 1;
+    int m_shift = fraction_bits + 2 * exponent - 30;
+    uint64_t m_bits = m_shift > 0 ? ((value >> (m_shift - 1)) + 1) >> 1 : value << -m_shift;
+    // m in Q2.30 within [2^28, 2^30); rounding may touch the upper end
+    int64_t m = int64_t(m_bits < (uint64_t(1) << 30) ? m_bits : (uint64_t(1) << 30) - 1);
+
+    int64_t y = RECIPROCAL_SQRT_SEEDS[(m >> 26) - 4];
+    // Newton-Raphson: y = y * (3 - m * y^2) / 2, each step roughly doubling the correct bits
+    for (int i = 0; i < 3; i++) {
+        int64_t y_squared = (y * y) >> 30;
+        int64_t m_y_squared = (m * y_squared) >> 30;
+        y = (y * ((int64_t(3) << 30) - m_y_squared)) >> 31;
+    }
+
+    shift = 30 + exponent;
+    return static_cast<uint32_t>(y);
+}
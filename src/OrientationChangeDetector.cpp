@@ -0,0 +1,124 @@
+#include "m1_mathematics/OrientationChangeDetector.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace Mach1;
+
+namespace {
+
+unsigned CountTrailingZeros(uint64_t word) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#endif
+}
+
+} // namespace
+
+OrientationChangeDetector::OrientationChangeDetector(size_t track_count, float threshold_radians) {
+    SetThreshold(threshold_radians);
+    Resize(track_count);
+}
+
+void OrientationChangeDetector::Resize(size_t track_count) {
+    // A zero reported rotation has a zero dot product with any unit rotation, so new tracks always read as changed
+    m_reported_w.resize(track_count, 0.0f);
+    m_reported_x.resize(track_count, 0.0f);
+    m_reported_y.resize(track_count, 0.0f);
+    m_reported_z.resize(track_count, 0.0f);
+
+    // Results of the previous detection no longer line up with the tracks
+    m_flags.resize(track_count, 0);
+    m_mask.assign((track_count + 63) / 64, 0);
+    m_dirty_indices.clear();
+    m_dirty_indices.reserve(track_count);
+}
+
+size_t OrientationChangeDetector::GetTrackCount() const {
+    return m_reported_w.size();
+}
+
+void OrientationChangeDetector::SetThreshold(float threshold_radians) {
+    m_threshold = threshold_radians;
+    m_cos_half_threshold = std::cos(0.5f * threshold_radians);
+}
+
+float OrientationChangeDetector::GetThreshold() const {
+    return m_threshold;
+}
+
+void OrientationChangeDetector::Invalidate() {
+    std::fill(m_reported_w.begin(), m_reported_w.end(), 0.0f);
+    std::fill(m_reported_x.begin(), m_reported_x.end(), 0.0f);
+    std::fill(m_reported_y.begin(), m_reported_y.end(), 0.0f);
+    std::fill(m_reported_z.begin(), m_reported_z.end(), 0.0f);
+}
+
+size_t OrientationChangeDetector::Detect(const QuaternionBatch &rotations) {
+    return Detect(rotations.W(), rotations.X(), rotations.Y(), rotations.Z(), rotations.Size());
+}
+
+size_t OrientationChangeDetector::Detect(const float *w, const float *x, const float *y, const float *z, size_t count) {
+    if (count != GetTrackCount()) {
+        Resize(count);
+    }
+
+    float *reported_w = m_reported_w.data();
+    float *reported_x = m_reported_x.data();
+    float *reported_y = m_reported_y.data();
+    float *reported_z = m_reported_z.data();
+    uint8_t *flags = m_flags.data();
+    float cos_half_threshold = m_cos_half_threshold;
+
+    // Branch-free compare and select, so the loop vectorizes; only dirty tracks move their reported rotation
+    for (size_t i = 0; i < count; i++) {
+        float dot = w[i] * reported_w[i] + x[i] * reported_x[i] + y[i] * reported_y[i] + z[i] * reported_z[i];
+        bool dirty = std::fabs(dot) < cos_half_threshold;
+        flags[i] = dirty;
+
+        reported_w[i] = dirty ? w[i] : reported_w[i];
+        reported_x[i] = dirty ? x[i] : reported_x[i];
+        reported_y[i] = dirty ? y[i] : reported_y[i];
+        reported_z[i] = dirty ? z[i] : reported_z[i];
+    }
+
+    // Pack flags into mask words, then walk set bits to build the index list
+    m_dirty_indices.clear();
+    for (size_t word_index = 0; word_index < m_mask.size(); word_index++) {
+        size_t first = word_index * 64;
+        size_t last = std::min(first + 64, count);
+
+        uint64_t word = 0;
+        for (size_t i = first; i < last; i++) {
+            word |= uint64_t(flags[i]) << (i - first);
+        }
+        m_mask[word_index] = word;
+
+        while (word) {
+            m_dirty_indices.push_back(static_cast<uint32_t>(first + CountTrailingZeros(word)));
+            word &= word - 1;
+        }
+    }
+
+    return m_dirty_indices.size();
+}
+
+const std::vector<uint32_t> &OrientationChangeDetector::GetDirtyIndices() const {
+    return m_dirty_indices;
+}
+
+const std::vector<uint64_t> &OrientationChangeDetector::GetDirtyMask() const {
+    return m_mask;
+}
+
+bool OrientationChangeDetector::IsDirty(size_t track) const {
+    return (m_mask[track / 64] >> (track % 64)) & 1u;
+}
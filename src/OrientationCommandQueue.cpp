@@ -0,0 +1,128 @@
+#include "m1_mathematics/OrientationCommandQueue.h"
+
+#include "m1_mathematics/RealtimeSafety.h"
+
+using namespace Mach1;
+
+OrientationCommandQueue::OrientationCommandQueue(size_t capacity) : m_enqueue_position(0), m_dequeue_position(0) {
+    size_t rounded = 2;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+
+    m_cells.reset(new Cell[rounded]);
+    m_mask = rounded - 1;
+    for (size_t i = 0; i < rounded; i++) {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+size_t OrientationCommandQueue::Capacity() const {
+    return m_mask + 1;
+}
+
+bool OrientationCommandQueue::PushApplyRotation(Quaternion quaternion) {
+    return Push(CommandType::ApplyRotation, quaternion);
+}
+
+bool OrientationCommandQueue::PushSetRotation(Quaternion quaternion) {
+    return Push(CommandType::SetRotation, quaternion);
+}
+
+bool OrientationCommandQueue::PushSetGlobalRotation(Quaternion quaternion) {
+    return Push(CommandType::SetGlobalRotation, quaternion);
+}
+
+bool OrientationCommandQueue::PushRecenter() {
+    return Push(CommandType::Recenter, {});
+}
+
+bool OrientationCommandQueue::PushReset() {
+    return Push(CommandType::Reset, {});
+}
+
+bool OrientationCommandQueue::Push(CommandType type, Quaternion quaternion) {
+    M1_REALTIME_SAFE;
+
+    // Each cell's sequence says whose turn it is: equal to a position when free for the producer claiming that
+    // position, position + 1 once written and waiting for the consumer
+    size_t position = m_enqueue_position.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+        cell = &m_cells[position & m_mask];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+
+        if (difference == 0) {
+            if (m_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // The consumer has not freed this cell since the last lap: the queue is full
+            return false;
+        } else {
+            position = m_enqueue_position.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->type = type;
+    cell->quaternion = quaternion;
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+size_t OrientationCommandQueue::Drain(Orientation &orientation) {
+    M1_REALTIME_SAFE;
+
+    size_t consumed = 0;
+    bool has_pending_rotation = false;
+    Quaternion pending_rotation;
+
+    // Bounded to one lap, so producers that never stop cannot keep the consumer here indefinitely
+    while (consumed < Capacity()) {
+        Cell &cell = m_cells[m_dequeue_position & m_mask];
+        if (cell.sequence.load(std::memory_order_acquire) != m_dequeue_position + 1) {
+            break;
+        }
+
+        CommandType type = cell.type;
+        Quaternion quaternion = cell.quaternion;
+        cell.sequence.store(m_dequeue_position + Capacity(), std::memory_order_release);
+        m_dequeue_position++;
+        consumed++;
+
+        if (type == CommandType::ApplyRotation) {
+            // local * a * b == local * (a * b), so a run of rotations costs a single update of the Orientation
+            pending_rotation = has_pending_rotation ? pending_rotation * quaternion : quaternion;
+            has_pending_rotation = true;
+            continue;
+        }
+
+        if (has_pending_rotation) {
+            orientation.ApplyRotation(pending_rotation);
+            has_pending_rotation = false;
+        }
+
+        switch (type) {
+            case CommandType::SetRotation:
+                orientation.SetRotation(quaternion);
+                break;
+            case CommandType::SetGlobalRotation:
+                orientation.SetGlobalRotation(quaternion);
+                break;
+            case CommandType::Recenter:
+                orientation.Recenter();
+                break;
+            case CommandType::Reset:
+                orientation.Reset();
+                break;
+            case CommandType::ApplyRotation:
+                break;
+        }
+    }
+
+    if (has_pending_rotation) {
+        orientation.ApplyRotation(pending_rotation);
+    }
+    return consumed;
+}
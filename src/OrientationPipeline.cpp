@@ -0,0 +1,110 @@
+#include "m1_mathematics/OrientationPipeline.h"
+
+#include <algorithm>
+
+using namespace Mach1;
+
+ResamplerSource::ResamplerSource(OrientationResampler &resampler, size_t frames_per_chunk)
+        : m_resampler(&resampler), m_frames_per_chunk(frames_per_chunk) {
+}
+
+size_t ResamplerSource::GetTrackCount() const {
+    return m_resampler->GetTrackCount();
+}
+
+size_t ResamplerSource::Fill(QuaternionBatch &chunk) {
+    m_resampler->Process(m_frames_per_chunk, chunk);
+    return m_frames_per_chunk;
+}
+
+SmoothStage::SmoothStage(float smoothing) {
+    SetSmoothing(smoothing);
+}
+
+void SmoothStage::SetSmoothing(float smoothing) {
+    // Smoothing of 1 would never move off the zero starting state
+    m_smoothing = std::min(std::max(smoothing, 0.0f), 0.999f);
+    m_follow = 1.0f - m_smoothing;
+}
+
+float SmoothStage::GetSmoothing() const {
+    return m_smoothing;
+}
+
+void SmoothStage::Resize(size_t track_count) {
+    m_w.resize(track_count, 0.0f);
+    m_x.resize(track_count, 0.0f);
+    m_y.resize(track_count, 0.0f);
+    m_z.resize(track_count, 0.0f);
+}
+
+void SmoothStage::Reset() {
+    std::fill(m_w.begin(), m_w.end(), 0.0f);
+    std::fill(m_x.begin(), m_x.end(), 0.0f);
+    std::fill(m_y.begin(), m_y.end(), 0.0f);
+    std::fill(m_z.begin(), m_z.end(), 0.0f);
+}
+
+PredictStage::PredictStage(float lookahead_frames) : m_lookahead(lookahead_frames) {
+}
+
+void PredictStage::SetLookahead(float lookahead_frames) {
+    m_lookahead = lookahead_frames;
+}
+
+float PredictStage::GetLookahead() const {
+    return m_lookahead;
+}
+
+void PredictStage::Resize(size_t track_count) {
+    m_w.resize(track_count, 0.0f);
+    m_x.resize(track_count, 0.0f);
+    m_y.resize(track_count, 0.0f);
+    m_z.resize(track_count, 0.0f);
+}
+
+void PredictStage::Reset() {
+    std::fill(m_w.begin(), m_w.end(), 0.0f);
+    std::fill(m_x.begin(), m_x.end(), 0.0f);
+    std::fill(m_y.begin(), m_y.end(), 0.0f);
+    std::fill(m_z.begin(), m_z.end(), 0.0f);
+}
+
+void RecenterStage::Resize(size_t track_count) {
+    m_parent_w.resize(track_count, 1.0f);
+    m_parent_x.resize(track_count, 0.0f);
+    m_parent_y.resize(track_count, 0.0f);
+    m_parent_z.resize(track_count, 0.0f);
+    m_local_w.resize(track_count, 1.0f);
+    m_local_x.resize(track_count, 0.0f);
+    m_local_y.resize(track_count, 0.0f);
+    m_local_z.resize(track_count, 0.0f);
+}
+
+void RecenterStage::Recenter(size_t track) {
+    SetParent(track, Quaternion(m_local_w[track], m_local_x[track], m_local_y[track], m_local_z[track]).Inversed());
+}
+
+void RecenterStage::RecenterAll() {
+    for (size_t track = 0; track < m_parent_w.size(); track++) {
+        Recenter(track);
+    }
+}
+
+void RecenterStage::SetParent(size_t track, Quaternion parent) {
+    m_parent_w[track] = parent.GetW();
+    m_parent_x[track] = parent.GetX();
+    m_parent_y[track] = parent.GetY();
+    m_parent_z[track] = parent.GetZ();
+}
+
+Quaternion RecenterStage::GetParent(size_t track) const {
+    return {m_parent_w[track], m_parent_x[track], m_parent_y[track], m_parent_z[track]};
+}
+
+void RecenterStage::Reset() {
+    std::fill(m_parent_w.begin(), m_parent_w.end(), 1.0f);
+    std::fill(m_parent_x.begin(), m_parent_x.end(), 0.0f);
+    std::fill(m_parent_y.begin(), m_parent_y.end(), 0.0f);
+    std::fill(m_parent_z.begin(), m_parent_z.end(), 0.0f);
+}
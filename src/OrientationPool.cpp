@@ -0,0 +1,392 @@
+#include "m1_mathematics/OrientationPool.h"
+
+#include <cmath>
+
+#include "m1_mathematics/MathUtility.h"
+
+using namespace Mach1;
+
+namespace {
+
+/**
+ * lhs[i] *= rhs[i] over SoA arrays, with the same component order as Quaternion::operator*=
+ */
+void MultiplyInPlace(float *w, float *x, float *y, float *z,
+                     const float *rw, const float *rx, const float *ry, const float *rz, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        float a = w[i] * rx[i] + x[i] * rw[i] + y[i] * rz[i] - z[i] * ry[i];
+        float b = w[i] * ry[i] + y[i] * rw[i] + z[i] * rx[i] - x[i] * rz[i];
+        float c = w[i] * rz[i] + z[i] * rw[i] + x[i] * ry[i] - y[i] * rx[i];
+        w[i] = w[i] * rw[i] - x[i] * rx[i] - y[i] * ry[i] - z[i] * rz[i];
+        x[i] = a;
+        y[i] = b;
+        z[i] = c;
+    }
+}
+
+/**
+ * lhs[i] *= single-axis rotation by angles[i] * scale, over SoA arrays. `a` is the component of the rotation axis,
+ * and (p, q) the remaining pair, ordered so that one kernel covers all three axes:
+ * yaw is (z; x, y), pitch is (y; z, x) and roll is (x; y, z). @see Quaternion::RotateYaw
+ */
+void RotateAxisInPlace(float *w, float *a, float *p, float *q, const float *angles, float scale, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        float half_angle = angles[i] * scale * 0.5f;
+        float c = std::cos(half_angle);
+        float s = std::sin(half_angle);
+        float qw = w[i] * c - a[i] * s;
+        float qa = a[i] * c + w[i] * s;
+        float qp = p[i] * c + q[i] * s;
+        float qq = q[i] * c - p[i] * s;
+        w[i] = qw;
+        a[i] = qa;
+        p[i] = qp;
+        q[i] = qq;
+    }
+}
+
+void Fill(QuaternionBatch &batch, size_t first, size_t count, Quaternion value) {
+    for (size_t i = first; i < first + count; i++) {
+        batch.W()[i] = value.GetW();
+        batch.X()[i] = value.GetX();
+        batch.Y()[i] = value.GetY();
+        batch.Z()[i] = value.GetZ();
+    }
+}
+
+} // namespace
+
+OrientationPool::OrientationPool() : m_size(0) {
+}
+
+void OrientationPool::Reserve(size_t capacity) {
+    m_local.Reserve(capacity);
+    m_parent.Reserve(capacity);
+    m_denseToSlot.reserve(capacity);
+    m_slotToDense.reserve(capacity);
+    m_slotGeneration.reserve(capacity);
+    m_freeSlots.reserve(capacity);
+}
+
+OrientationHandle OrientationPool::Create() {
+    uint32_t slot;
+    if (m_freeSlots.empty()) {
+        slot = static_cast<uint32_t>(m_slotToDense.size());
+        m_slotToDense.push_back(0);
+        m_slotGeneration.push_back(1);
+    } else {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+
+    size_t dense = m_size++;
+    m_local.Resize(m_size);
+    m_parent.Resize(m_size);
+    m_local.Set(dense, {});
+    m_parent.Set(dense, {});
+    m_denseToSlot.push_back(slot);
+    m_slotToDense[slot] = static_cast<uint32_t>(dense);
+
+    return {slot, m_slotGeneration[slot]};
+}
+
+bool OrientationPool::Destroy(OrientationHandle handle) {
+    if (!IsValid(handle)) {
+        return false;
+    }
+
+    // Move the last Orientation into the hole, keeping storage dense
+    size_t dense = m_slotToDense[handle.index];
+    size_t last = m_size - 1;
+    if (dense != last) {
+        m_local.Set(dense, m_local.Get(last));
+        m_parent.Set(dense, m_parent.Get(last));
+        uint32_t moved_slot = m_denseToSlot[last];
+        m_denseToSlot[dense] = moved_slot;
+        m_slotToDense[moved_slot] = static_cast<uint32_t>(dense);
+    }
+
+    m_size--;
+    m_local.Resize(m_size);
+    m_parent.Resize(m_size);
+    m_denseToSlot.pop_back();
+
+    m_slotGeneration[handle.index]++;
+    m_freeSlots.push_back(handle.index);
+    return true;
+}
+
+void OrientationPool::Clear() {
+    for (size_t dense = 0; dense < m_size; dense++) {
+        uint32_t slot = m_denseToSlot[dense];
+        m_slotGeneration[slot]++;
+        m_freeSlots.push_back(slot);
+    }
+
+    m_size = 0;
+    m_local.Resize(0);
+    m_parent.Resize(0);
+    m_denseToSlot.clear();
+}
+
+bool OrientationPool::IsValid(OrientationHandle handle) const {
+    return handle.index < m_slotGeneration.size() && handle.generation != 0 &&
+           m_slotGeneration[handle.index] == handle.generation;
+}
+
+size_t OrientationPool::Size() const {
+    return m_size;
+}
+
+size_t OrientationPool::GetDenseIndex(OrientationHandle handle) const {
+    // A freed slot still maps to its old position, which another Orientation may now occupy or which may be past the end
+    return IsValid(handle) ? m_slotToDense[handle.index] : m_size;
+}
+
+OrientationHandle OrientationPool::GetHandle(size_t dense_index) const {
+    uint32_t slot = m_denseToSlot[dense_index];
+    return {slot, m_slotGeneration[slot]};
+}
+
+const QuaternionBatch &OrientationPool::GetLocalRotations() const {
+    return m_local;
+}
+
+const QuaternionBatch &OrientationPool::GetParentRotations() const {
+    return m_parent;
+}
+
+Quaternion OrientationPool::GetLocal(size_t dense) const {
+    return m_local.Get(dense);
+}
+
+void OrientationPool::SetLocal(size_t dense, Quaternion quaternion) {
+    m_local.Set(dense, quaternion);
+}
+
+void OrientationPool::ApplyLocal(size_t dense, Quaternion quaternion) {
+    Quaternion local = m_local.Get(dense);
+    local *= quaternion;
+    m_local.Set(dense, local);
+}
+
+// =====================================================================================================================
+// ===================================================== BY HANDLE =====================================================
+// =====================================================================================================================
+
+Quaternion OrientationPool::GetGlobalRotationAsQuaternion(OrientationHandle handle) const {
+    size_t dense = GetDenseIndex(handle);
+    if (dense == m_size) {
+        return {};
+    }
+    return m_parent.Get(dense) * m_local.Get(dense);
+}
+
+Float3 OrientationPool::GetGlobalRotationAsEulerDegrees(OrientationHandle handle) const {
+    return GetGlobalRotationAsQuaternion(handle).ToEulerDegrees();
+}
+
+Float3 OrientationPool::GetGlobalRotationAsEulerRadians(OrientationHandle handle) const {
+    return GetGlobalRotationAsQuaternion(handle).ToEulerRadians();
+}
+
+void OrientationPool::ApplyRotation(OrientationHandle handle, Quaternion quaternion) {
+    size_t dense = GetDenseIndex(handle);
+    if (dense != m_size) {
+        ApplyLocal(dense, quaternion);
+    }
+}
+
+void OrientationPool::ApplyRotationDegrees(OrientationHandle handle, Float3 rotationDegrees) {
+    ApplyRotation(handle, Quaternion::FromEulerDegrees(rotationDegrees));
+}
+void OrientationPool::ApplyRotationDegrees_YawAxis(OrientationHandle handle, float yaw) { ApplyRotation_YawAxis(handle, yaw * MathUtility::DEGREES_TO_RADIANS); }
+void OrientationPool::ApplyRotationDegrees_PitchAxis(OrientationHandle handle, float pitch) { ApplyRotation_PitchAxis(handle, pitch * MathUtility::DEGREES_TO_RADIANS); }
+void OrientationPool::ApplyRotationDegrees_RollAxis(OrientationHandle handle, float roll) { ApplyRotation_RollAxis(handle, roll * MathUtility::DEGREES_TO_RADIANS); }
+
+void OrientationPool::ApplyRotation(OrientationHandle handle, Float3 rotationRadians) {
+    ApplyRotation(handle, Quaternion::FromEulerRadians(rotationRadians));
+}
+void OrientationPool::ApplyRotation_YawAxis(OrientationHandle handle, float yaw) {
+    size_t dense = GetDenseIndex(handle);
+    if (dense != m_size) {
+        ApplyRotation_YawAxis(dense, 1, &yaw);
+    }
+}
+
+void OrientationPool::ApplyRotation_PitchAxis(OrientationHandle handle, float pitch) {
+    size_t dense = GetDenseIndex(handle);
+    if (dense != m_size) {
+        ApplyRotation_PitchAxis(dense, 1, &pitch);
+    }
+}
+
+void OrientationPool::ApplyRotation_RollAxis(OrientationHandle handle, float roll) {
+    size_t dense = GetDenseIndex(handle);
+    if (dense != m_size) {
+        ApplyRotation_RollAxis(dense, 1, &roll);
+    }
+}
+
+void OrientationPool::SetRotation(OrientationHandle handle, Quaternion quaternion) {
+    size_t dense = GetDenseIndex(handle);
+    if (dense != m_size) {
+        SetLocal(dense, quaternion);
+    }
+}
+
+void OrientationPool::SetRotation(OrientationHandle handle, Float3 rotationRadians) {
+    SetRotation(handle, Quaternion::FromEulerRadians(rotationRadians));
+}
+
+void OrientationPool::SetGlobalRotation(OrientationHandle handle, Float3 rotationRadians) {
+    Reset(handle);
+    SetRotation(handle, rotationRadians);
+}
+
+void OrientationPool::SetGlobalRotation(OrientationHandle handle, Quaternion quaternion) {
+    Reset(handle);
+    SetRotation(handle, quaternion);
+}
+
+void OrientationPool::Reset(OrientationHandle handle) {
+    size_t dense = GetDenseIndex(handle);
+    if (dense == m_size) {
+        return;
+    }
+    m_local.Set(dense, {});
+    m_parent.Set(dense, {});
+}
+
+void OrientationPool::Recenter(OrientationHandle handle) {
+    size_t dense = GetDenseIndex(handle);
+    if (dense == m_size) {
+        return;
+    }
+    m_parent.Set(dense, m_local.Get(dense).Inversed());
+}
+
+// =====================================================================================================================
+// ===================================================== BY RANGE ======================================================
+// =====================================================================================================================
+
+void OrientationPool::GetGlobalRotationAsQuaternion(size_t first, size_t count, QuaternionBatch &output) const {
+    if (output.Size() != count) {
+        output.Resize(count);
+    }
+
+    // output = parent * local, written as parent copied out and multiplied by local in place
+    for (size_t i = 0; i < count; i++) {
+        output.W()[i] = m_parent.W()[first + i];
+        output.X()[i] = m_parent.X()[first + i];
+        output.Y()[i] = m_parent.Y()[first + i];
+        output.Z()[i] = m_parent.Z()[first + i];
+    }
+    MultiplyInPlace(output.W(), output.X(), output.Y(), output.Z(),
+                    m_local.W() + first, m_local.X() + first, m_local.Y() + first, m_local.Z() + first, count);
+}
+
+void OrientationPool::GetGlobalRotationAsEulerDegrees(size_t first, size_t count, Float3 *output) const {
+    for (size_t i = 0; i < count; i++) {
+        output[i] = (m_parent.Get(first + i) * m_local.Get(first + i)).ToEulerDegrees();
+    }
+}
+
+void OrientationPool::GetGlobalRotationAsEulerRadians(size_t first, size_t count, Float3 *output) const {
+    for (size_t i = 0; i < count; i++) {
+        output[i] = (m_parent.Get(first + i) * m_local.Get(first + i)).ToEulerRadians();
+    }
+}
+
+void OrientationPool::ApplyRotation(size_t first, size_t count, const QuaternionBatch &quaternions) {
+    MultiplyInPlace(m_local.W() + first, m_local.X() + first, m_local.Y() + first, m_local.Z() + first,
+                    quaternions.W(), quaternions.X(), quaternions.Y(), quaternions.Z(), count);
+}
+
+void OrientationPool::ApplyRotation(size_t first, size_t count, Quaternion quaternion) {
+    for (size_t i = first; i < first + count; i++) {
+        ApplyLocal(i, quaternion);
+    }
+}
+
+void OrientationPool::ApplyRotationDegrees(size_t first, size_t count, const Float3 *rotationsDegrees) {
+    for (size_t i = 0; i < count; i++) {
+        ApplyLocal(first + i, Quaternion::FromEulerDegrees(rotationsDegrees[i]));
+    }
+}
+
+void OrientationPool::ApplyRotationDegrees_YawAxis(size_t first, size_t count, const float *yaw) {
+    RotateAxisInPlace(m_local.W() + first, m_local.Z() + first, m_local.X() + first, m_local.Y() + first,
+                      yaw, MathUtility::DEGREES_TO_RADIANS, count);
+}
+
+void OrientationPool::ApplyRotationDegrees_PitchAxis(size_t first, size_t count, const float *pitch) {
+    RotateAxisInPlace(m_local.W() + first, m_local.Y() + first, m_local.Z() + first, m_local.X() + first,
+                      pitch, MathUtility::DEGREES_TO_RADIANS, count);
+}
+
+void OrientationPool::ApplyRotationDegrees_RollAxis(size_t first, size_t count, const float *roll) {
+    RotateAxisInPlace(m_local.W() + first, m_local.X() + first, m_local.Y() + first, m_local.Z() + first,
+                      roll, MathUtility::DEGREES_TO_RADIANS, count);
+}
+
+void OrientationPool::ApplyRotation(size_t first, size_t count, const Float3 *rotationsRadians) {
+    for (size_t i = 0; i < count; i++) {
+        ApplyLocal(first + i, Quaternion::FromEulerRadians(rotationsRadians[i]));
+    }
+}
+
+void OrientationPool::ApplyRotation_YawAxis(size_t first, size_t count, const float *yaw) {
+    RotateAxisInPlace(m_local.W() + first, m_local.Z() + first, m_local.X() + first, m_local.Y() + first,
+                      yaw, 1.0f, count);
+}
+
+void OrientationPool::ApplyRotation_PitchAxis(size_t first, size_t count, const float *pitch) {
+    RotateAxisInPlace(m_local.W() + first, m_local.Y() + first, m_local.Z() + first, m_local.X() + first,
+                      pitch, 1.0f, count);
+}
+
+void OrientationPool::ApplyRotation_RollAxis(size_t first, size_t count, const float *roll) {
+    RotateAxisInPlace(m_local.W() + first, m_local.X() + first, m_local.Y() + first, m_local.Z() + first,
+                      roll, 1.0f, count);
+}
+
+void OrientationPool::SetRotation(size_t first, size_t count, const Float3 *rotationsRadians) {
+    for (size_t i = 0; i < count; i++) {
+        SetLocal(first + i, Quaternion::FromEulerRadians(rotationsRadians[i]));
+    }
+}
+
+void OrientationPool::SetRotation(size_t first, size_t count, const QuaternionBatch &quaternions) {
+    for (size_t i = 0; i < count; i++) {
+        m_local.W()[first + i] = quaternions.W()[i];
+        m_local.X()[first + i] = quaternions.X()[i];
+        m_local.Y()[first + i] = quaternions.Y()[i];
+        m_local.Z()[first + i] = quaternions.Z()[i];
+    }
+}
+
+void OrientationPool::SetGlobalRotation(size_t first, size_t count, const Float3 *rotationsRadians) {
+    Fill(m_parent, first, count, {});
+    SetRotation(first, count, rotationsRadians);
+}
+
+void OrientationPool::SetGlobalRotation(size_t first, size_t count, const QuaternionBatch &quaternions) {
+    Fill(m_parent, first, count, {});
+    SetRotation(first, count, quaternions);
+}
+
+void OrientationPool::Reset(size_t first, size_t count) {
+    Fill(m_local, first, count, {});
+    Fill(m_parent, first, count, {});
+}
+
+void OrientationPool::Recenter(size_t first, size_t count) {
+    // The inverse of a unit Quaternion is its conjugate
+    for (size_t i = first; i < first + count; i++) {
+        m_parent.W()[i] = m_local.W()[i];
+        m_parent.X()[i] = -m_local.X()[i];
+        m_parent.Y()[i] = -m_local.Y()[i];
+        m_parent.Z()[i] = -m_local.Z()[i];
+    }
+}
@@ -0,0 +1,161 @@
+#include "m1_mathematics/OrientationResampler.h"
+
+#include <algorithm>
+
+using namespace Mach1;
+
+OrientationResampler::OrientationResampler(size_t track_count, double output_rate,
+                                           Interpolation interpolation, size_t history_capacity)
+        : m_trackCount(track_count),
+          m_capacity(std::max<size_t>(history_capacity, 4)),
+          m_outputRate(output_rate),
+          m_interpolation(interpolation),
+          m_outputStartTime(0.0),
+          m_framesProduced(0),
+          m_times(track_count * m_capacity, 0.0),
+          m_samples(track_count * m_capacity),
+          m_head(track_count, 0),
+          m_count(track_count, 0),
+          m_cursor(track_count, 0) {
+}
+
+size_t OrientationResampler::GetTrackCount() const {
+    return m_trackCount;
+}
+
+double OrientationResampler::GetOutputRate() const {
+    return m_outputRate;
+}
+
+OrientationResampler::Interpolation OrientationResampler::GetInterpolation() const {
+    return m_interpolation;
+}
+
+double OrientationResampler::GetOutputTime() const {
+    // Derived from a frame counter rather than accumulated, so the clock does not drift over long sessions
+    return m_outputStartTime + static_cast<double>(m_framesProduced) / m_outputRate;
+}
+
+void OrientationResampler::SetOutputTime(double time) {
+    m_outputStartTime = time;
+    m_framesProduced = 0;
+}
+
+size_t OrientationResampler::GetPendingSampleCount(size_t track) const {
+    return m_count[track];
+}
+
+size_t OrientationResampler::SlotOf(size_t track, size_t offset) const {
+    return track * m_capacity + (m_head[track] + offset) % m_capacity;
+}
+
+void OrientationResampler::DropOldest(size_t track) {
+    m_head[track] = (m_head[track] + 1) % m_capacity;
+    m_count[track]--;
+    if (m_cursor[track] > 0) {
+        m_cursor[track]--;
+    }
+}
+
+bool OrientationResampler::PushSample(size_t track, double timestamp, Quaternion quaternion) {
+    size_t count = m_count[track];
+
+    if (count > 0) {
+        size_t latest = SlotOf(track, count - 1);
+        if (!(timestamp > m_times[latest])) {
+            return false;
+        }
+
+        // Keep consecutive samples in the same hemisphere, so interpolation never takes the long way around
+        if (m_samples.Get(latest).DotProduct(quaternion) < 0) {
+            quaternion *= -1.0f;
+        }
+    }
+
+    if (count == m_capacity) {
+        DropOldest(track);
+    }
+
+    size_t slot = SlotOf(track, m_count[track]);
+    m_times[slot] = timestamp;
+    m_samples.Set(slot, quaternion);
+    m_count[track]++;
+    return true;
+}
+
+Quaternion OrientationResampler::Evaluate(size_t track, double time) {
+    size_t count = m_count[track];
+    if (count == 0) {
+        return {};
+    }
+
+    size_t cursor = m_cursor[track];
+    while (cursor + 1 < count && m_times[SlotOf(track, cursor + 1)] <= time) {
+        cursor++;
+    }
+    m_cursor[track] = cursor;
+
+    // Only the segment start and one sample before it (squad's incoming tangent) are still needed
+    while (m_cursor[track] > 1) {
+        DropOldest(track);
+    }
+    cursor = m_cursor[track];
+    count = m_count[track];
+
+    size_t start_slot = SlotOf(track, cursor);
+    Quaternion start = m_samples.Get(start_slot);
+
+    if (cursor + 1 == count || time <= m_times[start_slot]) {
+        return start;
+    }
+
+    size_t end_slot = SlotOf(track, cursor + 1);
+    Quaternion end = m_samples.Get(end_slot);
+    float t = static_cast<float>((time - m_times[start_slot]) / (m_times[end_slot] - m_times[start_slot]));
+
+    if (m_interpolation == Interpolation::Slerp) {
+        return Quaternion::Slerp(start, end, t);
+    }
+
+    // Missing neighbours at either end of the history are replaced by the segment's own endpoints
+    Quaternion previous = (cursor > 0) ? m_samples.Get(SlotOf(track, cursor - 1)) : start;
+    Quaternion next = (cursor + 2 < count) ? m_samples.Get(SlotOf(track, cursor + 2)) : end;
+
+    Quaternion start_control = Quaternion::SquadControlPoint(previous, start, end);
+    Quaternion end_control = Quaternion::SquadControlPoint(start, end, next);
+    return Quaternion::Squad(start, end, start_control, end_control, t);
+}
+
+void OrientationResampler::Process(size_t frame_count, QuaternionBatch &output) {
+    if (output.Size() != frame_count * m_trackCount) {
+        output.Resize(frame_count * m_trackCount);
+    }
+
+    float *out_w = output.W();
+    float *out_x = output.X();
+    float *out_y = output.Y();
+    float *out_z = output.Z();
+
+    for (size_t frame = 0; frame < frame_count; frame++) {
+        double time = GetOutputTime();
+        size_t frame_offset = frame * m_trackCount;
+
+        for (size_t track = 0; track < m_trackCount; track++) {
+            Quaternion q = Evaluate(track, time);
+            out_w[frame_offset + track] = q.GetW();
+            out_x[frame_offset + track] = q.GetX();
+            out_y[frame_offset + track] = q.GetY();
+            out_z[frame_offset + track] = q.GetZ();
+        }
+
+        m_framesProduced++;
+    }
+}
+
+void OrientationResampler::Reset() {
+    std::fill(m_head.begin(), m_head.end(), 0);
+    std::fill(m_count.begin(), m_count.end(), 0);
+    std::fill(m_cursor.begin(), m_cursor.end(), 0);
+    m_outputStartTime = 0.0;
+    m_framesProduced = 0;
+}
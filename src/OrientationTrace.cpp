@@ -0,0 +1,193 @@
+#include "m1_mathematics/OrientationTrace.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <istream>
+#include <ostream>
+#include <sstream>
+
+using namespace Mach1;
+
+namespace {
+
+struct TypeInfo {
+    OrientationTraceEvent::Type type;
+    const char *name;
+    int value_count;
+};
+
+const TypeInfo TYPE_INFO[] = {
+        {OrientationTraceEvent::Type::ApplyRotation,            "apply",           4},
+        {OrientationTraceEvent::Type::ApplyRotationRadians,     "apply_euler",     3},
+        {OrientationTraceEvent::Type::ApplyRotationDegrees,     "apply_euler_deg", 3},
+        {OrientationTraceEvent::Type::ApplyRotationYaw,         "apply_yaw",       1},
+        {OrientationTraceEvent::Type::ApplyRotationPitch,       "apply_pitch",     1},
+        {OrientationTraceEvent::Type::ApplyRotationRoll,        "apply_roll",      1},
+        {OrientationTraceEvent::Type::SetRotation,              "set",             4},
+        {OrientationTraceEvent::Type::SetGlobalRotation,        "set_global",      4},
+        {OrientationTraceEvent::Type::Recenter,                 "recenter",        0},
+        {OrientationTraceEvent::Type::Reset,                    "reset",           0},
+        {OrientationTraceEvent::Type::GetGlobalRotation,        "get",             0},
+        {OrientationTraceEvent::Type::GetGlobalRotationDegrees, "get_euler_deg",   0},
+};
+
+const TypeInfo &GetTypeInfo(OrientationTraceEvent::Type type) {
+    return TYPE_INFO[static_cast<size_t>(type)];
+}
+
+const TypeInfo *FindTypeInfo(const std::string &name) {
+    for (const TypeInfo &info : TYPE_INFO) {
+        if (name == info.name) {
+            return &info;
+        }
+    }
+    return nullptr;
+}
+
+Quaternion ToQuaternion(const float *values) {
+    return {values[0], values[1], values[2], values[3]};
+}
+
+} // namespace
+
+void OrientationTrace::Add(const OrientationTraceEvent &event) {
+    m_events.push_back(event);
+    m_object_count = std::max<size_t>(m_object_count, static_cast<size_t>(event.object) + 1);
+}
+
+void OrientationTrace::Add(uint64_t timestamp_us, uint32_t object, OrientationTraceEvent::Type type,
+                           float v0, float v1, float v2, float v3) {
+    OrientationTraceEvent event;
+    event.timestamp_us = timestamp_us;
+    event.object = object;
+    event.type = type;
+    event.values[0] = v0;
+    event.values[1] = v1;
+    event.values[2] = v2;
+    event.values[3] = v3;
+    Add(event);
+}
+
+void OrientationTrace::Clear() {
+    m_events.clear();
+    m_object_count = 0;
+}
+
+size_t OrientationTrace::Size() const {
+    return m_events.size();
+}
+
+size_t OrientationTrace::ObjectCount() const {
+    return m_object_count;
+}
+
+const std::vector<OrientationTraceEvent> &OrientationTrace::GetEvents() const {
+    return m_events;
+}
+
+bool OrientationTrace::Read(std::istream &stream, std::string *error) {
+    Clear();
+
+    std::string line;
+    size_t line_number = 0;
+    while (std::getline(stream, line)) {
+        line_number++;
+
+        size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        OrientationTraceEvent event;
+        std::string name;
+        bool valid = static_cast<bool>(fields >> event.timestamp_us >> event.object >> name);
+
+        const TypeInfo *info = valid ? FindTypeInfo(name) : nullptr;
+        if (info) {
+            event.type = info->type;
+            for (int i = 0; i < info->value_count && valid; i++) {
+                valid = static_cast<bool>(fields >> event.values[i]);
+            }
+            std::string trailing;
+            valid = valid && !(fields >> trailing);
+        }
+
+        if (!valid || !info) {
+            if (error) {
+                *error = "line " + std::to_string(line_number) + ": cannot parse \"" + line + "\"";
+            }
+            Clear();
+            return false;
+        }
+        Add(event);
+    }
+    return true;
+}
+
+void OrientationTrace::Write(std::ostream &stream) const {
+    // Nine significant digits round-trip every float exactly
+    std::ios::fmtflags flags = stream.flags();
+    std::streamsize precision = stream.precision(9);
+
+    for (const OrientationTraceEvent &event : m_events) {
+        const TypeInfo &info = GetTypeInfo(event.type);
+        stream << event.timestamp_us << ' ' << event.object << ' ' << info.name;
+        for (int i = 0; i < info.value_count; i++) {
+            stream << ' ' << event.values[i];
+        }
+        stream << '\n';
+    }
+
+    stream.precision(precision);
+    stream.flags(flags);
+}
+
+const char *OrientationTrace::GetTypeName(OrientationTraceEvent::Type type) {
+    return GetTypeInfo(type).name;
+}
+
+float OrientationTrace::Apply(const OrientationTraceEvent &event, Orientation &orientation) {
+    const float *v = event.values;
+    switch (event.type) {
+        case OrientationTraceEvent::Type::ApplyRotation:
+            orientation.ApplyRotation(ToQuaternion(v));
+            break;
+        case OrientationTraceEvent::Type::ApplyRotationRadians:
+            orientation.ApplyRotation(Float3(v[0], v[1], v[2]));
+            break;
+        case OrientationTraceEvent::Type::ApplyRotationDegrees:
+            orientation.ApplyRotationDegrees(Float3(v[0], v[1], v[2]));
+            break;
+        case OrientationTraceEvent::Type::ApplyRotationYaw:
+            orientation.ApplyRotation_YawAxis(v[0]);
+            break;
+        case OrientationTraceEvent::Type::ApplyRotationPitch:
+            orientation.ApplyRotation_PitchAxis(v[0]);
+            break;
+        case OrientationTraceEvent::Type::ApplyRotationRoll:
+            orientation.ApplyRotation_RollAxis(v[0]);
+            break;
+        case OrientationTraceEvent::Type::SetRotation:
+            orientation.SetRotation(ToQuaternion(v));
+            break;
+        case OrientationTraceEvent::Type::SetGlobalRotation:
+            orientation.SetGlobalRotation(ToQuaternion(v));
+            break;
+        case OrientationTraceEvent::Type::Recenter:
+            orientation.Recenter();
+            break;
+        case OrientationTraceEvent::Type::Reset:
+            orientation.Reset();
+            break;
+        case OrientationTraceEvent::Type::GetGlobalRotation: {
+            Quaternion q = orientation.GetGlobalRotationAsQuaternion();
+            return q.GetW() + q.GetX() + q.GetY() + q.GetZ();
+        }
+        case OrientationTraceEvent::Type::GetGlobalRotationDegrees: {
+            Float3 euler = orientation.GetGlobalRotationAsEulerDegrees();
+            return euler.GetYaw() + euler.GetPitch() + euler.GetRoll();
+        }
+    }
+    return 0;
+}
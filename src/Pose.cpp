@@ -0,0 +1,56 @@
+#include "m1_mathematics/Pose.h"
+
+using namespace Mach1;
+
+Pose::Pose() : m_local(), m_parent() {
+}
+
+Pose::Pose(const Orientation &orientation, Float3 position)
+        : m_local(DualQuaternion::FromOrientation(orientation, position)), m_parent() {
+}
+
+DualQuaternion Pose::GetGlobalTransform() const {
+    return m_parent * m_local;
+}
+
+Quaternion Pose::GetGlobalRotationAsQuaternion() const {
+    return GetGlobalTransform().GetRotation();
+}
+
+Float3 Pose::GetGlobalPosition() const {
+    return GetGlobalTransform().GetTranslation();
+}
+
+void Pose::ApplyTransform(DualQuaternion transform) {
+    m_local *= transform;
+}
+
+void Pose::ApplyRotation(Quaternion quaternion) {
+    m_local *= DualQuaternion::FromRotation(quaternion);
+}
+
+void Pose::ApplyTranslation(Float3 translation) {
+    m_local *= DualQuaternion::FromTranslation(translation);
+}
+
+void Pose::SetTransform(DualQuaternion transform) {
+    m_local = transform;
+}
+
+void Pose::SetTransform(Quaternion rotation, Float3 position) {
+    SetTransform(DualQuaternion::FromRotationTranslation(rotation, position));
+}
+
+void Pose::SetGlobalTransform(DualQuaternion transform) {
+    Reset();
+    SetTransform(transform);
+}
+
+void Pose::Reset() {
+    m_local = {};
+    m_parent = {};
+}
+
+void Pose::Recenter() {
+    m_parent = m_local.Inversed();
+}
@@ -0,0 +1,320 @@
+#include "m1_mathematics/Profiler.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define M1_PROFILER_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define M1_PROFILER_RDTSC 1
+#endif
+
+using namespace Mach1;
+
+namespace {
+
+constexpr size_t KERNEL_COUNT = static_cast<size_t>(Profiler::Kernel::Count);
+
+enum Counter {
+    CYCLES,
+    INSTRUCTIONS,
+    CACHE_MISSES,
+    COUNTER_COUNT
+};
+
+// Static atomics are zero-initialized, so Scopes in other translation units' static constructors are safe
+std::atomic<uint64_t> g_calls[KERNEL_COUNT];
+std::atomic<uint64_t> g_counts[KERNEL_COUNT][COUNTER_COUNT];
+
+struct Capabilities {
+    Profiler::Backend backend;
+    bool counters[COUNTER_COUNT];
+};
+
+#if defined(__linux__)
+uint64_t HardwareConfig(Counter counter) {
+    switch (counter) {
+        case INSTRUCTIONS:
+            return PERF_COUNT_HW_INSTRUCTIONS;
+        case CACHE_MISSES:
+            return PERF_COUNT_HW_CACHE_MISSES;
+        default:
+            return PERF_COUNT_HW_CPU_CYCLES;
+    }
+}
+
+/**
+ * Open a user-space counter on the calling thread, joining the group of `group_fd` unless it is -1
+ */
+int OpenCounter(Counter counter, int group_fd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = HardwareConfig(counter);
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+#endif
+
+Capabilities Probe() {
+    Capabilities capabilities{};
+#if defined(__linux__)
+    int leader = OpenCounter(CYCLES, -1);
+    if (leader >= 0) {
+        capabilities.backend = Profiler::Backend::PerfEvent;
+        capabilities.counters[CYCLES] = true;
+        for (Counter counter : {INSTRUCTIONS, CACHE_MISSES}) {
+            int fd = OpenCounter(counter, leader);
+            capabilities.counters[counter] = fd >= 0;
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+        close(leader);
+        return capabilities;
+    }
+#endif
+#if defined(M1_PROFILER_RDTSC)
+    capabilities.backend = Profiler::Backend::Rdtsc;
+#else
+    capabilities.backend = Profiler::Backend::SteadyClock;
+#endif
+    capabilities.counters[CYCLES] = true;
+    return capabilities;
+}
+
+const Capabilities &GetCapabilities() {
+    static const Capabilities capabilities = Probe();
+    return capabilities;
+}
+
+uint64_t Timestamp() {
+#if defined(M1_PROFILER_RDTSC)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/**
+ * The calling thread's perf_event group, or the timestamp counter when perf_event is unavailable
+ */
+class ThreadCounters {
+public:
+    constexpr ThreadCounters() : m_attached(false), m_leader(-1), m_fds{-1, -1, -1}, m_slots{-1, -1, -1} {}
+
+    ~ThreadCounters() {
+#if defined(__linux__)
+        for (int fd : m_fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    ThreadCounters(const ThreadCounters &) = delete;
+    ThreadCounters &operator=(const ThreadCounters &) = delete;
+
+    void Attach() {
+        if (m_attached) {
+            return;
+        }
+        m_attached = true;
+
+#if defined(__linux__)
+        const Capabilities &capabilities = GetCapabilities();
+        if (capabilities.backend != Profiler::Backend::PerfEvent) {
+            return;
+        }
+
+        // Group members are read in the order they were opened
+        int slot = 0;
+        for (Counter counter : {CYCLES, INSTRUCTIONS, CACHE_MISSES}) {
+            if (!capabilities.counters[counter]) {
+                continue;
+            }
+            m_fds[counter] = OpenCounter(counter, m_leader);
+            if (m_fds[counter] < 0) {
+                if (counter == CYCLES) {
+                    return;
+                }
+                continue;
+            }
+            if (counter == CYCLES) {
+                m_leader = m_fds[counter];
+            }
+            m_slots[counter] = slot++;
+        }
+#endif
+    }
+
+    void Read(uint64_t *values) {
+        Attach();
+
+#if defined(__linux__)
+        if (m_leader >= 0) {
+            uint64_t group[1 + COUNTER_COUNT] = {};
+            if (read(m_leader, group, sizeof(group)) <= 0) {
+                std::memset(values, 0, sizeof(uint64_t) * COUNTER_COUNT);
+                return;
+            }
+            for (int counter = 0; counter < COUNTER_COUNT; counter++) {
+                values[counter] = m_slots[counter] >= 0 ? group[1 + m_slots[counter]] : 0;
+            }
+            return;
+        }
+#endif
+        values[CYCLES] = Timestamp();
+        values[INSTRUCTIONS] = 0;
+        values[CACHE_MISSES] = 0;
+    }
+
+private:
+    bool m_attached;
+    int m_leader;
+    int m_fds[COUNTER_COUNT];
+    int m_slots[COUNTER_COUNT];
+};
+
+thread_local ThreadCounters t_counters;
+
+} // namespace
+
+Profiler::Scope::Scope(Kernel kernel) : m_kernel(kernel), m_start{} {
+    t_counters.Read(m_start);
+}
+
+Profiler::Scope::~Scope() {
+    uint64_t end[COUNTER_COUNT];
+    t_counters.Read(end);
+
+    size_t kernel = static_cast<size_t>(m_kernel);
+    g_calls[kernel].fetch_add(1, std::memory_order_relaxed);
+    for (int counter = 0; counter < COUNTER_COUNT; counter++) {
+        g_counts[kernel][counter].fetch_add(end[counter] - m_start[counter], std::memory_order_relaxed);
+    }
+}
+
+bool Profiler::IsEnabled() {
+#if defined(M1_MATHEMATICS_PROFILING)
+    return true;
+#else
+    return false;
+#endif
+}
+
+Profiler::Backend Profiler::GetBackend() {
+    return GetCapabilities().backend;
+}
+
+bool Profiler::HasInstructions() {
+    return GetCapabilities().counters[INSTRUCTIONS];
+}
+
+bool Profiler::HasCacheMisses() {
+    return GetCapabilities().counters[CACHE_MISSES];
+}
+
+void Profiler::AttachThread() {
+    t_counters.Attach();
+}
+
+const char *Profiler::GetKernelName(Kernel kernel) {
+    switch (kernel) {
+        case Kernel::QuaternionMultiply:
+            return "Quaternion::operator*=";
+        case Kernel::QuaternionFromEulerRadians:
+            return "Quaternion::FromEulerRadians";
+        case Kernel::QuaternionToEulerRadians:
+            return "Quaternion::ToEulerRadians";
+        case Kernel::Float3Normalized:
+            return "Float3::Normalized";
+        default:
+            return "unknown";
+    }
+}
+
+const char *Profiler::GetBackendName(Backend backend) {
+    switch (backend) {
+        case Backend::PerfEvent:
+            return "perf_event";
+        case Backend::Rdtsc:
+            return "rdtsc";
+        default:
+            return "steady_clock";
+    }
+}
+
+Profiler::KernelStats Profiler::GetStats(Kernel kernel) {
+    size_t index = static_cast<size_t>(kernel);
+    KernelStats stats;
+    stats.calls = g_calls[index].load(std::memory_order_relaxed);
+    stats.cycles = g_counts[index][CYCLES].load(std::memory_order_relaxed);
+    stats.instructions = g_counts[index][INSTRUCTIONS].load(std::memory_order_relaxed);
+    stats.cache_misses = g_counts[index][CACHE_MISSES].load(std::memory_order_relaxed);
+    return stats;
+}
+
+void Profiler::Reset() {
+    for (size_t kernel = 0; kernel < KERNEL_COUNT; kernel++) {
+        g_calls[kernel].store(0, std::memory_order_relaxed);
+        for (int counter = 0; counter < COUNTER_COUNT; counter++) {
+            g_counts[kernel][counter].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+void Profiler::WriteJson(std::ostream &stream) {
+    bool has_instructions = HasInstructions();
+    bool has_cache_misses = HasCacheMisses();
+
+    stream << "{\"enabled\": " << (IsEnabled() ? "true" : "false")
+           << ", \"backend\": \"" << GetBackendName(GetBackend()) << "\", \"kernels\": {";
+
+    for (size_t index = 0; index < KERNEL_COUNT; index++) {
+        Kernel kernel = static_cast<Kernel>(index);
+        KernelStats stats = GetStats(kernel);
+
+        stream << (index ? ", " : "") << "\"" << GetKernelName(kernel) << "\": {"
+               << "\"calls\": " << stats.calls
+               << ", \"cycles\": " << stats.cycles
+               << ", \"cycles_per_call\": " << stats.CyclesPerCall();
+
+        stream << ", \"instructions\": ";
+        if (has_instructions) {
+            stream << stats.instructions << ", \"instructions_per_call\": " << stats.InstructionsPerCall();
+        } else {
+            stream << "null, \"instructions_per_call\": null";
+        }
+
+        stream << ", \"cache_misses\": ";
+        if (has_cache_misses) {
+            stream << stats.cache_misses << ", \"cache_misses_per_call\": " << stats.CacheMissesPerCall();
+        } else {
+            stream << "null, \"cache_misses_per_call\": null";
+        }
+        stream << "}";
+    }
+    stream << "}}";
+}
+
+std::string Profiler::ToJson() {
+    std::stringstream s;
+    WriteJson(s);
+    return s.str();
+}
@@ -1,10 +1,17 @@
 #include "m1_mathematics/Quaternion.h"
 
+#include <algorithm>
 #include <cmath>
 #include <sstream>
 
 #include "m1_mathematics/Float3.h"
 #include "m1_mathematics/MathUtility.h"
+#include "m1_mathematics/Profiler.h"
+#include "m1_mathematics/RealtimeSafety.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
 
 #ifndef M_PI_2
 #define M_PI_2 1.57079632679489661923
@@ -12,11 +19,9 @@
 
 using namespace Mach1;
 
-Quaternion::Quaternion() : m_qw(1.0), m_qx(0.0), m_qy(0.0), m_qz(0.0) {}
-
-Quaternion::Quaternion(float qw, float qx, float qy, float qz) : m_qw(qw), m_qx(qx), m_qy(qy), m_qz(qz) {}
-
 Quaternion Quaternion::FromEulerRadians(Float3 euler_vector) {
+    M1_PROFILE_KERNEL(QuaternionFromEulerRadians);
+
     // Convert to half angles
     float yaw = euler_vector[0] * 0.5f;
     float pitch = euler_vector[1] * 0.5f;
@@ -43,7 +48,268 @@ Quaternion Quaternion::FromEulerDegrees(Float3 euler_vector) {
     return Quaternion::FromEulerRadians(euler_vector.EulerRadians());
 }
 
+Quaternion Quaternion::FromAxisAngle(Float3 axis, float angle) {
+    float length = axis.Length();
+    if (length == 0) {
+        return {};
+    }
+
+    float scale = std::sin(angle * 0.5f) / length;
+    return {std::cos(angle * 0.5f), axis.GetRoll() * scale, axis.GetPitch() * scale, axis.GetYaw() * scale};
+}
+
+void Quaternion::ToAxisAngle(Float3 &axis, float &angle) const {
+    // q and -q are the same rotation; taking w >= 0 keeps the angle within [0, PI]
+    float sign = (m_qw < 0) ? -1.0f : 1.0f;
+    float vector_length = std::sqrt(m_qx * m_qx + m_qy * m_qy + m_qz * m_qz);
+
+    angle = 2.0f * std::atan2(vector_length, m_qw * sign);
+
+    if (vector_length == 0) {
+        axis = {0.0f, 0.0f, 1.0f};
+        return;
+    }
+
+    float scale = sign / vector_length;
+    axis = {m_qz * scale, m_qy * scale, m_qx * scale};
+}
+
+Quaternion Quaternion::FromRotationVector(Float3 rotation_vector) {
+    float yaw = rotation_vector.GetYaw();
+    float pitch = rotation_vector.GetPitch();
+    float roll = rotation_vector.GetRoll();
+    float theta_squared = yaw * yaw + pitch * pitch + roll * roll;
+
+    float w;
+    float scale; // sin(theta / 2) / theta
+    if (theta_squared < 1e-4f) {
+        // Taylor series of cos(theta / 2) and sin(theta / 2) / theta; the next terms are below float precision
+        w = 1.0f - theta_squared * (1.0f / 8.0f) + theta_squared * theta_squared * (1.0f / 384.0f);
+        scale = 0.5f - theta_squared * (1.0f / 48.0f) + theta_squared * theta_squared * (1.0f / 3840.0f);
+    } else {
+        float theta = std::sqrt(theta_squared);
+        w = std::cos(theta * 0.5f);
+        scale = std::sin(theta * 0.5f) / theta;
+    }
+
+    return {w, roll * scale, pitch * scale, yaw * scale};
+}
+
+Float3 Quaternion::ToRotationVector() const {
+    // Take w >= 0, so that the shorter of the two equivalent rotations is reported
+    float sign = (m_qw < 0) ? -1.0f : 1.0f;
+    float w = m_qw * sign;
+    float vector_length_squared = m_qx * m_qx + m_qy * m_qy + m_qz * m_qz;
+
+    float scale; // theta / |v|
+    if (vector_length_squared < 1e-6f * w * w) {
+        // Taylor series of 2 * atan(s / w) / s around s = 0
+        scale = 2.0f / w * (1.0f - vector_length_squared / (3.0f * w * w));
+    } else {
+        float vector_length = std::sqrt(vector_length_squared);
+        scale = 2.0f * std::atan2(vector_length, w) / vector_length;
+    }
+
+    scale *= sign;
+    return {m_qz * scale, m_qy * scale, m_qx * scale};
+}
+
+void Quaternion::ToSwingTwist(Float3 axis, Quaternion &swing, Quaternion &twist) const {
+    // A zero axis projects nothing, leaving a twist of +-1 and the whole rotation as swing
+    float axis_length = axis.Length();
+    float axis_scale = axis_length == 0 ? 0.0f : 1.0f / axis_length;
+    float ax = axis.GetRoll() * axis_scale;
+    float ay = axis.GetPitch() * axis_scale;
+    float az = axis.GetYaw() * axis_scale;
+
+    // The twist is this Quaternion with its vector part projected onto the axis, renormalized
+    float projection = m_qx * ax + m_qy * ay + m_qz * az;
+    float twist_length = std::sqrt(m_qw * m_qw + projection * projection);
+    if (twist_length < MathUtility::FLOAT_COMPARISON_EPSILON) {
+        swing = *this;
+        twist = {};
+        return;
+    }
+
+    float scale = projection / twist_length;
+    twist = {m_qw / twist_length, ax * scale, ay * scale, az * scale};
+    swing = *this * twist.Inversed();
+}
+
+Quaternion Quaternion::ClampedSwingTwist(Float3 axis, float max_swing, float min_twist, float max_twist) const {
+    Quaternion swing;
+    Quaternion twist;
+    ToSwingTwist(axis, swing, twist);
+
+    float pi = static_cast<float>(M_PI);
+    float half_max_swing = std::min(std::max(max_swing, 0.0f), pi) * 0.5f;
+    float half_min_twist = std::min(std::max(min_twist, -pi), pi) * 0.5f;
+    float half_max_twist = std::min(std::max(max_twist, -pi), pi) * 0.5f;
+
+    // Swing w is cos(swing / 2), never negative; a smaller w is a wider swing
+    float cos_max_swing = std::cos(half_max_swing);
+    if (swing.m_qw < cos_max_swing) {
+        float vector_length = std::sqrt(swing.m_qx * swing.m_qx + swing.m_qy * swing.m_qy + swing.m_qz * swing.m_qz);
+        if (vector_length > 0) {
+            float scale = std::sin(half_max_swing) / vector_length;
+            swing = {cos_max_swing, swing.m_qx * scale, swing.m_qy * scale, swing.m_qz * scale};
+        }
+    }
+
+    // Twist is (cos(t / 2), sin(t / 2) * axis); with w >= 0 its half angle lies within [-PI/2, PI/2], where the sign of
+    // sin(t / 2 - limit / 2) orders it against a limit without an atan2
+    float axis_length = axis.Length();
+    if (axis_length > 0) {
+        float ax = axis.GetRoll() / axis_length;
+        float ay = axis.GetPitch() / axis_length;
+        float az = axis.GetYaw() / axis_length;
+
+        float sign = (twist.m_qw < 0) ? -1.0f : 1.0f;
+        float twist_cos = twist.m_qw * sign;
+        float twist_sin = (twist.m_qx * ax + twist.m_qy * ay + twist.m_qz * az) * sign;
+
+        float limit = 0.0f;
+        bool clamped = false;
+        if (twist_sin * std::cos(half_max_twist) > twist_cos * std::sin(half_max_twist)) {
+            limit = half_max_twist;
+            clamped = true;
+        } else if (twist_sin * std::cos(half_min_twist) < twist_cos * std::sin(half_min_twist)) {
+            limit = half_min_twist;
+            clamped = true;
+        }
+
+        if (clamped) {
+            float limit_sin = std::sin(limit);
+            twist = {std::cos(limit), ax * limit_sin, ay * limit_sin, az * limit_sin};
+        }
+    }
+
+    return swing * twist;
+}
+
+Quaternion Quaternion::FromYawRadians(float yaw) {
+    return {std::cos(yaw * 0.5f), 0.0f, 0.0f, std::sin(yaw * 0.5f)};
+}
+
+Quaternion Quaternion::FromPitchRadians(float pitch) {
+    return {std::cos(pitch * 0.5f), 0.0f, std::sin(pitch * 0.5f), 0.0f};
+}
+
+Quaternion Quaternion::FromRollRadians(float roll) {
+    return {std::cos(roll * 0.5f), std::sin(roll * 0.5f), 0.0f, 0.0f};
+}
+
+// The sparse products below are operator*= with the rhs fixed to (c, 0, 0, s), (c, 0, s, 0) and (c, s, 0, 0)
+
+void Quaternion::RotateYaw(float yaw) {
+    float c = std::cos(yaw * 0.5f);
+    float s = std::sin(yaw * 0.5f);
+    float qw = m_qw * c - m_qz * s;
+    float qx = m_qx * c + m_qy * s;
+    float qy = m_qy * c - m_qx * s;
+    m_qz = m_qz * c + m_qw * s;
+    m_qw = qw;
+    m_qx = qx;
+    m_qy = qy;
+}
+
+void Quaternion::RotatePitch(float pitch) {
+    float c = std::cos(pitch * 0.5f);
+    float s = std::sin(pitch * 0.5f);
+    float qw = m_qw * c - m_qy * s;
+    float qx = m_qx * c - m_qz * s;
+    float qy = m_qy * c + m_qw * s;
+    m_qz = m_qz * c + m_qx * s;
+    m_qw = qw;
+    m_qx = qx;
+    m_qy = qy;
+}
+
+void Quaternion::RotateRoll(float roll) {
+    float c = std::cos(roll * 0.5f);
+    float s = std::sin(roll * 0.5f);
+    float qw = m_qw * c - m_qx * s;
+    float qx = m_qx * c + m_qw * s;
+    float qy = m_qy * c + m_qz * s;
+    m_qz = m_qz * c - m_qy * s;
+    m_qw = qw;
+    m_qx = qx;
+    m_qy = qy;
+}
+
+namespace {
+
+/**
+ * Slerp without the shortest-arc sign flip, which squad relies on for its inner interpolations
+ */
+Quaternion SlerpOnArc(Quaternion from, Quaternion to, float cos_theta, float t) {
+    if (cos_theta > MathUtility::FLOAT_COMPARISON_ONE_MINUS_EPSILON) {
+        // Nearly parallel, sin(theta) vanishes: fall back to a normalized lerp
+        return (from * (1.0f - t) + to * t).Normalized();
+    }
+
+    float theta = std::acos(std::fmin(cos_theta, 1.0f));
+    float sin_theta = std::sin(theta);
+    float from_weight = std::sin((1.0f - t) * theta) / sin_theta;
+    float to_weight = std::sin(t * theta) / sin_theta;
+    return from * from_weight + to * to_weight;
+}
+
+} // namespace
+
+Quaternion Quaternion::Slerp(Quaternion from, Quaternion to, float t) {
+    float cos_theta = from.DotProduct(to);
+
+    // q and -q are the same rotation, so take whichever of the two arcs is shorter
+    if (cos_theta < 0) {
+        to = to * -1.0f;
+        cos_theta = -cos_theta;
+    }
+
+    return SlerpOnArc(from, to, cos_theta, t);
+}
+
+Quaternion Quaternion::Squad(Quaternion q1, Quaternion q2, Quaternion s1, Quaternion s2, float t) {
+    Quaternion outer = SlerpOnArc(q1, q2, q1.DotProduct(q2), t);
+    Quaternion inner = SlerpOnArc(s1, s2, s1.DotProduct(s2), t);
+    return SlerpOnArc(outer, inner, outer.DotProduct(inner), 2.0f * t * (1.0f - t));
+}
+
+Quaternion Quaternion::SquadControlPoint(Quaternion previous, Quaternion current, Quaternion next) {
+    Quaternion inverse = current.Inversed();
+    Quaternion to_next = (inverse * next).Log();
+    Quaternion to_previous = (inverse * previous).Log();
+    return current * ((to_next + to_previous) * -0.25f).Exp();
+}
+
+Quaternion Quaternion::Log() const {
+    float vector_length = std::sqrt(m_qx * m_qx + m_qy * m_qy + m_qz * m_qz);
+
+    if (vector_length < MathUtility::FLOAT_COMPARISON_EPSILON) {
+        // theta / sin(theta) -> 1 as theta -> 0
+        return {0.0f, m_qx, m_qy, m_qz};
+    }
+
+    float theta = std::atan2(vector_length, m_qw);
+    float scale = theta / vector_length;
+    return {0.0f, m_qx * scale, m_qy * scale, m_qz * scale};
+}
+
+Quaternion Quaternion::Exp() const {
+    float theta = std::sqrt(m_qx * m_qx + m_qy * m_qy + m_qz * m_qz);
+
+    if (theta < MathUtility::FLOAT_COMPARISON_EPSILON) {
+        // sin(theta) / theta -> 1 as theta -> 0
+        return Quaternion(1.0f, m_qx, m_qy, m_qz).Normalized();
+    }
+
+    float scale = std::sin(theta) / theta;
+    return {std::cos(theta), m_qx * scale, m_qy * scale, m_qz * scale};
+}
+
 Float3 Quaternion::ToEulerRadians() {
+    M1_PROFILE_KERNEL(QuaternionToEulerRadians);
+
     // Normalize the quaternion
     float norm = sqrt(m_qw * m_qw + m_qx * m_qx + m_qy * m_qy + m_qz * m_qz);
     float qw = m_qw / norm;
@@ -78,6 +344,23 @@ Float3 Quaternion::ToEulerDegrees() {
     return ToEulerRadians().EulerDegrees();
 }
 
+Float3 Quaternion::Rotate(Float3 vector) const {
+    // v' = v + 2w (u x v) + 2 u x (u x v), where u is the vector part; vector components are ordered (z, y, x)
+    float vx = vector.GetRoll();
+    float vy = vector.GetPitch();
+    float vz = vector.GetYaw();
+
+    float tx = 2.0f * (m_qy * vz - m_qz * vy);
+    float ty = 2.0f * (m_qz * vx - m_qx * vz);
+    float tz = 2.0f * (m_qx * vy - m_qy * vx);
+
+    float rx = vx + m_qw * tx + (m_qy * tz - m_qz * ty);
+    float ry = vy + m_qw * ty + (m_qz * tx - m_qx * tz);
+    float rz = vz + m_qw * tz + (m_qx * ty - m_qy * tx);
+
+    return {rz, ry, rx};
+}
+
 bool Quaternion::IsApproximatelyEqual(const Quaternion &rhs) const {
     return MathUtility::IsApproximatelyEqual(m_qw, rhs.m_qw) &&
            MathUtility::IsApproximatelyEqual(m_qx, rhs.m_qx) &&
@@ -106,27 +389,12 @@ float Quaternion::Length() const {
 }
 
 std::string Quaternion::ToString() const {
+    M1_REALTIME_UNSAFE("Quaternion::ToString");
     std::stringstream s;
     s << "Quaternion(w: " << m_qw << ", x: " << m_qx << ", y: " << m_qy << ", z: " << m_qz << ")";
     return s.str();
 }
 
-float Quaternion::GetW() const {
-    return m_qw;
-}
-
-float Quaternion::GetX() const {
-    return m_qx;
-}
-
-float Quaternion::GetY() const {
-    return m_qy;
-}
-
-float Quaternion::GetZ() const {
-    return m_qz;
-}
-
 // =====================================================================================================================
 // ===================================================== OPERATORS =====================================================
 // =====================================================================================================================
@@ -178,6 +446,8 @@ Quaternion Quaternion::operator-(const Quaternion &rhs) const {
 }
 
 void Quaternion::operator*=(const Quaternion &rhs) {
+    M1_PROFILE_KERNEL(QuaternionMultiply);
+
     float a = m_qw * rhs.m_qx + m_qx * rhs.m_qw + m_qy * rhs.m_qz - m_qz * rhs.m_qy;
     float b = m_qw * rhs.m_qy + m_qy * rhs.m_qw + m_qz * rhs.m_qx - m_qx * rhs.m_qz;
     float c = m_qw * rhs.m_qz + m_qz * rhs.m_qw + m_qx * rhs.m_qy - m_qy * rhs.m_qx;
@@ -208,9 +478,9 @@ void Quaternion::operator/=(float scalar) {
 }
 
 Quaternion Quaternion::operator*(float scalar) const {
-    return {m_qx * scalar, m_qy * scalar, m_qz * scalar, m_qw * scalar};
+    return {m_qw * scalar, m_qx * scalar, m_qy * scalar, m_qz * scalar};
 }
 
 Quaternion Quaternion::operator/(float scalar) const {
-    return {m_qx / scalar, m_qy / scalar, m_qz / scalar, m_qw / scalar};
+    return {m_qw / scalar, m_qx / scalar, m_qy / scalar, m_qz / scalar};
 }
@@ -0,0 +1,281 @@
+#include "m1_mathematics/QuaternionAverage.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+using namespace Mach1;
+
+namespace {
+
+void AccumulateMoments(double *moments, Quaternion q, double weight) {
+    double c[4] = {q.GetW(), q.GetX(), q.GetY(), q.GetZ()};
+    size_t m = 0;
+    for (int row = 0; row < 4; row++) {
+        for (int column = row; column < 4; column++) {
+            moments[m++] += weight * c[row] * c[column];
+        }
+    }
+}
+
+Quaternion Accumulate(double *sum, Quaternion q, double weight) {
+    // Flip into the hemisphere of the running sum, returning the sample as it was accumulated
+    if (sum[0] * q.GetW() + sum[1] * q.GetX() + sum[2] * q.GetY() + sum[3] * q.GetZ() < 0) {
+        q *= -1.0f;
+    }
+    sum[0] += weight * q.GetW();
+    sum[1] += weight * q.GetX();
+    sum[2] += weight * q.GetY();
+    sum[3] += weight * q.GetZ();
+    return q;
+}
+
+Quaternion FromSum(const double *sum) {
+    double length = std::sqrt(sum[0] * sum[0] + sum[1] * sum[1] + sum[2] * sum[2] + sum[3] * sum[3]);
+    if (length == 0) {
+        return {};
+    }
+    return {float(sum[0] / length), float(sum[1] / length), float(sum[2] / length), float(sum[3] / length)};
+}
+
+} // namespace
+
+Quaternion QuaternionAverage::LinearMean(const QuaternionBatch &samples, const float *weights) {
+    double sum[4] = {0, 0, 0, 0};
+    for (size_t i = 0; i < samples.Size(); i++) {
+        Accumulate(sum, samples.Get(i), weights ? weights[i] : 1.0);
+    }
+    return FromSum(sum);
+}
+
+Quaternion QuaternionAverage::MarkleyMean(const QuaternionBatch &samples, const float *weights) {
+    double moments[MOMENT_COUNT] = {};
+    for (size_t i = 0; i < samples.Size(); i++) {
+        AccumulateMoments(moments, samples.Get(i), weights ? weights[i] : 1.0);
+    }
+    return FromMoments(moments);
+}
+
+Quaternion QuaternionAverage::FromMoments(const double *moments) {
+    // Expand the upper triangle into a full symmetric matrix
+    double a[4][4];
+    size_t m = 0;
+    for (int row = 0; row < 4; row++) {
+        for (int column = row; column < 4; column++) {
+            a[row][column] = a[column][row] = moments[m++];
+        }
+    }
+
+    if (a[0][0] + a[1][1] + a[2][2] + a[3][3] <= 0) {
+        return {};
+    }
+
+    // Cyclic Jacobi rotations; a 4x4 matrix converges to machine precision within a handful of sweeps
+    double v[4][4] = {{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}};
+    for (int sweep = 0; sweep < 16; sweep++) {
+        double off_diagonal = 0;
+        for (int p = 0; p < 3; p++) {
+            for (int q = p + 1; q < 4; q++) {
+                off_diagonal += a[p][q] * a[p][q];
+            }
+        }
+        if (off_diagonal < 1e-24) {
+            break;
+        }
+
+        for (int p = 0; p < 3; p++) {
+            for (int q = p + 1; q < 4; q++) {
+                if (a[p][q] == 0) {
+                    continue;
+                }
+
+                double theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+                double t = std::copysign(1.0, theta) / (std::fabs(theta) + std::sqrt(theta * theta + 1.0));
+                double c = 1.0 / std::sqrt(t * t + 1.0);
+                double s = t * c;
+
+                for (int k = 0; k < 4; k++) {
+                    double akp = a[k][p];
+                    double akq = a[k][q];
+                    a[k][p] = c * akp - s * akq;
+                    a[k][q] = s * akp + c * akq;
+                }
+                for (int k = 0; k < 4; k++) {
+                    double apk = a[p][k];
+                    double aqk = a[q][k];
+                    a[p][k] = c * apk - s * aqk;
+                    a[q][k] = s * apk + c * aqk;
+                }
+                for (int k = 0; k < 4; k++) {
+                    double vkp = v[k][p];
+                    double vkq = v[k][q];
+                    v[k][p] = c * vkp - s * vkq;
+                    v[k][q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+
+    int dominant = 0;
+    for (int i = 1; i < 4; i++) {
+        if (a[i][i] > a[dominant][dominant]) {
+            dominant = i;
+        }
+    }
+
+    // Report the mean in the w >= 0 hemisphere, which is as good as any for an undirected eigenvector
+    double sign = (v[0][dominant] < 0) ? -1.0 : 1.0;
+    double column[4] = {sign * v[0][dominant], sign * v[1][dominant], sign * v[2][dominant], sign * v[3][dominant]};
+    return FromSum(column);
+}
+
+Quaternion QuaternionAverage::RobustMean(const QuaternionBatch &samples, float max_angle, size_t *inlier_count) {
+    Quaternion mean = MarkleyMean(samples);
+
+    // Compare |dot| against cos(max_angle / 2) instead of taking an acos per sample
+    float min_dot = std::cos(std::clamp(max_angle, 0.0f, float(2.0 * M_PI)) * 0.5f);
+
+    // A sample's membership depends only on the mean it is tested against, so instead of storing the previous
+    // round's membership, each sample is also tested against the previous round's mean. Every sample counts as an
+    // inlier before the first round. The count alone cannot tell when one sample has swapped in as another swapped out
+    Quaternion previous_mean = mean;
+    size_t inliers = samples.Size();
+    for (int iteration = 0; iteration < 8; iteration++) {
+        double moments[MOMENT_COUNT] = {};
+        size_t count = 0;
+        bool changed = false;
+        for (size_t i = 0; i < samples.Size(); i++) {
+            Quaternion q = samples.Get(i);
+            bool inlier = std::fabs(mean.DotProduct(q)) >= min_dot;
+            bool was_inlier = iteration == 0 || std::fabs(previous_mean.DotProduct(q)) >= min_dot;
+            if (inlier) {
+                AccumulateMoments(moments, q, 1.0);
+                count++;
+            }
+            changed |= inlier != was_inlier;
+        }
+
+        if (count == 0) {
+            // No sample lies within max_angle of the current mean: return that mean as is (the plain mean in the
+            // first round, the previous round's inlier mean after that) and report no inliers
+            inliers = 0;
+            break;
+        }
+
+        previous_mean = mean;
+        mean = FromMoments(moments);
+        inliers = count;
+        if (!changed) {
+            break;
+        }
+    }
+
+    if (inlier_count) {
+        *inlier_count = inliers;
+    }
+    return mean;
+}
+
+SlidingQuaternionAverage::SlidingQuaternionAverage(size_t track_count, size_t window_size)
+        : m_trackCount(track_count),
+          m_windowSize(std::max<size_t>(window_size, 1)),
+          m_window(track_count * m_windowSize),
+          m_head(track_count, 0),
+          m_count(track_count, 0),
+          m_pushesSinceRebuild(track_count, 0),
+          m_sums(track_count * 4, 0.0),
+          m_moments(track_count * QuaternionAverage::MOMENT_COUNT, 0.0) {
+}
+
+size_t SlidingQuaternionAverage::GetTrackCount() const {
+    return m_trackCount;
+}
+
+size_t SlidingQuaternionAverage::GetWindowSize() const {
+    return m_windowSize;
+}
+
+size_t SlidingQuaternionAverage::GetSampleCount(size_t track) const {
+    return m_count[track];
+}
+
+void SlidingQuaternionAverage::Push(size_t track, Quaternion sample) {
+    double *sum = &m_sums[track * 4];
+    double *moments = &m_moments[track * QuaternionAverage::MOMENT_COUNT];
+    size_t base = track * m_windowSize;
+
+    if (m_count[track] == m_windowSize) {
+        size_t oldest = base + m_head[track];
+        Quaternion evicted = m_window.Get(oldest);
+        sum[0] -= evicted.GetW();
+        sum[1] -= evicted.GetX();
+        sum[2] -= evicted.GetY();
+        sum[3] -= evicted.GetZ();
+        AccumulateMoments(moments, evicted, -1.0);
+        m_head[track] = (m_head[track] + 1) % m_windowSize;
+        m_count[track]--;
+    }
+
+    // Samples are stored exactly as they were accumulated, so evicting them later cancels out
+    Quaternion aligned = Accumulate(sum, sample, 1.0);
+    AccumulateMoments(moments, sample, 1.0);
+    m_window.Set(base + (m_head[track] + m_count[track]) % m_windowSize, aligned);
+    m_count[track]++;
+
+    if (++m_pushesSinceRebuild[track] >= m_windowSize) {
+        Rebuild(track);
+    }
+}
+
+void SlidingQuaternionAverage::Push(const QuaternionBatch &samples) {
+    for (size_t track = 0; track < m_trackCount; track++) {
+        Push(track, samples.Get(track));
+    }
+}
+
+void SlidingQuaternionAverage::Rebuild(size_t track) {
+    double *sum = &m_sums[track * 4];
+    double *moments = &m_moments[track * QuaternionAverage::MOMENT_COUNT];
+    size_t base = track * m_windowSize;
+
+    std::fill(sum, sum + 4, 0.0);
+    std::fill(moments, moments + QuaternionAverage::MOMENT_COUNT, 0.0);
+
+    for (size_t i = 0; i < m_count[track]; i++) {
+        size_t slot = base + (m_head[track] + i) % m_windowSize;
+        Quaternion aligned = Accumulate(sum, m_window.Get(slot), 1.0);
+        AccumulateMoments(moments, aligned, 1.0);
+        m_window.Set(slot, aligned);
+    }
+
+    m_pushesSinceRebuild[track] = 0;
+}
+
+Quaternion SlidingQuaternionAverage::GetLinearMean(size_t track) const {
+    return FromSum(&m_sums[track * 4]);
+}
+
+Quaternion SlidingQuaternionAverage::GetMarkleyMean(size_t track) const {
+    return QuaternionAverage::FromMoments(&m_moments[track * QuaternionAverage::MOMENT_COUNT]);
+}
+
+void SlidingQuaternionAverage::GetLinearMeans(QuaternionBatch &output) const {
+    if (output.Size() != m_trackCount) {
+        output.Resize(m_trackCount);
+    }
+
+    for (size_t track = 0; track < m_trackCount; track++) {
+        output.Set(track, GetLinearMean(track));
+    }
+}
+
+void SlidingQuaternionAverage::Reset() {
+    std::fill(m_head.begin(), m_head.end(), 0);
+    std::fill(m_count.begin(), m_count.end(), 0);
+    std::fill(m_pushesSinceRebuild.begin(), m_pushesSinceRebuild.end(), 0);
+    std::fill(m_sums.begin(), m_sums.end(), 0.0);
+    std::fill(m_moments.begin(), m_moments.end(), 0.0);
+}
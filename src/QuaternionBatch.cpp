@@ -0,0 +1,282 @@
+#include "m1_mathematics/QuaternionBatch.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "m1_mathematics/MathUtility.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+using namespace Mach1;
+
+namespace {
+
+struct SwingTwistLimits {
+    float cos_max_swing;
+    float sin_max_swing;
+    float cos_min_twist;
+    float sin_min_twist;
+    float cos_max_twist;
+    float sin_max_twist;
+};
+
+/**
+ * Clamp the swing and twist of a run of Quaternions in place around a unit (or zero) axis. The four component arrays
+ * never overlap; __restrict lets the loop vectorize
+ */
+void ClampSwingTwistRun(float *__restrict qw, float *__restrict qx, float *__restrict qy, float *__restrict qz,
+                        float ax, float ay, float az, const SwingTwistLimits &limits, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        float w = qw[i];
+        float x = qx[i];
+        float y = qy[i];
+        float z = qz[i];
+
+        // twist = (w, projection * axis) renormalized, identity when undefined
+        float projection = x * ax + y * ay + z * az;
+        float twist_length = std::sqrt(w * w + projection * projection);
+        bool degenerate = twist_length < MathUtility::FLOAT_COMPARISON_EPSILON;
+        float inverse_length = 1.0f / (degenerate ? 1.0f : twist_length);
+        float tw = degenerate ? 1.0f : w * inverse_length;
+        float tp = degenerate ? 0.0f : projection * inverse_length;
+
+        // swing = q * conjugate(twist)
+        float sw = w * tw + tp * projection;
+        float sx = tw * x - w * tp * ax - tp * (y * az - z * ay);
+        float sy = tw * y - w * tp * ay - tp * (z * ax - x * az);
+        float sz = tw * z - w * tp * az - tp * (x * ay - y * ax);
+
+        float swing_length = std::sqrt(sx * sx + sy * sy + sz * sz);
+        bool clamp_swing = sw < limits.cos_max_swing && swing_length > 0.0f;
+        float swing_scale = clamp_swing ? limits.sin_max_swing / (swing_length > 0.0f ? swing_length : 1.0f) : 1.0f;
+        sw = clamp_swing ? limits.cos_max_swing : sw;
+        sx *= swing_scale;
+        sy *= swing_scale;
+        sz *= swing_scale;
+
+        float sign = (tw < 0) ? -1.0f : 1.0f;
+        float twist_cos = tw * sign;
+        float twist_sin = tp * sign;
+        bool over = twist_sin * limits.cos_max_twist > twist_cos * limits.sin_max_twist;
+        bool under = !over && twist_sin * limits.cos_min_twist < twist_cos * limits.sin_min_twist;
+        tw = over ? limits.cos_max_twist : (under ? limits.cos_min_twist : tw);
+        tp = over ? limits.sin_max_twist : (under ? limits.sin_min_twist : tp);
+
+        // swing * twist, with the twist's vector tp * axis
+        float swing_dot_axis = sx * ax + sy * ay + sz * az;
+        qw[i] = sw * tw - tp * swing_dot_axis;
+        qx[i] = sw * tp * ax + tw * sx + tp * (sy * az - sz * ay);
+        qy[i] = sw * tp * ay + tw * sy + tp * (sz * ax - sx * az);
+        qz[i] = sw * tp * az + tw * sz + tp * (sx * ay - sy * ax);
+    }
+}
+
+} // namespace
+
+QuaternionBatch::QuaternionBatch() = default;
+
+QuaternionBatch::QuaternionBatch(size_t size) : m_qw(size, 1.0f), m_qx(size, 0.0f), m_qy(size, 0.0f), m_qz(size, 0.0f) {}
+
+size_t QuaternionBatch::Size() const {
+    return m_qw.size();
+}
+
+void QuaternionBatch::Resize(size_t size) {
+    m_qw.resize(size, 1.0f);
+    m_qx.resize(size, 0.0f);
+    m_qy.resize(size, 0.0f);
+    m_qz.resize(size, 0.0f);
+}
+
+void QuaternionBatch::Reserve(size_t capacity) {
+    m_qw.reserve(capacity);
+    m_qx.reserve(capacity);
+    m_qy.reserve(capacity);
+    m_qz.reserve(capacity);
+}
+
+Quaternion QuaternionBatch::Get(size_t index) const {
+    return {m_qw[index], m_qx[index], m_qy[index], m_qz[index]};
+}
+
+void QuaternionBatch::Set(size_t index, Quaternion quaternion) {
+    m_qw[index] = quaternion.GetW();
+    m_qx[index] = quaternion.GetX();
+    m_qy[index] = quaternion.GetY();
+    m_qz[index] = quaternion.GetZ();
+}
+
+float *QuaternionBatch::W() { return m_qw.data(); }
+float *QuaternionBatch::X() { return m_qx.data(); }
+float *QuaternionBatch::Y() { return m_qy.data(); }
+float *QuaternionBatch::Z() { return m_qz.data(); }
+
+const float *QuaternionBatch::W() const { return m_qw.data(); }
+const float *QuaternionBatch::X() const { return m_qx.data(); }
+const float *QuaternionBatch::Y() const { return m_qy.data(); }
+const float *QuaternionBatch::Z() const { return m_qz.data(); }
+
+// The conversions below follow their scalar Quaternion counterparts, with the small-angle branches turned into selects
+// so that each loop body stays straight-line
+
+void QuaternionBatch::FromRotationVectors(const Float3Batch &rotation_vectors) {
+    Resize(rotation_vectors.Size());
+
+    const float *yaw = rotation_vectors.Yaw();
+    const float *pitch = rotation_vectors.Pitch();
+    const float *roll = rotation_vectors.Roll();
+
+    for (size_t i = 0; i < Size(); i++) {
+        float theta_squared = yaw[i] * yaw[i] + pitch[i] * pitch[i] + roll[i] * roll[i];
+        float theta = std::sqrt(theta_squared);
+        bool small = theta_squared < 1e-4f;
+
+        float taylor_w = 1.0f - theta_squared * (1.0f / 8.0f) + theta_squared * theta_squared * (1.0f / 384.0f);
+        float taylor_scale = 0.5f - theta_squared * (1.0f / 48.0f) + theta_squared * theta_squared * (1.0f / 3840.0f);
+        float safe_theta = small ? 1.0f : theta;
+
+        float scale = small ? taylor_scale : std::sin(theta * 0.5f) / safe_theta;
+        m_qw[i] = small ? taylor_w : std::cos(theta * 0.5f);
+        m_qx[i] = roll[i] * scale;
+        m_qy[i] = pitch[i] * scale;
+        m_qz[i] = yaw[i] * scale;
+    }
+}
+
+void QuaternionBatch::ToRotationVectors(Float3Batch &output) const {
+    if (output.Size() != Size()) {
+        output.Resize(Size());
+    }
+
+    float *yaw = output.Yaw();
+    float *pitch = output.Pitch();
+    float *roll = output.Roll();
+
+    for (size_t i = 0; i < Size(); i++) {
+        float sign = (m_qw[i] < 0) ? -1.0f : 1.0f;
+        float w = m_qw[i] * sign;
+        float vector_length_squared = m_qx[i] * m_qx[i] + m_qy[i] * m_qy[i] + m_qz[i] * m_qz[i];
+        float vector_length = std::sqrt(vector_length_squared);
+        bool small = vector_length_squared < 1e-6f * w * w;
+
+        float taylor_scale = 2.0f / w * (1.0f - vector_length_squared / (3.0f * w * w));
+        float safe_length = small ? 1.0f : vector_length;
+        float scale = (small ? taylor_scale : 2.0f * std::atan2(vector_length, w) / safe_length) * sign;
+
+        yaw[i] = m_qz[i] * scale;
+        pitch[i] = m_qy[i] * scale;
+        roll[i] = m_qx[i] * scale;
+    }
+}
+
+void QuaternionBatch::FromAxisAngles(const Float3Batch &axes, const float *angles) {
+    Resize(axes.Size());
+
+    const float *yaw = axes.Yaw();
+    const float *pitch = axes.Pitch();
+    const float *roll = axes.Roll();
+
+    for (size_t i = 0; i < Size(); i++) {
+        float length = std::sqrt(yaw[i] * yaw[i] + pitch[i] * pitch[i] + roll[i] * roll[i]);
+        bool degenerate = length == 0;
+        float scale = degenerate ? 0.0f : std::sin(angles[i] * 0.5f) / (degenerate ? 1.0f : length);
+
+        m_qw[i] = degenerate ? 1.0f : std::cos(angles[i] * 0.5f);
+        m_qx[i] = roll[i] * scale;
+        m_qy[i] = pitch[i] * scale;
+        m_qz[i] = yaw[i] * scale;
+    }
+}
+
+void QuaternionBatch::ToAxisAngles(Float3Batch &axes, float *angles) const {
+    if (axes.Size() != Size()) {
+        axes.Resize(Size());
+    }
+
+    float *yaw = axes.Yaw();
+    float *pitch = axes.Pitch();
+    float *roll = axes.Roll();
+
+    for (size_t i = 0; i < Size(); i++) {
+        float sign = (m_qw[i] < 0) ? -1.0f : 1.0f;
+        float vector_length = std::sqrt(m_qx[i] * m_qx[i] + m_qy[i] * m_qy[i] + m_qz[i] * m_qz[i]);
+        bool degenerate = vector_length == 0;
+        float scale = sign / (degenerate ? 1.0f : vector_length);
+
+        angles[i] = 2.0f * std::atan2(vector_length, m_qw[i] * sign);
+        yaw[i] = degenerate ? 0.0f : m_qz[i] * scale;
+        pitch[i] = degenerate ? 0.0f : m_qy[i] * scale;
+        roll[i] = degenerate ? 1.0f : m_qx[i] * scale;
+    }
+}
+
+void QuaternionBatch::ToSwingTwists(Float3 axis, QuaternionBatch &swings, QuaternionBatch &twists) const {
+    if (swings.Size() != Size()) {
+        swings.Resize(Size());
+    }
+    if (twists.Size() != Size()) {
+        twists.Resize(Size());
+    }
+
+    float axis_length = axis.Length();
+    float axis_scale = axis_length == 0 ? 0.0f : 1.0f / axis_length;
+    float ax = axis.GetRoll() * axis_scale;
+    float ay = axis.GetPitch() * axis_scale;
+    float az = axis.GetYaw() * axis_scale;
+
+    float *sw = swings.W();
+    float *sx = swings.X();
+    float *sy = swings.Y();
+    float *sz = swings.Z();
+    float *tw = twists.W();
+    float *tx = twists.X();
+    float *ty = twists.Y();
+    float *tz = twists.Z();
+
+    for (size_t i = 0; i < Size(); i++) {
+        float w = m_qw[i];
+        float x = m_qx[i];
+        float y = m_qy[i];
+        float z = m_qz[i];
+
+        float projection = x * ax + y * ay + z * az;
+        float twist_length = std::sqrt(w * w + projection * projection);
+        bool degenerate = twist_length < MathUtility::FLOAT_COMPARISON_EPSILON;
+        float inverse_length = 1.0f / (degenerate ? 1.0f : twist_length);
+        float twist_w = degenerate ? 1.0f : w * inverse_length;
+        float twist_p = degenerate ? 0.0f : projection * inverse_length;
+
+        tw[i] = twist_w;
+        tx[i] = ax * twist_p;
+        ty[i] = ay * twist_p;
+        tz[i] = az * twist_p;
+
+        sw[i] = w * twist_w + twist_p * projection;
+        sx[i] = twist_w * x - w * twist_p * ax - twist_p * (y * az - z * ay);
+        sy[i] = twist_w * y - w * twist_p * ay - twist_p * (z * ax - x * az);
+        sz[i] = twist_w * z - w * twist_p * az - twist_p * (x * ay - y * ax);
+    }
+}
+
+void QuaternionBatch::ClampSwingTwist(Float3 axis, float max_swing, float min_twist, float max_twist) {
+    float axis_length = axis.Length();
+    float axis_scale = axis_length == 0 ? 0.0f : 1.0f / axis_length;
+
+    float pi = static_cast<float>(M_PI);
+    float half_max_swing = std::min(std::max(max_swing, 0.0f), pi) * 0.5f;
+    float half_min_twist = std::min(std::max(min_twist, -pi), pi) * 0.5f;
+    float half_max_twist = std::min(std::max(max_twist, -pi), pi) * 0.5f;
+    if (axis_length == 0) {
+        // Without an axis everything is swing, and the identity twist must pass through unclamped
+        half_min_twist = -pi * 0.5f;
+        half_max_twist = pi * 0.5f;
+    }
+
+    SwingTwistLimits limits{std::cos(half_max_swing), std::sin(half_max_swing),
+                            std::cos(half_min_twist), std::sin(half_min_twist),
+                            std::cos(half_max_twist), std::sin(half_max_twist)};
+    ClampSwingTwistRun(W(), X(), Y(), Z(), axis.GetRoll() * axis_scale, axis.GetPitch() * axis_scale,
+                       axis.GetYaw() * axis_scale, limits, Size());
+}
@@ -0,0 +1,247 @@
+#include "m1_mathematics/QuaternionIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+using namespace Mach1;
+
+namespace {
+
+// Ranges this small are scanned directly rather than split further
+constexpr size_t LEAF_SIZE = 8;
+
+float DistanceToAngle(float distance) {
+    // distance is 1 - |dot|, and |dot| is the cosine of half the rotation angle
+    return 2.0f * std::acos(std::clamp(1.0f - distance, 0.0f, 1.0f));
+}
+
+bool CloserMatch(const QuaternionIndex::Match &lhs, const QuaternionIndex::Match &rhs) {
+    return lhs.angle < rhs.angle;
+}
+
+/**
+ * Write `1 - |dot(q, p)|` for a run of points. The outputs never alias the SoA inputs; __restrict lets the loop
+ * vectorize
+ */
+void Distances(const float *q, const float *__restrict pw, const float *__restrict px, const float *__restrict py,
+               const float *__restrict pz, size_t count, float *__restrict distances) {
+    float qw = q[0], qx = q[1], qy = q[2], qz = q[3];
+    for (size_t i = 0; i < count; i++) {
+        distances[i] = 1.0f - std::fabs(qw * pw[i] + qx * px[i] + qy * py[i] + qz * pz[i]);
+    }
+}
+
+} // namespace
+
+// Matches carry `1 - |dot|` in their angle field until a query completes, which avoids an acos per candidate
+struct QuaternionIndex::Query {
+    float q[4];
+    float worst;
+
+    // k-nearest mode: a max-heap of the best k candidates so far
+    Match *heap;
+    size_t k;
+    size_t count;
+
+    // radius mode
+    std::vector<Match> *within;
+};
+
+QuaternionIndex::QuaternionIndex() = default;
+
+size_t QuaternionIndex::Size() const {
+    return m_points.Size();
+}
+
+const float *QuaternionIndex::AxisData(int axis) const {
+    switch (axis) {
+        case 0:
+            return m_points.W();
+        case 1:
+            return m_points.X();
+        case 2:
+            return m_points.Y();
+        default:
+            return m_points.Z();
+    }
+}
+
+void QuaternionIndex::Build(const QuaternionBatch &orientations) {
+    size_t count = orientations.Size();
+    m_points = QuaternionBatch(count);
+    m_sourceIndex.resize(count);
+    m_splitAxis.assign(count, 0);
+
+    // Fold every Quaternion into the w >= 0 hemisphere
+    for (size_t i = 0; i < count; i++) {
+        Quaternion q = orientations.Get(i);
+        if (q.GetW() < 0) {
+            q *= -1.0f;
+        }
+        m_points.Set(i, q);
+        m_sourceIndex[i] = i;
+    }
+
+    if (count <= BRUTE_FORCE_THRESHOLD) {
+        return;
+    }
+
+    BuildNode(0, count);
+
+    // Lay the points out in tree order, so searches walk contiguous memory
+    QuaternionBatch unordered = m_points;
+    for (size_t i = 0; i < count; i++) {
+        m_points.Set(i, unordered.Get(m_sourceIndex[i]));
+    }
+}
+
+void QuaternionIndex::BuildNode(size_t begin, size_t end) {
+    if (end - begin <= LEAF_SIZE) {
+        return;
+    }
+
+    // Split along the axis with the widest spread in this range
+    int axis = 0;
+    float widest = -1.0f;
+    for (int a = 0; a < 4; a++) {
+        const float *data = AxisData(a);
+        auto [lo, hi] = std::minmax_element(m_sourceIndex.begin() + begin, m_sourceIndex.begin() + end,
+                                            [data](size_t l, size_t r) { return data[l] < data[r]; });
+        float spread = data[*hi] - data[*lo];
+        if (spread > widest) {
+            widest = spread;
+            axis = a;
+        }
+    }
+
+    size_t mid = begin + (end - begin) / 2;
+    const float *data = AxisData(axis);
+    std::nth_element(m_sourceIndex.begin() + begin, m_sourceIndex.begin() + mid, m_sourceIndex.begin() + end,
+                     [data](size_t l, size_t r) { return data[l] < data[r]; });
+    m_splitAxis[mid] = static_cast<unsigned char>(axis);
+
+    BuildNode(begin, mid);
+    BuildNode(mid + 1, end);
+}
+
+void QuaternionIndex::Visit(Query &query, size_t slot) const {
+    float dot = query.q[0] * m_points.W()[slot] + query.q[1] * m_points.X()[slot] +
+                query.q[2] * m_points.Y()[slot] + query.q[3] * m_points.Z()[slot];
+    Consider(query, slot, 1.0f - std::fabs(dot));
+}
+
+void QuaternionIndex::Consider(Query &query, size_t slot, float distance) const {
+    if (distance > query.worst) {
+        return;
+    }
+
+    Match match = {m_sourceIndex[slot], distance};
+
+    if (query.within) {
+        query.within->push_back(match);
+        return;
+    }
+
+    if (query.count < query.k) {
+        query.heap[query.count++] = match;
+        std::push_heap(query.heap, query.heap + query.count, CloserMatch);
+    } else {
+        std::pop_heap(query.heap, query.heap + query.count, CloserMatch);
+        query.heap[query.count - 1] = match;
+        std::push_heap(query.heap, query.heap + query.count, CloserMatch);
+    }
+
+    if (query.count == query.k) {
+        query.worst = query.heap[0].angle;
+    }
+}
+
+void QuaternionIndex::Scan(Query &query) const {
+    // Small sets compute every distance in one straight loop first, then pick the matches from them
+    float distances[BRUTE_FORCE_THRESHOLD];
+    Distances(query.q, m_points.W(), m_points.X(), m_points.Y(), m_points.Z(), Size(), distances);
+    for (size_t slot = 0; slot < Size(); slot++) {
+        Consider(query, slot, distances[slot]);
+    }
+}
+
+void QuaternionIndex::Search(Query &query, size_t begin, size_t end) const {
+    if (end - begin <= LEAF_SIZE) {
+        for (size_t slot = begin; slot < end; slot++) {
+            Visit(query, slot);
+        }
+        return;
+    }
+
+    size_t mid = begin + (end - begin) / 2;
+    Visit(query, mid);
+
+    int axis = m_splitAxis[mid];
+    float split = AxisData(axis)[mid];
+
+    // The query stands in for both q and -q; a side can only be skipped once it is too far from both.
+    // Points p on the far side of a plane at distance d from q satisfy 1 - dot(p, q) = |p - q|^2 / 2 >= d^2 / 2
+    float positive = query.q[axis] - split;
+    float negative = -query.q[axis] - split;
+    float lower_bound_low = std::fmin(positive > 0 ? positive * positive : 0, negative > 0 ? negative * negative : 0) * 0.5f;
+    float lower_bound_high = std::fmin(positive < 0 ? positive * positive : 0, negative < 0 ? negative * negative : 0) * 0.5f;
+
+    if (lower_bound_low <= lower_bound_high) {
+        if (lower_bound_low <= query.worst) Search(query, begin, mid);
+        if (lower_bound_high <= query.worst) Search(query, mid + 1, end);
+    } else {
+        if (lower_bound_high <= query.worst) Search(query, mid + 1, end);
+        if (lower_bound_low <= query.worst) Search(query, begin, mid);
+    }
+}
+
+QuaternionIndex::Match QuaternionIndex::FindNearest(Quaternion query) const {
+    Match nearest = {Size(), std::numeric_limits<float>::infinity()};
+    FindKNearest(query, 1, &nearest);
+    return nearest;
+}
+
+size_t QuaternionIndex::FindKNearest(Quaternion query, size_t k, Match *results) const {
+    k = std::min(k, Size());
+    if (k == 0) {
+        return 0;
+    }
+
+    Query search = {{query.GetW(), query.GetX(), query.GetY(), query.GetZ()},
+                    std::numeric_limits<float>::infinity(), results, k, 0, nullptr};
+
+    if (Size() <= BRUTE_FORCE_THRESHOLD) {
+        Scan(search);
+    } else {
+        Search(search, 0, Size());
+    }
+
+    std::sort_heap(results, results + search.count, CloserMatch);
+    for (size_t i = 0; i < search.count; i++) {
+        results[i].angle = DistanceToAngle(results[i].angle);
+    }
+    return search.count;
+}
+
+void QuaternionIndex::FindWithinAngle(Quaternion query, float max_angle, std::vector<Match> &results) const {
+    results.clear();
+
+    Query search = {{query.GetW(), query.GetX(), query.GetY(), query.GetZ()},
+                    1.0f - std::cos(std::fmin(max_angle, float(M_PI)) * 0.5f), nullptr, 0, 0, &results};
+
+    if (Size() <= BRUTE_FORCE_THRESHOLD) {
+        Scan(search);
+    } else {
+        Search(search, 0, Size());
+    }
+
+    std::sort(results.begin(), results.end(), CloserMatch);
+    for (Match &match : results) {
+        match.angle = DistanceToAngle(match.angle);
+    }
+}
@@ -0,0 +1,158 @@
+#include "m1_mathematics/QuaternionSpline.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "m1_mathematics/MathUtility.h"
+
+using namespace Mach1;
+
+namespace {
+
+void CacheArc(Quaternion from, Quaternion to, float &theta, float &inverse_sin) {
+    float cos_theta = from.DotProduct(to);
+
+    if (cos_theta > MathUtility::FLOAT_COMPARISON_ONE_MINUS_EPSILON) {
+        // Marks the arc as degenerate, so BlendArc falls back to a normalized lerp
+        theta = 0.0f;
+        inverse_sin = 0.0f;
+        return;
+    }
+
+    theta = std::acos(std::fmax(cos_theta, -1.0f));
+    inverse_sin = 1.0f / std::sin(theta);
+}
+
+Quaternion BlendArc(Quaternion from, Quaternion to, float theta, float inverse_sin, float t) {
+    if (inverse_sin == 0.0f) {
+        return (from * (1.0f - t) + to * t).Normalized();
+    }
+
+    return from * (std::sin((1.0f - t) * theta) * inverse_sin) + to * (std::sin(t * theta) * inverse_sin);
+}
+
+} // namespace
+
+QuaternionSpline::QuaternionSpline() : m_cursor(0) {
+}
+
+bool QuaternionSpline::AddKeyframe(double time, Quaternion rotation) {
+    if (!m_times.empty()) {
+        if (!(time > m_times.back())) {
+            return false;
+        }
+
+        // Keep neighbouring keys in one hemisphere, so the curve never takes the long way around
+        if (m_keys.back().DotProduct(rotation) < 0) {
+            rotation *= -1.0f;
+        }
+    }
+
+    m_times.push_back(time);
+    m_keys.push_back(rotation);
+    m_controls.push_back(rotation);
+
+    size_t count = m_keys.size();
+    if (count == 1) {
+        return true;
+    }
+
+    m_segments.push_back({});
+
+    // The new key changes the tangent of the previous key, which is shared by the last two segments
+    UpdateControlPoint(count - 2);
+    UpdateControlPoint(count - 1);
+    if (count > 2) {
+        UpdateSegment(count - 3);
+    }
+    UpdateSegment(count - 2);
+    return true;
+}
+
+void QuaternionSpline::Clear() {
+    m_times.clear();
+    m_keys.clear();
+    m_controls.clear();
+    m_segments.clear();
+    m_cursor = 0;
+}
+
+size_t QuaternionSpline::GetKeyframeCount() const {
+    return m_keys.size();
+}
+
+double QuaternionSpline::GetStartTime() const {
+    return m_times.empty() ? 0.0 : m_times.front();
+}
+
+double QuaternionSpline::GetEndTime() const {
+    return m_times.empty() ? 0.0 : m_times.back();
+}
+
+void QuaternionSpline::UpdateControlPoint(size_t key) {
+    // End keys reuse themselves as their missing neighbour
+    Quaternion previous = m_keys[key > 0 ? key - 1 : key];
+    Quaternion next = m_keys[key + 1 < m_keys.size() ? key + 1 : key];
+    m_controls[key] = Quaternion::SquadControlPoint(previous, m_keys[key], next);
+}
+
+void QuaternionSpline::UpdateSegment(size_t segment) {
+    Segment &s = m_segments[segment];
+    s.startTime = m_times[segment];
+    s.inverseDuration = 1.0 / (m_times[segment + 1] - m_times[segment]);
+    CacheArc(m_keys[segment], m_keys[segment + 1], s.keyTheta, s.keyInverseSin);
+    CacheArc(m_controls[segment], m_controls[segment + 1], s.controlTheta, s.controlInverseSin);
+}
+
+size_t QuaternionSpline::FindSegment(double time) {
+    size_t last = m_segments.size() - 1;
+    size_t cursor = std::min(m_cursor, last);
+
+    // Playback usually stays in the same segment or moves into the next one
+    if (time >= m_times[cursor]) {
+        if (cursor == last || time < m_times[cursor + 1]) {
+            return m_cursor = cursor;
+        }
+        if (cursor + 1 == last || time < m_times[cursor + 2]) {
+            return m_cursor = cursor + 1;
+        }
+    }
+
+    auto it = std::upper_bound(m_times.begin(), m_times.end(), time);
+    size_t key = (it == m_times.begin()) ? 0 : static_cast<size_t>(it - m_times.begin()) - 1;
+    return m_cursor = std::min(key, last);
+}
+
+Quaternion QuaternionSpline::Evaluate(double time) {
+    if (m_keys.empty()) {
+        return {};
+    }
+    if (time <= m_times.front()) {
+        return m_keys.front();
+    }
+    if (time >= m_times.back()) {
+        return m_keys.back();
+    }
+
+    size_t index = FindSegment(time);
+    const Segment &s = m_segments[index];
+    float t = static_cast<float>((time - s.startTime) * s.inverseDuration);
+
+    Quaternion outer = BlendArc(m_keys[index], m_keys[index + 1], s.keyTheta, s.keyInverseSin, t);
+    Quaternion inner = BlendArc(m_controls[index], m_controls[index + 1], s.controlTheta, s.controlInverseSin, t);
+
+    float theta;
+    float inverse_sin;
+    CacheArc(outer, inner, theta, inverse_sin);
+    return BlendArc(outer, inner, theta, inverse_sin, 2.0f * t * (1.0f - t));
+}
+
+void QuaternionSpline::EvaluateRange(double start_time, double time_step, size_t count, QuaternionBatch &output) {
+    if (output.Size() != count) {
+        output.Resize(count);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        output.Set(i, Evaluate(start_time + time_step * static_cast<double>(i)));
+    }
+}
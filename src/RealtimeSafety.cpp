@@ -0,0 +1,68 @@
+#include "m1_mathematics/RealtimeSafety.h"
+
+#include <atomic>
+
+using namespace Mach1;
+
+namespace {
+
+// Plain thread_local data needs no constructor, so touching it from inside malloc cannot recurse into malloc
+thread_local unsigned t_depth = 0;
+thread_local bool t_in_handler = false;
+thread_local RealtimeSafety::Violations t_violations;
+
+std::atomic<RealtimeSafety::Handler> g_handler(nullptr);
+
+void Report(size_t &counter, const char *what) {
+    if (t_depth == 0 || t_in_handler) {
+        return;
+    }
+
+    counter++;
+    t_violations.last = what;
+
+    RealtimeSafety::Handler handler = g_handler.load(std::memory_order_acquire);
+    if (handler) {
+        t_in_handler = true;
+        handler(what);
+        t_in_handler = false;
+    }
+}
+
+} // namespace
+
+RealtimeSafety::Scope::Scope() {
+    t_depth++;
+}
+
+RealtimeSafety::Scope::~Scope() {
+    t_depth--;
+}
+
+bool RealtimeSafety::IsInScope() {
+    return t_depth > 0 && !t_in_handler;
+}
+
+void RealtimeSafety::ReportAllocation(const char *what) {
+    Report(t_violations.allocations, what);
+}
+
+void RealtimeSafety::ReportBlockingCall(const char *what) {
+    Report(t_violations.blocking_calls, what);
+}
+
+void RealtimeSafety::ReportUnsafeCall(const char *what) {
+    Report(t_violations.unsafe_calls, what);
+}
+
+RealtimeSafety::Violations RealtimeSafety::GetViolations() {
+    return t_violations;
+}
+
+void RealtimeSafety::ResetViolations() {
+    t_violations = Violations();
+}
+
+void RealtimeSafety::SetHandler(Handler handler) {
+    g_handler.store(handler, std::memory_order_release);
+}
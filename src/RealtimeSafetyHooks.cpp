@@ -0,0 +1,277 @@
+// Allocation and blocking-call hooks reporting to RealtimeSafety. This file replaces the global operator new and
+// delete, and on glibc interposes malloc and the lock, wait and sleep functions of the C library, so it must be linked
+// into at most one target of a program: the library when M1_MATHEMATICS_REALTIME_CHECKS is on, otherwise the real-time
+// safety test suite
+
+#include "m1_mathematics/RealtimeSafety.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#if defined(__GLIBC__)
+#include <dlfcn.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <time.h>
+#endif
+
+using namespace Mach1;
+
+#if defined(__GLIBC__)
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *pointer, size_t size);
+extern "C" void *__libc_memalign(size_t alignment, size_t size);
+extern "C" void __libc_free(void *pointer);
+#endif
+
+namespace {
+
+#if defined(__GLIBC__)
+// Reach the C library directly, so operator new is not reported a second time by the malloc hook
+void *RawMalloc(size_t size) {
+    return __libc_malloc(size);
+}
+
+void RawFree(void *pointer) {
+    __libc_free(pointer);
+}
+#else
+void *RawMalloc(size_t size) {
+    return std::malloc(size);
+}
+
+void RawFree(void *pointer) {
+    std::free(pointer);
+}
+#endif
+
+void *Allocate(size_t size, const char *what) {
+    RealtimeSafety::ReportAllocation(what);
+    return RawMalloc(size == 0 ? 1 : size);
+}
+
+void Free(void *pointer, const char *what) {
+    if (pointer) {
+        RealtimeSafety::ReportAllocation(what);
+        RawFree(pointer);
+    }
+}
+
+// Over-allocate and keep the start of the block just before the aligned pointer; works on every platform
+void *AllocateAligned(size_t size, std::align_val_t alignment, const char *what) {
+    size_t align = static_cast<size_t>(alignment);
+    void *raw = Allocate(size + align + sizeof(void *), what);
+    if (!raw) {
+        return nullptr;
+    }
+
+    uintptr_t start = reinterpret_cast<uintptr_t>(raw) + sizeof(void *);
+    uintptr_t aligned = (start + align - 1) & ~static_cast<uintptr_t>(align - 1);
+    reinterpret_cast<void **>(aligned)[-1] = raw;
+    return reinterpret_cast<void *>(aligned);
+}
+
+void FreeAligned(void *pointer, const char *what) {
+    if (pointer) {
+        Free(static_cast<void **>(pointer)[-1], what);
+    }
+}
+
+void *AllocateOrThrow(size_t size, const char *what) {
+    void *pointer = Allocate(size, what);
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void *AllocateAlignedOrThrow(size_t size, std::align_val_t alignment, const char *what) {
+    void *pointer = AllocateAligned(size, alignment, what);
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+} // namespace
+
+// ===================================================== OPERATOR NEW =====================================================
+
+void *operator new(size_t size) {
+    return AllocateOrThrow(size, "operator new");
+}
+
+void *operator new[](size_t size) {
+    return AllocateOrThrow(size, "operator new[]");
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+    return Allocate(size, "operator new");
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+    return Allocate(size, "operator new[]");
+}
+
+void *operator new(size_t size, std::align_val_t alignment) {
+    return AllocateAlignedOrThrow(size, alignment, "operator new");
+}
+
+void *operator new[](size_t size, std::align_val_t alignment) {
+    return AllocateAlignedOrThrow(size, alignment, "operator new[]");
+}
+
+void *operator new(size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return AllocateAligned(size, alignment, "operator new");
+}
+
+void *operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return AllocateAligned(size, alignment, "operator new[]");
+}
+
+void operator delete(void *pointer) noexcept {
+    Free(pointer, "operator delete");
+}
+
+void operator delete[](void *pointer) noexcept {
+    Free(pointer, "operator delete[]");
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+    Free(pointer, "operator delete");
+}
+
+void operator delete[](void *pointer, size_t) noexcept {
+    Free(pointer, "operator delete[]");
+}
+
+void operator delete(void *pointer, std::align_val_t) noexcept {
+    FreeAligned(pointer, "operator delete");
+}
+
+void operator delete[](void *pointer, std::align_val_t) noexcept {
+    FreeAligned(pointer, "operator delete[]");
+}
+
+void operator delete(void *pointer, size_t, std::align_val_t) noexcept {
+    FreeAligned(pointer, "operator delete");
+}
+
+void operator delete[](void *pointer, size_t, std::align_val_t) noexcept {
+    FreeAligned(pointer, "operator delete[]");
+}
+
+#if defined(__GLIBC__)
+
+// ===================================================== C LIBRARY =====================================================
+
+namespace {
+
+/**
+ * Look up the next definition of a C library function, the one this file's definition hides
+ */
+template <typename Function>
+Function Next(Function &cache, const char *name) {
+    if (!cache) {
+        cache = reinterpret_cast<Function>(dlsym(RTLD_NEXT, name));
+    }
+    return cache;
+}
+
+} // namespace
+
+extern "C" {
+
+void *malloc(size_t size) noexcept {
+    RealtimeSafety::ReportAllocation("malloc");
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) noexcept {
+    RealtimeSafety::ReportAllocation("calloc");
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *pointer, size_t size) noexcept {
+    RealtimeSafety::ReportAllocation("realloc");
+    return __libc_realloc(pointer, size);
+}
+
+void *aligned_alloc(size_t alignment, size_t size) noexcept {
+    RealtimeSafety::ReportAllocation("aligned_alloc");
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void **pointer, size_t alignment, size_t size) noexcept {
+    RealtimeSafety::ReportAllocation("posix_memalign");
+    *pointer = __libc_memalign(alignment, size);
+    return *pointer ? 0 : ENOMEM;
+}
+
+void free(void *pointer) noexcept {
+    if (pointer) {
+        RealtimeSafety::ReportAllocation("free");
+    }
+    __libc_free(pointer);
+}
+
+int pthread_mutex_lock(pthread_mutex_t *mutex) noexcept {
+    static int (*next)(pthread_mutex_t *) = nullptr;
+    RealtimeSafety::ReportBlockingCall("pthread_mutex_lock");
+    return Next(next, "pthread_mutex_lock")(mutex);
+}
+
+int pthread_rwlock_rdlock(pthread_rwlock_t *lock) noexcept {
+    static int (*next)(pthread_rwlock_t *) = nullptr;
+    RealtimeSafety::ReportBlockingCall("pthread_rwlock_rdlock");
+    return Next(next, "pthread_rwlock_rdlock")(lock);
+}
+
+int pthread_rwlock_wrlock(pthread_rwlock_t *lock) noexcept {
+    static int (*next)(pthread_rwlock_t *) = nullptr;
+    RealtimeSafety::ReportBlockingCall("pthread_rwlock_wrlock");
+    return Next(next, "pthread_rwlock_wrlock")(lock);
+}
+
+int pthread_cond_wait(pthread_cond_t *condition, pthread_mutex_t *mutex) {
+    static int (*next)(pthread_cond_t *, pthread_mutex_t *) = nullptr;
+    RealtimeSafety::ReportBlockingCall("pthread_cond_wait");
+    return Next(next, "pthread_cond_wait")(condition, mutex);
+}
+
+int pthread_cond_timedwait(pthread_cond_t *condition, pthread_mutex_t *mutex, const struct timespec *time) {
+    static int (*next)(pthread_cond_t *, pthread_mutex_t *, const struct timespec *) = nullptr;
+    RealtimeSafety::ReportBlockingCall("pthread_cond_timedwait");
+    return Next(next, "pthread_cond_timedwait")(condition, mutex, time);
+}
+
+int pthread_join(pthread_t thread, void **result) {
+    static int (*next)(pthread_t, void **) = nullptr;
+    RealtimeSafety::ReportBlockingCall("pthread_join");
+    return Next(next, "pthread_join")(thread, result);
+}
+
+int sem_wait(sem_t *semaphore) {
+    static int (*next)(sem_t *) = nullptr;
+    RealtimeSafety::ReportBlockingCall("sem_wait");
+    return Next(next, "sem_wait")(semaphore);
+}
+
+int nanosleep(const struct timespec *duration, struct timespec *remaining) {
+    static int (*next)(const struct timespec *, struct timespec *) = nullptr;
+    RealtimeSafety::ReportBlockingCall("nanosleep");
+    return Next(next, "nanosleep")(duration, remaining);
+}
+
+int clock_nanosleep(clockid_t clock, int flags, const struct timespec *time, struct timespec *remaining) {
+    static int (*next)(clockid_t, int, const struct timespec *, struct timespec *) = nullptr;
+    RealtimeSafety::ReportBlockingCall("clock_nanosleep");
+    return Next(next, "clock_nanosleep")(clock, flags, time, remaining);
+}
+
+} // extern "C"
+
+#endif
@@ -0,0 +1,97 @@
+#include "m1_mathematics/RelativeRotation.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "m1_mathematics/RealtimeSafety.h"
+
+using namespace Mach1;
+
+namespace {
+
+/**
+ * @brief Multiply one listener's inverse by a run of objects
+ * The output never overlaps the inputs; __restrict (GCC, Clang and MSVC) tells the compiler so, which lets it
+ * vectorize the loop without per-pointer runtime overlap checks
+ */
+void MultiplyRun(float aw, float ax, float ay, float az,
+                 const float *__restrict ow, const float *__restrict ox,
+                 const float *__restrict oy, const float *__restrict oz,
+                 float *__restrict rw, float *__restrict rx, float *__restrict ry, float *__restrict rz,
+                 size_t count) {
+    for (size_t o = 0; o < count; o++) {
+        float bw = ow[o], bx = ox[o], by = oy[o], bz = oz[o];
+        rw[o] = aw * bw - ax * bx - ay * by - az * bz;
+        rx[o] = aw * bx + ax * bw + ay * bz - az * by;
+        ry[o] = aw * by + ay * bw + az * bx - ax * bz;
+        rz[o] = aw * bz + az * bw + ax * by - ay * bx;
+    }
+}
+
+} // namespace
+
+void RelativeRotation::Compute(const QuaternionBatch &listeners, const QuaternionBatch &objects,
+                               QuaternionBatch &output, unsigned thread_count) {
+    size_t object_count = objects.Size();
+    output.Resize(listeners.Size() * object_count);
+
+    // Threads only pay off for whole tiles, so never split finer than one tile per thread
+    size_t tile_count = (object_count + TILE_SIZE - 1) / TILE_SIZE;
+    size_t worker_count = std::min<size_t>(thread_count, tile_count);
+    if (worker_count <= 1) {
+        ComputeRange(listeners, objects, output, 0, object_count);
+        return;
+    }
+
+    // Starting and joining threads allocates and blocks; real-time callers schedule ComputeRange themselves
+    M1_REALTIME_UNSAFE("RelativeRotation::Compute with threads");
+    size_t tiles_per_worker = (tile_count + worker_count - 1) / worker_count;
+    std::vector<std::thread> workers;
+    workers.reserve(worker_count - 1);
+    for (size_t worker = 1; worker < worker_count; worker++) {
+        size_t first = std::min(worker * tiles_per_worker * TILE_SIZE, object_count);
+        size_t last = std::min(first + tiles_per_worker * TILE_SIZE, object_count);
+        workers.emplace_back([&listeners, &objects, &output, first, last]() {
+            ComputeRange(listeners, objects, output, first, last - first);
+        });
+    }
+
+    // The calling thread takes the first range
+    ComputeRange(listeners, objects, output, 0, std::min(tiles_per_worker * TILE_SIZE, object_count));
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+void RelativeRotation::ComputeRange(const QuaternionBatch &listeners, const QuaternionBatch &objects,
+                                    QuaternionBatch &output, size_t first_object, size_t object_count) {
+    M1_REALTIME_SAFE;
+
+    size_t row_length = objects.Size();
+    const float *lw = listeners.W();
+    const float *lx = listeners.X();
+    const float *ly = listeners.Y();
+    const float *lz = listeners.Z();
+    const float *ow = objects.W();
+    const float *ox = objects.X();
+    const float *oy = objects.Y();
+    const float *oz = objects.Z();
+
+    size_t end = first_object + object_count;
+    for (size_t tile = first_object; tile < end; tile += TILE_SIZE) {
+        size_t tile_end = std::min(tile + TILE_SIZE, end);
+
+        for (size_t l = 0; l < listeners.Size(); l++) {
+            // The listener's inverse is its conjugate (w, -x, -y, -z)
+            float aw = lw[l];
+            float ax = -lx[l];
+            float ay = -ly[l];
+            float az = -lz[l];
+
+            size_t row = l * row_length + tile;
+            MultiplyRun(aw, ax, ay, az, ow + tile, ox + tile, oy + tile, oz + tile,
+                        output.W() + row, output.X() + row, output.Y() + row, output.Z() + row, tile_end - tile);
+        }
+    }
+}
@@ -0,0 +1,186 @@
+#include "m1_mathematics/SourceCuller.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+using namespace Mach1;
+
+namespace {
+
+/**
+ * Add one to the bucket of every source beyond an edge. The bytes written never overlap the cosines read; __restrict
+ * says so, since a uint8_t store may otherwise alias anything
+ */
+void CountEdge(const float *__restrict cosines, uint8_t *__restrict buckets, float edge_cosine, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        buckets[i] += static_cast<uint8_t>(cosines[i] < edge_cosine);
+    }
+}
+
+} // namespace
+
+SourceCuller::SourceCuller() : SourceCuller({
+        static_cast<float>(M_PI / 6.0),
+        static_cast<float>(M_PI / 3.0),
+        static_cast<float>(M_PI * 11.0 / 18.0),
+        static_cast<float>(M_PI)}) {
+}
+
+SourceCuller::SourceCuller(std::vector<float> bucket_edges_radians) : m_forward{1, 0, 0} {
+    SetBucketEdges(std::move(bucket_edges_radians));
+}
+
+void SourceCuller::SetBucketEdges(std::vector<float> bucket_edges_radians) {
+    if (bucket_edges_radians.size() > 255) {
+        bucket_edges_radians.resize(255);
+    }
+
+    m_bucket_edges = std::move(bucket_edges_radians);
+    m_bucket_cosines.resize(m_bucket_edges.size());
+    for (size_t i = 0; i < m_bucket_edges.size(); i++) {
+        // An edge at PI must keep every source; its cosine is exactly -1, which no clamped cosine falls below
+        m_bucket_cosines[i] = m_bucket_edges[i] >= static_cast<float>(M_PI) ? -1.0f : std::cos(m_bucket_edges[i]);
+    }
+
+    // Results of the previous classification no longer line up with the buckets
+    m_bucket_offsets.assign(m_bucket_edges.size() + 1, 0);
+    m_sorted_indices.clear();
+    m_selected.clear();
+}
+
+const std::vector<float> &SourceCuller::GetBucketEdges() const {
+    return m_bucket_edges;
+}
+
+size_t SourceCuller::GetBucketCount() const {
+    return m_bucket_edges.size();
+}
+
+void SourceCuller::SetListener(Quaternion global_rotation) {
+    Quaternion q = global_rotation.Normalized();
+    float w = q.GetW();
+    float x = q.GetX();
+    float y = q.GetY();
+    float z = q.GetZ();
+
+    // The listener's forward axis in (forward, left, up) order: the first column of its rotation matrix
+    m_forward[0] = 1.0f - 2.0f * (y * y + z * z);
+    m_forward[1] = 2.0f * (x * y + w * z);
+    m_forward[2] = 2.0f * (x * z - w * y);
+}
+
+void SourceCuller::SetListener(const Orientation &listener) {
+    SetListener(listener.GetGlobalRotationAsQuaternion());
+}
+
+size_t SourceCuller::Classify(const Float3Batch &source_directions) {
+    return Classify(source_directions.Yaw(), source_directions.Pitch(), source_directions.Roll(),
+                    source_directions.Size());
+}
+
+size_t SourceCuller::Classify(const float *yaw, const float *pitch, const float *roll, size_t count) {
+    m_cosines.resize(count);
+    m_buckets.resize(count);
+    float *cosines = m_cosines.data();
+    uint8_t *buckets = m_buckets.data();
+    float forward_x = m_forward[0];
+    float forward_y = m_forward[1];
+    float forward_z = m_forward[2];
+
+    for (size_t i = 0; i < count; i++) {
+        float dot = forward_x * roll[i] + forward_y * pitch[i] + forward_z * yaw[i];
+        float length_squared = roll[i] * roll[i] + pitch[i] * pitch[i] + yaw[i] * yaw[i];
+        float cosine = length_squared > 0.0f ? dot / std::sqrt(length_squared) : 1.0f;
+        cosines[i] = std::min(std::max(cosine, -1.0f), 1.0f);
+    }
+
+    // A source's bucket is the number of edges it lies beyond, counted one edge at a time over the whole batch
+    std::fill(buckets, buckets + count, static_cast<uint8_t>(0));
+    for (float edge_cosine : m_bucket_cosines) {
+        CountEdge(cosines, buckets, edge_cosine, count);
+    }
+
+    // Counting sort keeps ascending source order within each bucket
+    size_t bucket_count = GetBucketCount();
+    m_bucket_offsets.assign(bucket_count + 2, 0);
+    for (size_t i = 0; i < count; i++) {
+        m_bucket_offsets[buckets[i] + 1]++;
+    }
+    for (size_t bucket = 0; bucket <= bucket_count; bucket++) {
+        m_bucket_offsets[bucket + 1] += m_bucket_offsets[bucket];
+    }
+
+    size_t kept = m_bucket_offsets[bucket_count];
+    m_sorted_indices.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        m_sorted_indices[m_bucket_offsets[buckets[i]]++] = static_cast<uint32_t>(i);
+    }
+
+    // Scattering advanced each offset to the next bucket's start; shift them back
+    for (size_t bucket = bucket_count; bucket > 0; bucket--) {
+        m_bucket_offsets[bucket] = m_bucket_offsets[bucket - 1];
+    }
+    m_bucket_offsets[0] = 0;
+    m_bucket_offsets.pop_back();
+
+    m_sorted_indices.resize(kept);
+    return kept;
+}
+
+const std::vector<uint32_t> &SourceCuller::GetSortedIndices() const {
+    return m_sorted_indices;
+}
+
+size_t SourceCuller::GetBucketBegin(size_t bucket) const {
+    return m_bucket_offsets[bucket];
+}
+
+size_t SourceCuller::GetBucketEnd(size_t bucket) const {
+    return m_bucket_offsets[bucket + 1];
+}
+
+size_t SourceCuller::GetBucket(size_t source) const {
+    return m_buckets[source];
+}
+
+const float *SourceCuller::GetCosines() const {
+    return m_cosines.data();
+}
+
+float SourceCuller::GetAngularOffset(size_t source) const {
+    return std::acos(m_cosines[source]);
+}
+
+const std::vector<uint32_t> &SourceCuller::Select(size_t budget) {
+    size_t bucket_count = GetBucketCount();
+    size_t kept = m_sorted_indices.size();
+
+    size_t bucket = 0;
+    while (bucket < bucket_count && GetBucketEnd(bucket) <= budget) {
+        bucket++;
+    }
+
+    size_t whole = bucket < bucket_count ? GetBucketBegin(bucket) : kept;
+    m_selected.assign(m_sorted_indices.begin(), m_sorted_indices.begin() + whole);
+
+    if (bucket < bucket_count && whole < budget) {
+        // Fill the rest of the budget from the bucket that does not fit, most central sources first
+        size_t first = m_selected.size();
+        m_selected.insert(m_selected.end(),
+                          m_sorted_indices.begin() + GetBucketBegin(bucket),
+                          m_sorted_indices.begin() + GetBucketEnd(bucket));
+
+        const float *cosines = m_cosines.data();
+        auto more_central = [cosines](uint32_t a, uint32_t b) {
+            return cosines[a] > cosines[b] || (cosines[a] == cosines[b] && a < b);
+        };
+        std::partial_sort(m_selected.begin() + first, m_selected.begin() + budget, m_selected.end(), more_central);
+        m_selected.resize(budget);
+    }
+    return m_selected;
+}
@@ -0,0 +1,13 @@
+#include "m1_mathematics/StaticRotation.h"
+
+using namespace Mach1;
+
+Float3 RotationMatrix::Rotate(Float3 vector) const {
+    float x = vector.GetRoll();
+    float y = vector.GetPitch();
+    float z = vector.GetYaw();
+
+    return {m[2][0] * x + m[2][1] * y + m[2][2] * z,
+            m[1][0] * x + m[1][1] * y + m[1][2] * z,
+            m[0][0] * x + m[0][1] * y + m[0][2] * z};
+}
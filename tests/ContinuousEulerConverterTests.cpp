@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+#include "m1_mathematics/ContinuousEulerConverter.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+
+// Angle of the rotation taking a to b, sign of either quaternion ignored
+double AngleBetween(Mach1::Quaternion a, Mach1::Quaternion b) {
+    double dot = static_cast<double>(a.GetW()) * b.GetW() + static_cast<double>(a.GetX()) * b.GetX() +
+                 static_cast<double>(a.GetY()) * b.GetY() + static_cast<double>(a.GetZ()) * b.GetZ();
+    Mach1::Quaternion difference = a.Inversed() * b;
+    double vector = std::sqrt(static_cast<double>(difference.GetX()) * difference.GetX() +
+                              static_cast<double>(difference.GetY()) * difference.GetY() +
+                              static_cast<double>(difference.GetZ()) * difference.GetZ());
+    return 2.0 * std::atan2(vector, std::fabs(dot));
+}
+
+} // namespace
+
+TEST(ContinuousEulerConverterTests, FirstFrameMatchesToEulerRadians) {
+    using namespace Mach1;
+
+    Quaternion rotation = Quaternion::FromEulerRadians({2.5f, -0.4f, -3.0f});
+    Float3 expected = rotation.ToEulerRadians();
+
+    ContinuousEulerConverter converter;
+    Float3 actual = converter.Convert(0, rotation);
+    EXPECT_NEAR(actual.GetYaw(), expected.GetYaw(), 1e-5f);
+    EXPECT_NEAR(actual.GetPitch(), expected.GetPitch(), 1e-5f);
+    EXPECT_NEAR(actual.GetRoll(), expected.GetRoll(), 1e-5f);
+    EXPECT_FALSE(converter.IsLocked(0));
+}
+
+TEST(ContinuousEulerConverterTests, YawAndRollUnwrap) {
+    using namespace Mach1;
+
+    ContinuousEulerConverter converter;
+    for (int step = 0; step <= 400; step++) {
+        float yaw = 0.05f * step;
+        float roll = -0.07f * step;
+        Float3 actual = converter.Convert(0, Quaternion::FromEulerRadians({yaw, 0.3f, roll}));
+        ASSERT_NEAR(actual.GetYaw(), yaw, 1e-3f) << "step " << step;
+        ASSERT_NEAR(actual.GetPitch(), 0.3f, 1e-4f) << "step " << step;
+        ASSERT_NEAR(actual.GetRoll(), roll, 1e-3f) << "step " << step;
+    }
+
+    // Several turns each way, far outside [-PI, PI]
+    EXPECT_GT(converter.Convert(0, Quaternion::FromEulerRadians({20.0f, 0.3f, -28.0f})).GetYaw(), 3.0f * M_PI);
+
+    converter.Reset(0);
+    Float3 wrapped = converter.Convert(0, Quaternion::FromEulerRadians({20.0f, 0.3f, -28.0f}));
+    EXPECT_LE(std::fabs(wrapped.GetYaw()), M_PI);
+    EXPECT_LE(std::fabs(wrapped.GetRoll()), M_PI);
+}
+
+TEST(ContinuousEulerConverterTests, GimbalLockHoldsRollAndStaysContinuous) {
+    using namespace Mach1;
+
+    ContinuousEulerConverter converter(1, 0.02f, 0.06f);
+
+    // Pitch over the pole at +PI/2 and back, yawing and rolling the whole time
+    Float3 previous = converter.Convert(0, Quaternion::FromEulerRadians({0.0f, 1.2f, 0.5f}));
+    float held_roll = 0.0f;
+    bool was_locked = false;
+    bool ever_locked = false;
+    for (int step = 1; step <= 200; step++) {
+        float t = step / 200.0f;
+        float pitch = 1.2f + (static_cast<float>(M_PI / 2.0) - 1.2f) * std::sin(static_cast<float>(M_PI) * t);
+        Quaternion rotation = Quaternion::FromEulerRadians({0.8f * t, pitch, 0.5f + 0.3f * t});
+        Float3 actual = converter.Convert(0, rotation);
+
+        if (converter.IsLocked(0)) {
+            if (!was_locked) {
+                held_roll = previous.GetRoll();
+            }
+            ever_locked = true;
+            EXPECT_FLOAT_EQ(actual.GetRoll(), held_roll) << "step " << step;
+        }
+        was_locked = converter.IsLocked(0);
+
+        // Locked output is still the same rotation, up to the approximation inside the narrow band
+        EXPECT_LT(AngleBetween(Quaternion::FromEulerRadians(actual), rotation), 0.05) << "step " << step;
+
+        // The plain conversion flips yaw and roll by up to PI in this sweep; the continuous one only steps
+        // by what is needed to leave the lock
+        EXPECT_LT(std::fabs(actual.GetYaw() - previous.GetYaw()), 0.5f) << "step " << step;
+        EXPECT_LT(std::fabs(actual.GetRoll() - previous.GetRoll()), 0.5f) << "step " << step;
+        previous = actual;
+    }
+    EXPECT_TRUE(ever_locked);
+    EXPECT_FALSE(converter.IsLocked(0));
+}
+
+TEST(ContinuousEulerConverterTests, LockHasHysteresis) {
+    using namespace Mach1;
+
+    ContinuousEulerConverter converter(1, 0.02f, 0.06f);
+    float pole = static_cast<float>(M_PI / 2.0);
+
+    converter.Convert(0, Quaternion::FromEulerRadians({0.0f, pole - 0.04f, 0.0f}));
+    EXPECT_FALSE(converter.IsLocked(0));
+
+    converter.Convert(0, Quaternion::FromEulerRadians({0.0f, pole - 0.01f, 0.0f}));
+    EXPECT_TRUE(converter.IsLocked(0));
+
+    // Between the two margins the track keeps its state
+    converter.Convert(0, Quaternion::FromEulerRadians({0.0f, pole - 0.04f, 0.0f}));
+    EXPECT_TRUE(converter.IsLocked(0));
+
+    converter.Convert(0, Quaternion::FromEulerRadians({0.0f, pole - 0.08f, 0.0f}));
+    EXPECT_FALSE(converter.IsLocked(0));
+
+    // A track starting at the pole holds a roll of zero, which the existing clamp would leave ambiguous
+    converter.Reset();
+    Float3 pole_angles = converter.Convert(0, Quaternion::FromEulerRadians({0.3f, -pole, 0.7f}));
+    EXPECT_TRUE(converter.IsLocked(0));
+    EXPECT_FLOAT_EQ(pole_angles.GetRoll(), 0.0f);
+    EXPECT_NEAR(pole_angles.GetPitch(), -pole, 1e-3f);
+    EXPECT_LT(AngleBetween(Quaternion::FromEulerRadians(pole_angles),
+                           Quaternion::FromEulerRadians({0.3f, -pole, 0.7f})), 1e-3);
+}
+
+TEST(ContinuousEulerConverterTests, BatchMatchesScalar) {
+    using namespace Mach1;
+
+    std::mt19937 generator(48);
+    std::uniform_real_distribution<float> angle(-3.0f, 3.0f);
+    std::uniform_real_distribution<float> pitch(-1.57f, 1.57f);
+
+    const size_t tracks = 37;
+    ContinuousEulerConverter scalar(tracks);
+    ContinuousEulerConverter batch;
+    QuaternionBatch rotations(tracks);
+    Float3Batch output;
+
+    std::vector<Float3> euler(tracks);
+    for (size_t i = 0; i < tracks; i++) {
+        euler[i] = {angle(generator), pitch(generator), angle(generator)};
+    }
+
+    for (int frame = 0; frame < 50; frame++) {
+        for (size_t i = 0; i < tracks; i++) {
+            euler[i] = {euler[i].GetYaw() + 0.2f, euler[i].GetPitch() * 0.99f, euler[i].GetRoll() - 0.15f};
+            rotations.Set(i, Quaternion::FromEulerRadians(euler[i]));
+        }
+
+        batch.Convert(rotations, output);
+        ASSERT_EQ(batch.GetTrackCount(), tracks);
+        ASSERT_EQ(output.Size(), tracks);
+        for (size_t i = 0; i < tracks; i++) {
+            Float3 expected = scalar.Convert(i, rotations.Get(i));
+            ASSERT_EQ(output.Get(i).GetYaw(), expected.GetYaw());
+            ASSERT_EQ(output.Get(i).GetPitch(), expected.GetPitch());
+            ASSERT_EQ(output.Get(i).GetRoll(), expected.GetRoll());
+            ASSERT_EQ(batch.IsLocked(i), scalar.IsLocked(i));
+        }
+    }
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+#include "m1_mathematics/DualQuaternion.h"
+
+TEST(DualQuaternionTests, RotationAndTranslation) {
+    using namespace Mach1;
+
+    Quaternion rotation = Quaternion::FromEulerDegrees({40, -15, 25});
+    Float3 translation = {0.5f, -2.0f, 3.0f};
+    DualQuaternion transform = DualQuaternion::FromRotationTranslation(rotation, translation);
+
+    ASSERT_TRUE(transform.GetRotation().IsApproximatelyEqual(rotation));
+    ASSERT_TRUE(transform.GetTranslation().IsApproximatelyEqual(translation));
+
+    Float3 point = {1.0f, 2.0f, -1.0f};
+    ASSERT_TRUE(transform.TransformPoint(point).IsApproximatelyEqual(rotation.Rotate(point) + translation));
+    ASSERT_TRUE(transform.TransformDirection(point).IsApproximatelyEqual(rotation.Rotate(point)));
+
+    ASSERT_TRUE(DualQuaternion().TransformPoint(point).IsApproximatelyEqual(point));
+    ASSERT_TRUE(DualQuaternion::FromTranslation(translation).TransformPoint(point).IsApproximatelyEqual(point + translation));
+    ASSERT_TRUE(DualQuaternion::FromRotation(rotation).TransformPoint(point).IsApproximatelyEqual(rotation.Rotate(point)));
+}
+
+TEST(DualQuaternionTests, ComposeAndInverse) {
+    using namespace Mach1;
+
+    DualQuaternion a = DualQuaternion::FromRotationTranslation(Quaternion::FromEulerDegrees({90, 0, 0}), {0, 0, 1});
+    DualQuaternion b = DualQuaternion::FromRotationTranslation(Quaternion::FromEulerDegrees({-20, 35, 10}), {1, 2, 3});
+    Float3 point = {-0.5f, 0.25f, 2.0f};
+
+    // The right-hand transform is applied first
+    ASSERT_TRUE((a * b).TransformPoint(point).IsApproximatelyEqual(a.TransformPoint(b.TransformPoint(point))));
+
+    DualQuaternion chain = a;
+    chain *= b;
+    ASSERT_TRUE(chain.IsApproximatelyEqual(a * b));
+
+    ASSERT_TRUE((a.Inversed() * a).IsApproximatelyEqual(DualQuaternion()));
+    ASSERT_TRUE((b * b.Inversed()).IsApproximatelyEqual(DualQuaternion()));
+    ASSERT_TRUE(chain.Inversed().TransformPoint(chain.TransformPoint(point)).IsApproximatelyEqual(point));
+
+    // Turned left by 90 degrees then moved forward: a point one unit ahead ends up one unit left and one ahead
+    ASSERT_TRUE(a.TransformPoint({0, 0, 1}).IsApproximatelyEqual({0, 1, 1}));
+}
+
+TEST(DualQuaternionTests, Normalized) {
+    using namespace Mach1;
+
+    DualQuaternion transform = DualQuaternion::FromRotationTranslation(Quaternion::FromEulerDegrees({10, 20, 30}), {1, 2, 3});
+    ASSERT_TRUE((transform * 3.0f).Normalized().IsApproximatelyEqual(transform));
+
+    // Drift in the dual part along the real part is removed
+    DualQuaternion drifted(transform.GetReal(), transform.GetDual() + transform.GetReal() * 0.01f);
+    ASSERT_TRUE(drifted.Normalized().IsApproximatelyEqual(transform));
+}
+
+TEST(DualQuaternionTests, Sclerp) {
+    using namespace Mach1;
+
+    DualQuaternion from = DualQuaternion::FromRotationTranslation(Quaternion::FromEulerDegrees({10, 5, 0}), {1, 0, 0});
+    DualQuaternion to = DualQuaternion::FromRotationTranslation(Quaternion::FromEulerDegrees({80, -30, 20}), {0, 4, -2});
+
+    ASSERT_TRUE(DualQuaternion::Sclerp(from, to, 0.0f).IsApproximatelyEqual(from));
+    ASSERT_TRUE(DualQuaternion::Sclerp(from, to, 1.0f).IsEquivalent(to));
+    ASSERT_TRUE(DualQuaternion::Sclerp(from, to * -1.0f, 1.0f).IsEquivalent(to));
+
+    // The rotation part follows a slerp
+    for (float t : {0.25f, 0.5f, 0.8f}) {
+        Quaternion rotation = DualQuaternion::Sclerp(from, to, t).GetRotation();
+        ASSERT_TRUE(rotation.IsApproximatelyEqual(Quaternion::Slerp(from.GetRotation(), to.GetRotation(), t)));
+    }
+
+    // Pure translations interpolate linearly
+    DualQuaternion start = DualQuaternion::FromTranslation({0, 0, 0});
+    DualQuaternion end = DualQuaternion::FromTranslation({2, -4, 6});
+    ASSERT_TRUE(DualQuaternion::Sclerp(start, end, 0.25f).GetTranslation().IsApproximatelyEqual({0.5f, -1.0f, 1.5f}));
+
+    // Rotating 90 degrees around a vertical axis one unit ahead keeps that axis fixed the whole way
+    Float3 pivot = {0, 0, 1};
+    Quaternion quarter_turn = Quaternion::FromEulerDegrees({90, 0, 0});
+    DualQuaternion orbit = DualQuaternion::FromRotationTranslation(quarter_turn, pivot - quarter_turn.Rotate(pivot));
+    DualQuaternion halfway = DualQuaternion::Sclerp(DualQuaternion(), orbit, 0.5f);
+    ASSERT_TRUE(halfway.TransformPoint(pivot).IsApproximatelyEqual(pivot));
+    ASSERT_TRUE(halfway.GetRotation().IsApproximatelyEqual(Quaternion::FromEulerDegrees({45, 0, 0})));
+
+    // A screw: turning while rising along the same axis
+    DualQuaternion screw = DualQuaternion::FromRotationTranslation(quarter_turn, {2, 0, 0});
+    DualQuaternion screw_halfway = DualQuaternion::Sclerp(DualQuaternion(), screw, 0.5f);
+    ASSERT_TRUE(screw_halfway.GetTranslation().IsApproximatelyEqual({1, 0, 0}));
+}
+
+TEST(DualQuaternionTests, Blend) {
+    using namespace Mach1;
+
+    DualQuaternion a = DualQuaternion::FromRotationTranslation(Quaternion::FromEulerDegrees({30, 10, -5}), {1, 0, 2});
+    DualQuaternion b = DualQuaternion::FromRotationTranslation(Quaternion::FromEulerDegrees({-40, 25, 15}), {-1, 3, 0});
+
+    DualQuaternion transforms[] = {a, b * -1.0f};
+    float weights[] = {0.5f, 0.5f};
+
+    // With two equal weights, blending matches the screw midpoint
+    DualQuaternion blended = DualQuaternion::Blend(transforms, weights, 2);
+    ASSERT_TRUE(blended.IsEquivalent(DualQuaternion::Sclerp(a, b, 0.5f)));
+
+    float single_weight[] = {2.0f};
+    ASSERT_TRUE(DualQuaternion::Blend(transforms, single_weight, 1).IsApproximatelyEqual(a));
+    ASSERT_TRUE(DualQuaternion::Blend(transforms, weights, 0).IsApproximatelyEqual(DualQuaternion()));
+
+    // The result is a unit transform
+    ASSERT_NEAR(blended.GetReal().Length(), 1.0f, 1e-6);
+    ASSERT_NEAR(blended.GetReal().DotProduct(blended.GetDual()), 0.0f, 1e-6);
+}
+
+TEST(DualQuaternionTests, TransformPoints) {
+    using namespace Mach1;
+
+    DualQuaternion transform = DualQuaternion::FromRotationTranslation(Quaternion::FromEulerDegrees({-65, 30, 12}), {4, -1, 0.5f});
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> coordinate(-5.0f, 5.0f);
+
+    Float3Batch points(257);
+    for (size_t i = 0; i < points.Size(); i++) {
+        points.Set(i, {coordinate(rng), coordinate(rng), coordinate(rng)});
+    }
+
+    Float3Batch output;
+    transform.TransformPoints(points, output);
+    ASSERT_EQ(output.Size(), points.Size());
+    for (size_t i = 0; i < points.Size(); i++) {
+        ASSERT_TRUE(output.Get(i).IsApproximatelyEqual(transform.TransformPoint(points.Get(i)))) << i;
+    }
+
+    // In place
+    Float3Batch in_place = points;
+    transform.TransformPoints(in_place, in_place);
+    for (size_t i = 0; i < points.Size(); i++) {
+        ASSERT_TRUE(in_place.Get(i).IsApproximatelyEqual(output.Get(i))) << i;
+    }
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+#include "m1_mathematics/EulerQuaternionCache.h"
+
+TEST(EulerQuaternionCacheTests, MatchesFromEulerDegrees) {
+    using namespace Mach1;
+
+    EulerQuaternionCache cache(3600);
+    ASSERT_EQ(cache.GetStepsPerTurn(), 3600);
+    ASSERT_NEAR(cache.GetStepDegrees(), 0.1f, 1e-6);
+    ASSERT_EQ(cache.GetMemoryUsage(), 3600 * 8);
+
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> tenths(-1800, 1799);
+    for (int i = 0; i < 1000; i++) {
+        Float3 euler(tenths(rng) * 0.1f, tenths(rng) * 0.1f, tenths(rng) * 0.1f);
+        Quaternion expected = Quaternion::FromEulerDegrees(euler);
+        Quaternion actual = cache.FromEulerDegrees(euler);
+        for (int c = 0; c < 4; c++) {
+            ASSERT_NEAR(actual[c], expected[c], 1e-6) << euler.ToString();
+        }
+    }
+
+    ASSERT_TRUE(cache.FromEulerDegrees({}).IsApproximatelyEqual(Quaternion()));
+    ASSERT_TRUE(cache.FromEulerRadians(Float3(30, -45, 60).EulerRadians()).IsApproximatelyEqual(Quaternion::FromEulerDegrees({30, -45, 60})));
+}
+
+TEST(EulerQuaternionCacheTests, Steps) {
+    using namespace Mach1;
+
+    // 7-bit MIDI across a full turn
+    EulerQuaternionCache cache(128);
+    ASSERT_EQ(cache.ToStep(-180.0f), 0);
+    ASSERT_EQ(cache.ToStep(0.0f), 64);
+    ASSERT_EQ(cache.ToStep(180.0f), 0);
+    ASSERT_EQ(cache.ToStep(179.0f), 0);
+    ASSERT_EQ(cache.ToStep(90.0f), 96);
+
+    ASSERT_TRUE(cache.FromEulerSteps(96, 64, 64).IsApproximatelyEqual(Quaternion::FromEulerDegrees({90, 0, 0})));
+    ASSERT_TRUE(cache.FromEulerSteps(96 + 128, 64 - 256, 64).IsApproximatelyEqual(cache.FromEulerSteps(96, 64, 64)));
+
+    // Angles snap to the nearest step
+    ASSERT_TRUE(cache.FromEulerDegrees({91.0f, 0.0f, 0.0f}).IsApproximatelyEqual(Quaternion::FromEulerDegrees({90, 0, 0})));
+}
+
+TEST(EulerQuaternionCacheTests, MemoryBudget) {
+    using namespace Mach1;
+
+    EulerQuaternionCache cache(36000, 8 * 1000);
+    ASSERT_EQ(cache.GetStepsPerTurn(), 1000);
+    ASSERT_LE(cache.GetMemoryUsage(), 8 * 1000);
+}
+
+TEST(EulerQuaternionCacheTests, Batch) {
+    using namespace Mach1;
+
+    EulerQuaternionCache cache(720);
+    Float3Batch euler(100);
+    for (size_t i = 0; i < euler.Size(); i++) {
+        euler.Set(i, {i * 3.5f - 170.0f, i * 1.5f - 80.0f, i * -2.5f + 120.0f});
+    }
+
+    QuaternionBatch output;
+    cache.FromEulerDegrees(euler, output);
+    ASSERT_EQ(output.Size(), euler.Size());
+    for (size_t i = 0; i < euler.Size(); i++) {
+        ASSERT_TRUE(output.Get(i).IsApproximatelyEqual(cache.FromEulerDegrees(euler.Get(i))));
+    }
+}
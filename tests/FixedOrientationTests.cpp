@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "m1_mathematics/FixedOrientation.h"
+#include "m1_mathematics/Orientation.h"
+
+namespace {
+
+// The exact result of applying the given rotation `count` times: the same axis, `count` times the angle
+Mach1::Quaternion RepeatedRotation(Mach1::Quaternion step, int count) {
+    double w = step.GetW(), x = step.GetX(), y = step.GetY(), z = step.GetZ();
+    double length = std::sqrt(w * w + x * x + y * y + z * z);
+    double vector_length = std::sqrt(x * x + y * y + z * z);
+    double half_angle = std::atan2(vector_length / length, w / length) * count;
+    double scale = std::sin(half_angle) / vector_length;
+    return {float(std::cos(half_angle)), float(x * scale), float(y * scale), float(z * scale)};
+}
+
+double AngleBetween(Mach1::Quaternion a, Mach1::Quaternion b) {
+    // atan2 of the difference rotation, which stays accurate for tiny angles where acos of the dot product does not
+    Mach1::Quaternion difference = a.Normalized().Inversed() * b.Normalized();
+    double vector_length = std::sqrt(double(difference.GetX()) * difference.GetX() +
+                                     double(difference.GetY()) * difference.GetY() +
+                                     double(difference.GetZ()) * difference.GetZ());
+    return 2.0 * std::atan2(vector_length, std::fabs(double(difference.GetW())));
+}
+
+} // namespace
+
+TEST(FixedOrientationTests, Accumulation) {
+    using namespace Mach1;
+
+    // A long session of small tracker updates. For steps this small, float Orientation drifts too (w rounds
+    // to one), so the reference is computed in closed form instead
+    const int step_count = 2000;
+    QuaternionQ15 step15 = QuaternionQ15::FromEuler(FixedFloat3Q15::FromEulerRadians(Float3(0.5f, -0.2f, 0.3f).EulerRadians()));
+    QuaternionQ31 step31 = QuaternionQ31::FromEuler(FixedFloat3Q31::FromEulerRadians(Float3(0.05f, -0.02f, 0.03f).EulerRadians()));
+
+    OrientationQ15 orientation15;
+    OrientationQ31 orientation31;
+    for (int i = 0; i < step_count; i++) {
+        orientation15.ApplyRotation(step15);
+        orientation31.ApplyRotation(step31);
+    }
+
+    Quaternion actual15 = orientation15.GetGlobalRotation().ToQuaternion();
+    Quaternion actual31 = orientation31.GetGlobalRotation().ToQuaternion();
+    ASSERT_LT(AngleBetween(actual15, RepeatedRotation(step15.ToQuaternion(), step_count)), 0.03f);
+    ASSERT_LT(AngleBetween(actual31, RepeatedRotation(step31.ToQuaternion(), step_count)), 1e-4f);
+
+    // Renormalization keeps the length at one
+    ASSERT_NEAR(actual15.Length(), 1.0f, 1e-3f);
+    ASSERT_NEAR(actual31.Length(), 1.0f, 1e-6f);
+
+    // Larger steps agree with the float Orientation
+    Orientation reference;
+    OrientationQ31 orientation;
+    FixedFloat3Q31 step = FixedFloat3Q31::FromEulerRadians(Float3(7, -3, 11).EulerRadians());
+    for (int i = 0; i < 100; i++) {
+        reference.ApplyRotation(step.ToEulerRadians());
+        orientation.ApplyRotation(step);
+    }
+    ASSERT_LT(AngleBetween(orientation.GetGlobalRotation().ToQuaternion(), reference.GetGlobalRotationAsQuaternion()), 1e-4f);
+}
+
+TEST(FixedOrientationTests, Recenter) {
+    using namespace Mach1;
+
+    OrientationQ31 orientation;
+    orientation.ApplyRotation(FixedFloat3Q31::FromEulerRadians(Float3(40, 10, -20).EulerRadians()));
+    orientation.Recenter();
+    Float3 euler = orientation.GetGlobalRotationAsEuler().ToEulerRadians();
+    for (int i = 0; i < 3; i++) {
+        ASSERT_NEAR(euler[i], 0.0f, 1e-6f);
+    }
+
+    orientation.ApplyRotation(FixedFloat3Q31::FromEulerRadians(Float3(15, 0, 0).EulerRadians()));
+    ASSERT_NEAR(orientation.GetGlobalRotationAsEuler().ToEulerRadians().GetYaw(), 15 * M_PI / 180, 1e-5);
+
+    orientation.SetGlobalRotation(QuaternionQ31::FromQuaternion(Quaternion::FromEulerDegrees({0, 0, 30})));
+    ASSERT_NEAR(orientation.GetGlobalRotationAsEuler().ToEulerRadians().GetRoll(), 30 * M_PI / 180, 1e-5);
+
+    orientation.Reset();
+    ASSERT_TRUE(orientation.GetGlobalRotation().ToQuaternion().IsApproximatelyEqual(Quaternion()));
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "m1_mathematics/FixedPoint.h"
+
+TEST(FixedPointTests, Conversions) {
+    using namespace Mach1;
+
+    ASSERT_EQ(FixedPoint::FromFloat<int16_t>(0.5f), 16384);
+    ASSERT_EQ(FixedPoint::FromFloat<int16_t>(1.0f), std::numeric_limits<int16_t>::max());
+    ASSERT_EQ(FixedPoint::FromFloat<int16_t>(-1.0f), -32768);
+    ASSERT_EQ(FixedPoint::FromFloat<int16_t>(-3.0f), -32768);
+    ASSERT_EQ(FixedPoint::FromFloat<int32_t>(-0.25f), -(int32_t(1) << 29));
+    ASSERT_EQ(FixedPoint::FromFloat<int32_t>(2.0f), std::numeric_limits<int32_t>::max());
+
+    ASSERT_FLOAT_EQ(FixedPoint::ToFloat<int16_t>(-16384), -0.5f);
+    ASSERT_EQ(FixedPoint::ToQ31<int16_t>(16384), int32_t(1) << 30);
+    ASSERT_EQ(FixedPoint::FromQ31<int16_t>(int32_t(1) << 30), 16384);
+    // Rounds to nearest and saturates when narrowing
+    ASSERT_EQ(FixedPoint::FromQ31<int16_t>((int32_t(1) << 30) + (1 << 15)), 16385);
+    ASSERT_EQ(FixedPoint::FromQ31<int16_t>(std::numeric_limits<int32_t>::max()), 32767);
+}
+
+TEST(FixedPointTests, SinCos) {
+    using namespace Mach1;
+
+    for (int64_t step = -512; step < 512; step++) {
+        int32_t angle = int32_t(step * (int64_t(1) << 22) + 12345);
+        int32_t sine, cosine;
+        FixedPoint::SinCos(angle, sine, cosine);
+
+        double radians = double(angle) / double(int64_t(1) << 31) * M_PI;
+        ASSERT_NEAR(double(sine) / double(int64_t(1) << 31), std::sin(radians), 5e-8) << angle;
+        ASSERT_NEAR(double(cosine) / double(int64_t(1) << 31), std::cos(radians), 5e-8) << angle;
+    }
+
+    int32_t sine, cosine;
+    FixedPoint::SinCos(0, sine, cosine);
+    ASSERT_EQ(cosine, std::numeric_limits<int32_t>::max());
+    ASSERT_LE(std::abs(sine), 16);
+}
+
+TEST(FixedPointTests, Atan2) {
+    using namespace Mach1;
+
+    for (int i = 0; i < 720; i++) {
+        double radians = (i - 360) * M_PI / 360.0 + 0.001;
+        for (double magnitude : {1e-3, 1.0, 1e6}) {
+            int64_t x = int64_t(std::llround(std::cos(radians) * magnitude * double(int64_t(1) << 30)));
+            int64_t y = int64_t(std::llround(std::sin(radians) * magnitude * double(int64_t(1) << 30)));
+            double result = double(FixedPoint::Atan2(y, x)) / double(int64_t(1) << 31) * M_PI;
+            ASSERT_NEAR(result, std::atan2(double(y), double(x)), 1e-7) << i << " " << magnitude;
+        }
+    }
+
+    ASSERT_EQ(FixedPoint::Atan2(0, 0), 0);
+    ASSERT_NEAR(FixedPoint::Atan2(5, 0), int32_t(1) << 30, 8);
+    ASSERT_NEAR(FixedPoint::Atan2(0, -5), std::numeric_limits<int32_t>::min(), 8);
+}
+
+TEST(FixedPointTests, Sqrt) {
+    using namespace Mach1;
+
+    ASSERT_EQ(FixedPoint::Sqrt(0), 0u);
+    ASSERT_EQ(FixedPoint::Sqrt(1), 1u);
+    ASSERT_EQ(FixedPoint::Sqrt(15), 3u);
+    ASSERT_EQ(FixedPoint::Sqrt(16), 4u);
+    ASSERT_EQ(FixedPoint::Sqrt(uint64_t(1) << 60), uint32_t(1) << 30);
+    ASSERT_EQ(FixedPoint::Sqrt(std::numeric_limits<uint64_t>::max()), std::numeric_limits<uint32_t>::max());
+
+    for (uint64_t value : {2ull, 99ull, 123456789ull, 987654321987ull}) {
+        uint64_t root = FixedPoint::Sqrt(value);
+        ASSERT_LE(root * root, value);
+        ASSERT_GT((root + 1) * (root + 1), value);
+    }
+}
+
+TEST(FixedPointTests, ReciprocalSqrt) {
+    using namespace Mach1;
+
+    for (int fraction_bits : {30, 60}) {
+        for (double value : {1.0, 0.999, 1.0001, 0.25, 0.3, 0.7, 2.0, 3.9, 1e-3, 15.0}) {
+            uint64_t raw = uint64_t(value * std::ldexp(1.0, fraction_bits));
+            int shift;
+            uint32_t result = FixedPoint::ReciprocalSqrt(raw, fraction_bits, shift);
+            double expected = 1.0 / std::sqrt(double(raw) / std::ldexp(1.0, fraction_bits));
+            ASSERT_NEAR(std::ldexp(double(result), -shift) / expected, 1.0, 1e-8) << value;
+        }
+    }
+}
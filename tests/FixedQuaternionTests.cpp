@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+#include "m1_mathematics/FixedQuaternion.h"
+
+namespace {
+
+void ExpectNear(Mach1::Quaternion actual, Mach1::Quaternion expected, float tolerance) {
+    // q and -q are the same rotation
+    float sign = actual.DotProduct(expected) < 0 ? -1.0f : 1.0f;
+    for (int i = 0; i < 4; i++) {
+        ASSERT_NEAR(actual[i] * sign, expected[i], tolerance) << i;
+    }
+}
+
+} // namespace
+
+TEST(FixedQuaternionTests, Identity) {
+    using namespace Mach1;
+
+    ExpectNear(QuaternionQ15().ToQuaternion(), Quaternion(), 1e-4f);
+    ExpectNear(QuaternionQ31().ToQuaternion(), Quaternion(), 1e-7f);
+    ASSERT_EQ(QuaternionQ31().Normalized(), QuaternionQ31());
+    ASSERT_EQ(QuaternionQ15(0, 0, 0, 0).Normalized(), QuaternionQ15());
+
+    QuaternionQ31 q = QuaternionQ31::FromQuaternion(Quaternion::FromEulerDegrees({20, 30, 40}));
+    ExpectNear((q * q.Inversed()).ToQuaternion(), Quaternion(), 1e-7f);
+}
+
+TEST(FixedQuaternionTests, MatchesFloatPath) {
+    using namespace Mach1;
+
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<float> angle(-170.0f, 170.0f);
+    std::uniform_real_distribution<float> pitch(-80.0f, 80.0f);
+
+    for (int i = 0; i < 200; i++) {
+        Float3 euler_a = Float3(angle(rng), pitch(rng), angle(rng)).EulerRadians();
+        Float3 euler_b = Float3(angle(rng), pitch(rng), angle(rng)).EulerRadians();
+        Quaternion a = Quaternion::FromEulerRadians(euler_a);
+        Quaternion b = Quaternion::FromEulerRadians(euler_b);
+
+        QuaternionQ15 a15 = QuaternionQ15::FromEuler(FixedFloat3Q15::FromEulerRadians(euler_a));
+        QuaternionQ31 a31 = QuaternionQ31::FromEuler(FixedFloat3Q31::FromEulerRadians(euler_a));
+        ExpectNear(a15.ToQuaternion(), a, 2e-4f);
+        ExpectNear(a31.ToQuaternion(), a, 1e-6f);
+
+        QuaternionQ15 b15 = QuaternionQ15::FromQuaternion(b);
+        QuaternionQ31 b31 = QuaternionQ31::FromQuaternion(b);
+        ExpectNear((a15 * b15).ToQuaternion(), a * b, 3e-4f);
+        ExpectNear((a31 * b31).ToQuaternion(), a * b, 1e-6f);
+
+        Float3 back15 = a15.ToEuler().ToEulerRadians();
+        Float3 back31 = a31.ToEuler().ToEulerRadians();
+        for (int axis = 0; axis < 3; axis++) {
+            ASSERT_NEAR(back15[axis], euler_a[axis], 2e-3f) << i << " " << axis;
+            ASSERT_NEAR(back31[axis], euler_a[axis], 1e-5f) << i << " " << axis;
+        }
+    }
+}
+
+TEST(FixedQuaternionTests, Normalized) {
+    using namespace Mach1;
+
+    Quaternion rotation = Quaternion::FromEulerDegrees({-35, 12, 77});
+    for (float scale : {0.3f, 0.9f, 0.999f}) {
+        ExpectNear(QuaternionQ15::FromQuaternion(rotation * scale).Normalized().ToQuaternion(), rotation, 1e-4f);
+        ExpectNear(QuaternionQ31::FromQuaternion(rotation * scale).Normalized().ToQuaternion(), rotation, 1e-7f);
+    }
+
+    // Tiny Quaternions still normalize in full precision
+    QuaternionQ31 tiny(3, -4, 0, 0);
+    ExpectNear(tiny.Normalized().ToQuaternion(), Quaternion(0.6f, -0.8f, 0.0f, 0.0f), 1e-7f);
+}
+
+TEST(FixedQuaternionTests, EulerHalfTurns) {
+    using namespace Mach1;
+
+    FixedFloat3Q15 euler = FixedFloat3Q15::FromEulerRadians({float(M_PI_2), float(-M_PI_4), float(3 * M_PI)});
+    ASSERT_EQ(euler.yaw, 16384);
+    ASSERT_EQ(euler.pitch, -8192);
+    // Wrapped into [-PI, PI)
+    ASSERT_EQ(euler.roll, -32768);
+
+    // Gimbal lock reports a quarter turn of pitch
+    FixedFloat3Q31 locked = QuaternionQ31::FromQuaternion(Quaternion::FromEulerDegrees({0, 90, 0})).ToEuler();
+    ASSERT_NEAR(locked.ToEulerRadians().GetPitch(), M_PI_2, 1e-4);
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "m1_mathematics/Float3Batch.h"
+
+namespace {
+
+std::vector<Mach1::Float3> RandomAngles(size_t count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> angle(-720.0f, 720.0f);
+
+    std::vector<Mach1::Float3> values;
+    for (size_t i = 0; i < count; i++) {
+        values.emplace_back(angle(rng), angle(rng), angle(rng));
+    }
+    // Edge cases the kernels must treat like Float3 does
+    values.emplace_back(0.0f);
+    values.emplace_back(180.0f);
+    values.emplace_back(-180.0f);
+    return values;
+}
+
+Mach1::Float3Batch ToBatch(const std::vector<Mach1::Float3> &values) {
+    Mach1::Float3Batch batch(values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        batch.Set(i, values[i]);
+    }
+    return batch;
+}
+
+} // namespace
+
+TEST(Float3BatchTests, Construction) {
+    Mach1::Float3Batch batch(3);
+    ASSERT_EQ(batch.Size(), 3);
+    for (size_t i = 0; i < batch.Size(); i++) {
+        ASSERT_EQ(batch.Get(i), Mach1::Float3{});
+    }
+
+    batch.Set(1, {1, 2, 3});
+    ASSERT_EQ(batch.Get(1), Mach1::Float3(1, 2, 3));
+    ASSERT_FLOAT_EQ(batch.Pitch()[1], 2);
+}
+
+TEST(Float3BatchTests, MatchesScalarOperations) {
+    using namespace Mach1;
+
+    std::vector<Float3> values = RandomAngles(1000, 17);
+
+    Float3Batch clamped = ToBatch(values);
+    clamped.Clamp({-90, -45, 0}, {90, 45, 10});
+
+    Float3Batch wrapped = ToBatch(values);
+    wrapped.Modulus({-180, -180, -180}, {180, 180, 180});
+
+    Float3Batch mapped = ToBatch(values);
+    mapped.Map(-180, 180, -1, 1);
+
+    Float3Batch normalized = ToBatch(values);
+    normalized.Normalize();
+
+    Float3Batch radians = ToBatch(values);
+    radians.ToEulerRadians();
+
+    Float3Batch degrees = ToBatch(values);
+    degrees.ToEulerDegrees();
+
+    std::vector<float> lengths(values.size());
+    ToBatch(values).Length(lengths.data());
+
+    for (size_t i = 0; i < values.size(); i++) {
+        Float3 v = values[i];
+        ASSERT_EQ(clamped.Get(i), v.Clamped({-90, -45, 0}, {90, 45, 10})) << i;
+        ASSERT_TRUE(wrapped.Get(i).IsApproximatelyEqual(v.Modulus({-180, -180, -180}, {180, 180, 180}))) << i;
+        ASSERT_TRUE(mapped.Get(i).IsApproximatelyEqual(v.Map(-180, 180, -1, 1))) << i;
+        ASSERT_TRUE(normalized.Get(i).IsApproximatelyEqual(v.Normalized())) << i;
+        ASSERT_EQ(radians.Get(i), v.EulerRadians()) << i;
+        ASSERT_EQ(degrees.Get(i), v.EulerDegrees()) << i;
+        ASSERT_FLOAT_EQ(lengths[i], v.Length()) << i;
+    }
+}
+
+TEST(Float3BatchTests, ClampWithInvertedBoundsMatchesScalar) {
+    using namespace Mach1;
+
+    // Every component has min > max, with values above, between and below the bounds
+    Float3 min = {10, 0, -5};
+    Float3 max = {1, -20, -15};
+    std::vector<Float3> values = {{20, 5, 0}, {5, -10, -10}, {-3, -30, -20}};
+
+    Float3Batch clamped = ToBatch(values);
+    clamped.Clamp(min, max);
+    for (size_t i = 0; i < values.size(); i++) {
+        ASSERT_EQ(clamped.Get(i), values[i].Clamped(min, max)) << i;
+        ASSERT_EQ(clamped.Get(i), min) << i;
+    }
+}
+
+TEST(Float3BatchTests, MapWithEmptyRangeZeroes) {
+    Mach1::Float3Batch batch(2);
+    batch.Set(0, {1, 2, 3});
+    batch.Map(5, 5, 0, 1);
+    ASSERT_EQ(batch.Get(0), Mach1::Float3{});
+}
+
+TEST(Float3BatchTests, Operators) {
+    using namespace Mach1;
+
+    std::vector<Float3> lhs = RandomAngles(100, 1);
+    std::vector<Float3> rhs = RandomAngles(100, 2);
+    Float3Batch rhs_batch = ToBatch(rhs);
+    Float3 offset = {1.5f, -2.0f, 3.0f};
+
+    Float3Batch sum = ToBatch(lhs);
+    sum += rhs_batch;
+    Float3Batch difference = ToBatch(lhs);
+    difference -= rhs_batch;
+    Float3Batch product = ToBatch(lhs);
+    product *= rhs_batch;
+    Float3Batch quotient = ToBatch(lhs);
+    quotient /= offset;
+    Float3Batch shifted = ToBatch(lhs);
+    shifted += offset;
+    shifted -= Float3{0.5f};
+    Float3Batch scaled = ToBatch(lhs);
+    scaled *= 2.0f;
+    scaled /= 4.0f;
+
+    for (size_t i = 0; i < lhs.size(); i++) {
+        ASSERT_EQ(sum.Get(i), lhs[i] + rhs[i]);
+        ASSERT_EQ(difference.Get(i), lhs[i] - rhs[i]);
+        ASSERT_EQ(product.Get(i), lhs[i] * rhs[i]);
+        ASSERT_EQ(quotient.Get(i), lhs[i] / offset);
+        ASSERT_EQ(shifted.Get(i), lhs[i] + offset - Float3{0.5f});
+        ASSERT_EQ(scaled.Get(i), lhs[i] * 2.0f / 4.0f);
+    }
+}
+
+TEST(Float3BatchTests, WrapMatchesScalar) {
+    using namespace Mach1;
+
+    std::vector<Float3> values = RandomAngles(1000, 23);
+    values.emplace_back(180.0f, 360.0f, -360.0f);
+    values.emplace_back(-1e-9f, 540.0f, -540.0f);
+
+    Float3 min = {-180, 0, -180};
+    Float3 max = {180, 360, 180};
+
+    Float3Batch batch = ToBatch(values);
+    batch.Wrap(min, max);
+
+    for (size_t i = 0; i < values.size(); i++) {
+        Float3 expected = values[i].Wrapped(min, max);
+        ASSERT_EQ(batch.Get(i), expected) << i;
+        for (int axis = 0; axis < 3; axis++) {
+            ASSERT_GE(expected[axis], min[axis]);
+            ASSERT_LT(expected[axis], max[axis]);
+        }
+    }
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
+#include <cmath>
 
 #include "m1_mathematics/Float3.h"
+#include "m1_mathematics/MathUtility.h"
 
 TEST(Float3Tests, DefaultConstructor) {
     Mach1::Float3 zeroVec = {};
@@ -57,6 +59,12 @@ TEST(Float3Tests, Clamp) {
     ASSERT_EQ(fiveVec.Clamped(tenVec, tenVec), tenVec);
     ASSERT_EQ(zeroVec.Clamped(vec, tenVec), vec);
     ASSERT_EQ(zeroVec.Clamped(tenVec, vec), tenVec);
+
+    // With min > max, min wins whether the value lies above, between or below the bounds
+    Mach1::Float3 twentyVec = {20};
+    ASSERT_EQ(twentyVec.Clamped(tenVec, vec), tenVec);
+    ASSERT_EQ(fiveVec.Clamped(tenVec, vec), tenVec);
+    ASSERT_EQ(minTenVec.Clamped(tenVec, vec), tenVec);
 }
 
 TEST(Float3Tests, EulerConversion) {
@@ -116,3 +124,49 @@ TEST(Float3Tests, DenormalizationOfStandardVector) {
     Float3 denormVec = zeroVec.Map(-1, 1, 150, 250);
     ASSERT_EQ(denormVec, twoHundoVec);
 }
+
+TEST(Float3Tests, WrapExactBoundaries) {
+    using namespace Mach1;
+
+    // [-180, 180): the lower bound is kept, the upper bound wraps onto it
+    ASSERT_EQ(MathUtility::Wrap(-180.0f, -180.0f, 180.0f), -180.0f);
+    ASSERT_EQ(MathUtility::Wrap(180.0f, -180.0f, 180.0f), -180.0f);
+    ASSERT_EQ(MathUtility::Wrap(540.0f, -180.0f, 180.0f), -180.0f);
+    ASSERT_EQ(MathUtility::Wrap(-540.0f, -180.0f, 180.0f), -180.0f);
+    ASSERT_EQ(MathUtility::Wrap(0.0f, -180.0f, 180.0f), 0.0f);
+    ASSERT_EQ(MathUtility::Wrap(360.0f, -180.0f, 180.0f), 0.0f);
+
+    // [0, 360)
+    ASSERT_EQ(MathUtility::Wrap(0.0f, 0.0f, 360.0f), 0.0f);
+    ASSERT_EQ(MathUtility::Wrap(360.0f, 0.0f, 360.0f), 0.0f);
+    ASSERT_EQ(MathUtility::Wrap(-360.0f, 0.0f, 360.0f), 0.0f);
+    ASSERT_EQ(MathUtility::Wrap(720.0f, 0.0f, 360.0f), 0.0f);
+
+    // Values a hair below a boundary must never round onto the excluded upper bound
+    for (float tiny : {-1e-3f, -1e-5f, -1e-7f, -1e-9f, -1e-30f}) {
+        float wrapped = MathUtility::Wrap(tiny, 0.0f, 360.0f);
+        ASSERT_GE(wrapped, 0.0f) << tiny;
+        ASSERT_LT(wrapped, 360.0f) << tiny;
+
+        wrapped = MathUtility::Wrap(180.0f + tiny, -180.0f, 180.0f);
+        ASSERT_GE(wrapped, -180.0f) << tiny;
+        ASSERT_LT(wrapped, 180.0f) << tiny;
+    }
+    ASSERT_NEAR(MathUtility::Wrap(-1e-3f, 0.0f, 360.0f), 359.999f, 1e-4);
+    ASSERT_EQ(MathUtility::Wrap(std::nextafter(180.0f, 0.0f), -180.0f, 180.0f), std::nextafter(180.0f, 0.0f));
+}
+
+TEST(Float3Tests, WrapIsSymmetric) {
+    using namespace Mach1;
+
+    Float3 min = {-180, -90, 0};
+    Float3 max = {180, 90, 360};
+
+    // Values below the minimum wrap exactly like values above the maximum
+    ASSERT_TRUE(Float3(190, 100, 370).Wrapped(min, max).IsApproximatelyEqual({-170, -80, 10}));
+    ASSERT_TRUE(Float3(-190, -100, -10).Wrapped(min, max).IsApproximatelyEqual({170, 80, 350}));
+    ASSERT_TRUE(Float3(-190 - 720, -100 - 540, -10 - 3600).Wrapped(min, max).IsApproximatelyEqual({170, 80, 350}));
+    ASSERT_EQ(Float3(45, -30, 12).Wrapped(min, max), Float3(45, -30, 12));
+
+    ASSERT_EQ(Float3(190, 100, 370).Modulus(min, max), Float3(190, 100, 370).Wrapped(min, max));
+}
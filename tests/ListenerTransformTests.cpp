@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "m1_mathematics/ListenerTransform.h"
+
+TEST(ListenerTransformTests, IdentityListener) {
+    using namespace Mach1;
+
+    ListenerTransform transform;
+
+    // (up, left, forward)
+    Float3 ahead = transform.GetDirection({0, 0, 2});
+    ASSERT_TRUE(ahead.IsApproximatelyEqual({0, 0, 2}));
+
+    Float3 to_the_left = transform.GetDirection({0, 3, 0});
+    ASSERT_TRUE(to_the_left.IsApproximatelyEqual({M_PI_2, 0, 3}));
+
+    Float3 above = transform.GetDirection({1, 0, 0});
+    ASSERT_NEAR(above[1], M_PI_2, 1e-6);
+
+    Float3 behind_right_below = transform.GetDirection({-1, -1, -1});
+    ASSERT_NEAR(behind_right_below[0], -3 * M_PI_4, 1e-6);
+    ASSERT_NEAR(behind_right_below[1], -std::atan(1 / std::sqrt(2.0)), 1e-6);
+    ASSERT_NEAR(behind_right_below[2], std::sqrt(3.0), 1e-6);
+
+    ASSERT_TRUE(transform.GetDirection({}).IsApproximatelyEqual({}));
+}
+
+TEST(ListenerTransformTests, RotatedAndMovedListener) {
+    using namespace Mach1;
+
+    // A listener at (up 0, left 1, forward 1), turned 90 degrees to the left
+    Orientation listener;
+    listener.ApplyRotationDegrees_YawAxis(90);
+    ListenerTransform transform(listener, {0, 1, 1});
+
+    // A source ahead of the listener in world space is now to its right
+    Float3 direction = transform.GetDirection({0, 1, 3});
+    ASSERT_NEAR(direction[0], -M_PI_2, 1e-6);
+    ASSERT_NEAR(direction[2], 2, 1e-6);
+
+    // Recentering the listener restores straight ahead
+    listener.Recenter();
+    transform.SetListener(listener, {0, 1, 1});
+    ASSERT_NEAR(transform.GetDirection({0, 1, 3})[0], 0, 1e-6);
+}
+
+TEST(ListenerTransformTests, MatchesQuaternionRotation) {
+    using namespace Mach1;
+
+    Quaternion rotation = Quaternion::FromEulerDegrees({35, -20, 10});
+    Float3 position = {0.5f, -1.0f, 2.0f};
+    ListenerTransform transform;
+    transform.SetListener(rotation, position);
+
+    Float3 source = {3.0f, 1.0f, -4.0f};
+    ASSERT_TRUE(transform.ToListenerSpace(source).IsApproximatelyEqual(rotation.Inversed().Rotate(source - position)));
+}
+
+TEST(ListenerTransformTests, BatchMatchesScalar) {
+    using namespace Mach1;
+
+    Orientation listener;
+    listener.ApplyRotationDegrees({-70, 15, 5});
+    ListenerTransform transform(listener, {0.2f, 0.3f, -0.4f});
+
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<float> coordinate(-10.0f, 10.0f);
+
+    Float3Batch sources(2000);
+    for (size_t i = 0; i < sources.Size(); i++) {
+        sources.Set(i, {coordinate(rng), coordinate(rng), coordinate(rng)});
+    }
+    // Sources on the axes and at the listener exercise every atan2 octant boundary
+    sources.Set(0, {0.2f, 0.3f, -0.4f});
+    for (size_t i = 1; i < 7; i++) {
+        Float3 axis;
+        axis[(i - 1) / 2] = (i % 2) ? 1.0f : -1.0f;
+        Float3 world = listener.GetGlobalRotationAsQuaternion().Rotate(axis) + Float3{0.2f, 0.3f, -0.4f};
+        sources.Set(i, world);
+    }
+
+    std::vector<float> azimuth(sources.Size());
+    std::vector<float> elevation(sources.Size());
+    std::vector<float> distance(sources.Size());
+    transform.GetDirections(sources, azimuth.data(), elevation.data(), distance.data());
+
+    for (size_t i = 0; i < sources.Size(); i++) {
+        Float3 expected = transform.GetDirection(sources.Get(i));
+        float azimuth_error = std::fabs(azimuth[i] - expected[0]);
+        // +PI and -PI are the same direction
+        azimuth_error = std::fmin(azimuth_error, std::fabs(azimuth_error - 2.0f * float(M_PI)));
+        ASSERT_LT(azimuth_error, 1e-5) << i;
+        ASSERT_NEAR(elevation[i], expected[1], 1e-5) << i;
+        ASSERT_NEAR(distance[i], expected[2], 1e-5 * (1 + expected[2])) << i;
+    }
+}
+
+TEST(ListenerTransformTests, PolynomialAtan2Accuracy) {
+    using namespace Mach1;
+
+    // With an identity listener at the origin, the batch azimuth is the polynomial atan2 of the source's own left and
+    // forward coordinates, so a dense sweep of the horizontal circle measures it directly
+    ListenerTransform transform;
+    Float3Batch sources(100000);
+    for (size_t i = 0; i < sources.Size(); i++) {
+        double angle = -M_PI + 2.0 * M_PI * (i + 0.5) / sources.Size();
+        sources.Set(i, {0.0f, static_cast<float>(std::sin(angle)), static_cast<float>(std::cos(angle))});
+    }
+
+    std::vector<float> azimuth(sources.Size());
+    std::vector<float> elevation(sources.Size());
+    std::vector<float> distance(sources.Size());
+    transform.GetDirections(sources, azimuth.data(), elevation.data(), distance.data());
+
+    double max_error = 0.0;
+    for (size_t i = 0; i < sources.Size(); i++) {
+        Float3 source = sources.Get(i);
+        double expected = std::atan2(static_cast<double>(source.GetPitch()), static_cast<double>(source.GetRoll()));
+        max_error = std::fmax(max_error, std::fabs(azimuth[i] - expected));
+    }
+    EXPECT_LE(max_error, 2e-6);
+}
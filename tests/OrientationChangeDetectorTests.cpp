@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include "m1_mathematics/OrientationChangeDetector.h"
+
+TEST(OrientationChangeDetectorTests, FirstDetectionReportsEverything) {
+    using namespace Mach1;
+
+    QuaternionBatch rotations(70);
+    OrientationChangeDetector detector(0, 0.01f);
+
+    ASSERT_EQ(detector.Detect(rotations), 70);
+    ASSERT_EQ(detector.GetTrackCount(), 70);
+    ASSERT_EQ(detector.GetDirtyMask().size(), 2);
+    ASSERT_EQ(detector.GetDirtyMask()[0], ~uint64_t(0));
+    ASSERT_EQ(detector.GetDirtyMask()[1], (uint64_t(1) << 6) - 1);
+
+    ASSERT_EQ(detector.Detect(rotations), 0);
+    ASSERT_TRUE(detector.GetDirtyIndices().empty());
+
+    detector.Invalidate();
+    ASSERT_EQ(detector.Detect(rotations), 70);
+}
+
+TEST(OrientationChangeDetectorTests, Threshold) {
+    using namespace Mach1;
+
+    QuaternionBatch rotations(130);
+    OrientationChangeDetector detector(rotations.Size(), 0.02f);
+    ASSERT_NEAR(detector.GetThreshold(), 0.02f, 1e-9);
+    detector.Detect(rotations);
+
+    rotations.Set(3, Quaternion::FromYawRadians(0.05f));
+    rotations.Set(64, Quaternion::FromEulerRadians({0.0f, 0.03f, 0.0f}));
+    rotations.Set(100, Quaternion::FromYawRadians(0.01f));
+    // The same rotation with the opposite sign is not a change
+    rotations.Set(120, Quaternion() * -1.0f);
+    rotations.Set(129, Quaternion::FromRollRadians(-0.021f));
+
+    ASSERT_EQ(detector.Detect(rotations), 3);
+    std::vector<uint32_t> expected = {3, 64, 129};
+    ASSERT_EQ(detector.GetDirtyIndices(), expected);
+    ASSERT_TRUE(detector.IsDirty(64));
+    ASSERT_FALSE(detector.IsDirty(100));
+    ASSERT_EQ(detector.GetDirtyMask()[2], uint64_t(1) << 1);
+
+    // Drift below the threshold per step is reported once it accumulates
+    float yaw = 0.01f;
+    size_t reported_at = 0;
+    for (size_t step = 2; step <= 5 && reported_at == 0; step++) {
+        yaw += 0.006f;
+        rotations.Set(100, Quaternion::FromYawRadians(yaw));
+        if (detector.Detect(rotations) == 1) {
+            reported_at = step;
+        }
+    }
+    ASSERT_EQ(reported_at, 3u);
+    ASSERT_EQ(detector.GetDirtyIndices()[0], 100u);
+
+    detector.SetThreshold(0.5f);
+    rotations.Set(3, Quaternion::FromYawRadians(0.4f));
+    ASSERT_EQ(detector.Detect(rotations), 0);
+}
+
+TEST(OrientationChangeDetectorTests, Resize) {
+    using namespace Mach1;
+
+    OrientationChangeDetector detector(10);
+    QuaternionBatch rotations(10);
+    detector.Detect(rotations);
+
+    rotations.Resize(12);
+    ASSERT_EQ(detector.Detect(rotations), 2);
+    ASSERT_EQ(detector.GetDirtyIndices()[0], 10u);
+
+    // Raw SoA arrays work just as well
+    rotations.Resize(4);
+    ASSERT_EQ(detector.Detect(rotations.W(), rotations.X(), rotations.Y(), rotations.Z(), rotations.Size()), 0);
+    ASSERT_EQ(detector.GetTrackCount(), 4);
+}
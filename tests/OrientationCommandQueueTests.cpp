@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "m1_mathematics/OrientationCommandQueue.h"
+
+TEST(OrientationCommandQueueTests, AppliesInOrder) {
+    using namespace Mach1;
+
+    OrientationCommandQueue queue(16);
+    Orientation orientation;
+    Orientation expected;
+
+    Quaternion a = Quaternion::FromEulerDegrees({30, 0, 0});
+    Quaternion b = Quaternion::FromEulerDegrees({0, 20, 10});
+    Quaternion c = Quaternion::FromEulerDegrees({-15, 5, 0});
+
+    ASSERT_TRUE(queue.PushApplyRotation(a));
+    ASSERT_TRUE(queue.PushApplyRotation(b));
+    ASSERT_TRUE(queue.PushRecenter());
+    ASSERT_TRUE(queue.PushApplyRotation(c));
+    ASSERT_TRUE(queue.PushApplyRotation(a));
+
+    expected.ApplyRotation(a);
+    expected.ApplyRotation(b);
+    expected.Recenter();
+    expected.ApplyRotation(c);
+    expected.ApplyRotation(a);
+
+    ASSERT_EQ(queue.Drain(orientation), 5);
+    ASSERT_TRUE(orientation.GetGlobalRotationAsQuaternion().IsApproximatelyEqual(expected.GetGlobalRotationAsQuaternion()));
+    ASSERT_EQ(queue.Drain(orientation), 0);
+
+    ASSERT_TRUE(queue.PushSetRotation(b));
+    ASSERT_TRUE(queue.PushApplyRotation(c));
+    ASSERT_TRUE(queue.PushSetGlobalRotation(a));
+    ASSERT_TRUE(queue.PushApplyRotation(b));
+    expected.SetGlobalRotation(a);
+    expected.ApplyRotation(b);
+    ASSERT_EQ(queue.Drain(orientation), 4);
+    ASSERT_TRUE(orientation.GetGlobalRotationAsQuaternion().IsApproximatelyEqual(expected.GetGlobalRotationAsQuaternion()));
+
+    ASSERT_TRUE(queue.PushReset());
+    queue.Drain(orientation);
+    ASSERT_TRUE(orientation.GetGlobalRotationAsQuaternion().IsApproximatelyEqual(Quaternion()));
+}
+
+TEST(OrientationCommandQueueTests, Capacity) {
+    using namespace Mach1;
+
+    OrientationCommandQueue queue(5);
+    ASSERT_EQ(queue.Capacity(), 8);
+
+    for (size_t i = 0; i < queue.Capacity(); i++) {
+        ASSERT_TRUE(queue.PushApplyRotation(Quaternion::FromEulerDegrees({10, 0, 0})));
+    }
+    ASSERT_FALSE(queue.PushRecenter());
+
+    Orientation orientation;
+    ASSERT_EQ(queue.Drain(orientation), 8);
+    ASSERT_NEAR(orientation.GetGlobalRotationAsEulerDegrees().GetYaw(), 80, 1e-3);
+
+    // The ring wraps around after draining
+    for (int lap = 0; lap < 3; lap++) {
+        for (size_t i = 0; i < queue.Capacity(); i++) {
+            ASSERT_TRUE(queue.PushApplyRotation(Quaternion::FromEulerDegrees({1, 0, 0})));
+        }
+        ASSERT_EQ(queue.Drain(orientation), 8);
+    }
+    ASSERT_NEAR(orientation.GetGlobalRotationAsEulerDegrees().GetYaw(), 104, 1e-3);
+}
+
+TEST(OrientationCommandQueueTests, ConcurrentProducers) {
+    using namespace Mach1;
+
+    const int producer_count = 4;
+    const int rotations_per_producer = 5000;
+
+    OrientationCommandQueue queue(256);
+    Orientation orientation;
+
+    // Rotations about one axis commute, so the result does not depend on how pushes interleave
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producer_count; p++) {
+        producers.emplace_back([&queue, p]() {
+            Quaternion step = Quaternion::FromYawRadians(p % 2 ? 0.0002f : -0.0001f);
+            for (int i = 0; i < rotations_per_producer; i++) {
+                while (!queue.PushApplyRotation(step)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    size_t consumed = 0;
+    while (consumed < size_t(producer_count * rotations_per_producer)) {
+        consumed += queue.Drain(orientation);
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    ASSERT_EQ(queue.Drain(orientation), 0);
+    float expected_yaw = (producer_count / 2) * rotations_per_producer * (0.0002f - 0.0001f);
+    ASSERT_NEAR(orientation.GetGlobalRotationAsEulerRadians().GetYaw(), expected_yaw, 1e-3);
+}
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "m1_mathematics/Orientation.h"
+#include "m1_mathematics/OrientationPipeline.h"
+
+namespace {
+
+// Hands out a prepared frame-major sequence a fixed number of frames at a time
+struct SequenceSource {
+    const Mach1::QuaternionBatch *frames;
+    size_t track_count;
+    size_t frames_per_chunk;
+    size_t next_frame = 0;
+
+    size_t Fill(Mach1::QuaternionBatch &chunk) {
+        size_t frame_count = std::min(frames_per_chunk, frames->Size() / track_count - next_frame);
+        chunk.Resize(frame_count * track_count);
+        for (size_t i = 0; i < frame_count * track_count; i++) {
+            chunk.Set(i, frames->Get(next_frame * track_count + i));
+        }
+        next_frame += frame_count;
+        return frame_count;
+    }
+};
+
+Mach1::QuaternionBatch MakeFrames(size_t frame_count, size_t track_count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> step(-2.0f, 2.0f);
+
+    Mach1::QuaternionBatch frames(frame_count * track_count);
+    for (size_t track = 0; track < track_count; track++) {
+        Mach1::Float3 euler(30.0f * static_cast<float>(track), 0, 0);
+        for (size_t frame = 0; frame < frame_count; frame++) {
+            euler = euler + Mach1::Float3(step(rng), step(rng), step(rng));
+            frames.Set(frame * track_count + track, Mach1::Quaternion::FromEulerDegrees(euler));
+        }
+    }
+    return frames;
+}
+
+// acos of a float dot product cannot resolve angles below about 1e-3, so measure the difference rotation with atan2
+float AngleBetween(Mach1::Quaternion a, Mach1::Quaternion b) {
+    Mach1::Quaternion d = a.Inversed() * b;
+    double vector_length = std::sqrt(static_cast<double>(d.GetX()) * d.GetX() +
+                                     static_cast<double>(d.GetY()) * d.GetY() +
+                                     static_cast<double>(d.GetZ()) * d.GetZ());
+    return static_cast<float>(2.0 * std::atan2(vector_length, std::fabs(static_cast<double>(d.GetW()))));
+}
+
+} // namespace
+
+TEST(OrientationPipelineTests, FusedMatchesSeparatePasses) {
+    using namespace Mach1;
+
+    const size_t track_count = 3;
+    QuaternionBatch frames = MakeFrames(40, track_count, 5);
+
+    auto fused = MakeOrientationPipeline(track_count, SequenceSource{&frames, track_count, 7},
+                                         SmoothStage(0.4f), PredictStage(1.5f), RecenterStage());
+    fused.GetStage<2>().SetParent(1, Quaternion::FromEulerDegrees({10, 20, 30}));
+
+    auto smooth = MakeOrientationPipeline(track_count, SequenceSource{&frames, track_count, 7}, SmoothStage(0.4f));
+    PredictStage predict(1.5f);
+    RecenterStage recenter;
+    predict.Resize(track_count);
+    recenter.Resize(track_count);
+    recenter.SetParent(1, Quaternion::FromEulerDegrees({10, 20, 30}));
+
+    QuaternionBatch fused_chunk, separate_chunk;
+    size_t total = 0;
+    while (size_t frame_count = fused.Pull(fused_chunk)) {
+        ASSERT_EQ(smooth.Pull(separate_chunk), frame_count);
+
+        // The same chain as three whole-chunk passes
+        for (size_t i = 0; i < frame_count * track_count; i++) {
+            float w = separate_chunk.W()[i], x = separate_chunk.X()[i], y = separate_chunk.Y()[i],
+                  z = separate_chunk.Z()[i];
+            predict.Process(i % track_count, w, x, y, z);
+            separate_chunk.Set(i, {w, x, y, z});
+        }
+        for (size_t i = 0; i < frame_count * track_count; i++) {
+            float w = separate_chunk.W()[i], x = separate_chunk.X()[i], y = separate_chunk.Y()[i],
+                  z = separate_chunk.Z()[i];
+            recenter.Process(i % track_count, w, x, y, z);
+            separate_chunk.Set(i, {w, x, y, z});
+        }
+
+        for (size_t i = 0; i < frame_count * track_count; i++) {
+            EXPECT_EQ(fused_chunk.Get(i), separate_chunk.Get(i)) << i;
+        }
+        total += frame_count;
+    }
+    EXPECT_EQ(total, 40);
+}
+
+TEST(OrientationPipelineTests, SmoothStage) {
+    using namespace Mach1;
+
+    Quaternion start = Quaternion::FromEulerDegrees({40, 10, 0});
+    Quaternion target = Quaternion::FromEulerDegrees({-20, 0, 5});
+
+    SmoothStage smooth(0.8f);
+    smooth.Resize(1);
+
+    // The first frame passes through, later ones approach the target without overshooting
+    float w = start.GetW(), x = start.GetX(), y = start.GetY(), z = start.GetZ();
+    smooth.Process(0, w, x, y, z);
+    EXPECT_TRUE(Quaternion(w, x, y, z).IsApproximatelyEqual(start));
+
+    float previous_angle = AngleBetween(start, target);
+    for (int frame = 0; frame < 100; frame++) {
+        // Alternate signs of the same rotation; smoothing must follow the shorter arc regardless
+        float sign = frame % 2 ? -1.0f : 1.0f;
+        w = sign * target.GetW(), x = sign * target.GetX(), y = sign * target.GetY(), z = sign * target.GetZ();
+        smooth.Process(0, w, x, y, z);
+        float angle = AngleBetween({w, x, y, z}, target);
+        EXPECT_LE(angle, previous_angle + 1e-6f);
+        previous_angle = angle;
+    }
+    EXPECT_LT(previous_angle, 1e-3f);
+
+    // No smoothing passes every frame through
+    SmoothStage passthrough(0.0f);
+    passthrough.Resize(1);
+    for (Quaternion q : {start, target, start}) {
+        w = q.GetW(), x = q.GetX(), y = q.GetY(), z = q.GetZ();
+        passthrough.Process(0, w, x, y, z);
+        EXPECT_TRUE(Quaternion(w, x, y, z).IsApproximatelyEqual(q));
+    }
+}
+
+TEST(OrientationPipelineTests, PredictStage) {
+    using namespace Mach1;
+
+    // Constant yaw rate of one degree per frame, predicted two frames ahead
+    PredictStage predict(2.0f);
+    predict.Resize(1);
+
+    for (int frame = 0; frame < 20; frame++) {
+        Quaternion q = Quaternion::FromEulerDegrees({static_cast<float>(frame), 0, 0});
+        if (frame % 3 == 0) {
+            q = q * -1.0f;
+        }
+        float w = q.GetW(), x = q.GetX(), y = q.GetY(), z = q.GetZ();
+        predict.Process(0, w, x, y, z);
+
+        float expected_yaw = frame == 0 ? 0.0f : static_cast<float>(frame + 2);
+        Quaternion expected = Quaternion::FromEulerDegrees({expected_yaw, 0, 0});
+        EXPECT_LT(AngleBetween({w, x, y, z}, expected), 2e-4f) << frame;
+    }
+}
+
+TEST(OrientationPipelineTests, RecenterStageMatchesOrientation) {
+    using namespace Mach1;
+
+    RecenterStage recenter;
+    recenter.Resize(2);
+
+    Orientation orientation;
+    Quaternion first = Quaternion::FromEulerDegrees({70, -10, 15});
+    Quaternion second = Quaternion::FromEulerDegrees({-30, 25, 5});
+
+    float w = first.GetW(), x = first.GetX(), y = first.GetY(), z = first.GetZ();
+    recenter.Process(0, w, x, y, z);
+    EXPECT_TRUE(Quaternion(w, x, y, z).IsApproximatelyEqual(first));
+
+    orientation.SetRotation(first);
+    orientation.Recenter();
+    recenter.Recenter(0);
+    EXPECT_TRUE(recenter.GetParent(1).IsApproximatelyEqual(Quaternion()));
+
+    orientation.SetRotation(second);
+    w = second.GetW(), x = second.GetX(), y = second.GetY(), z = second.GetZ();
+    recenter.Process(0, w, x, y, z);
+    EXPECT_TRUE(Quaternion(w, x, y, z).IsApproximatelyEqual(orientation.GetGlobalRotationAsQuaternion()));
+
+    recenter.Reset();
+    EXPECT_TRUE(recenter.GetParent(0).IsApproximatelyEqual(Quaternion()));
+}
+
+TEST(OrientationPipelineTests, PullsFromResampler) {
+    using namespace Mach1;
+
+    OrientationResampler resampler(2, 100.0);
+    for (int i = 0; i <= 10; i++) {
+        double time = 0.01 * i;
+        resampler.PushSample(0, time, Quaternion::FromEulerDegrees({static_cast<float>(i), 0, 0}));
+        resampler.PushSample(1, time, Quaternion::FromEulerDegrees({0, static_cast<float>(-i), 0}));
+    }
+
+    auto pipeline = MakeOrientationPipeline(2, ResamplerSource(resampler, 4), RecenterStage());
+    QuaternionBatch chunk;
+    ASSERT_EQ(pipeline.Pull(chunk), 4);
+    ASSERT_EQ(chunk.Size(), 8);
+    EXPECT_TRUE(chunk.Get(3 * 2 + 0).IsApproximatelyEqual(Quaternion::FromEulerDegrees({3, 0, 0})));
+
+    pipeline.GetStage<0>().RecenterAll();
+    ASSERT_EQ(pipeline.Pull(chunk), 4);
+    Quaternion expected = Quaternion::FromEulerDegrees({0, -3, 0}).Inversed() *
+                          Quaternion::FromEulerDegrees({0, -7, 0});
+    EXPECT_TRUE(chunk.Get(3 * 2 + 1).IsApproximatelyEqual(expected));
+
+    auto deduced = MakeOrientationPipeline(ResamplerSource(resampler, 4), SmoothStage(0.5f));
+    EXPECT_EQ(deduced.GetTrackCount(), 2);
+    ASSERT_EQ(deduced.Pull(chunk), 4);
+    ASSERT_EQ(chunk.Size(), 8);
+}
@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+#include "m1_mathematics/OrientationPool.h"
+#include "m1_mathematics/Orientation.h"
+
+TEST(OrientationPoolTests, HandlesAndGenerations) {
+    using namespace Mach1;
+
+    OrientationPool pool;
+    ASSERT_FALSE(pool.IsValid(OrientationHandle{}));
+
+    OrientationHandle a = pool.Create();
+    OrientationHandle b = pool.Create();
+    OrientationHandle c = pool.Create();
+    ASSERT_EQ(pool.Size(), 3);
+    ASSERT_TRUE(pool.IsValid(a) && pool.IsValid(b) && pool.IsValid(c));
+
+    pool.ApplyRotationDegrees(c, Float3{30, 0, 0});
+
+    // Destroying from the middle moves the last Orientation into the hole without disturbing its state
+    ASSERT_TRUE(pool.Destroy(a));
+    ASSERT_FALSE(pool.Destroy(a));
+    ASSERT_FALSE(pool.IsValid(a));
+    ASSERT_EQ(pool.Size(), 2);
+    ASSERT_EQ(pool.GetDenseIndex(c), 0);
+    ASSERT_EQ(pool.GetHandle(0), c);
+    ASSERT_TRUE(pool.GetGlobalRotationAsEulerDegrees(c).IsApproximatelyEqual(Float3{30, 0, 0}));
+
+    // A reused slot gets a new generation, so the stale handle stays invalid
+    OrientationHandle d = pool.Create();
+    ASSERT_EQ(d.index, a.index);
+    ASSERT_NE(d, a);
+    ASSERT_FALSE(pool.IsValid(a));
+    ASSERT_TRUE(pool.GetGlobalRotationAsQuaternion(d).IsApproximatelyEqual(Quaternion{}));
+
+    pool.Clear();
+    ASSERT_EQ(pool.Size(), 0);
+    ASSERT_FALSE(pool.IsValid(b));
+    ASSERT_FALSE(pool.IsValid(d));
+}
+
+TEST(OrientationPoolTests, StaleHandlesAreIgnored) {
+    using namespace Mach1;
+
+    OrientationPool pool;
+    OrientationHandle a = pool.Create();
+    OrientationHandle b = pool.Create();
+    pool.ApplyRotationDegrees(b, Float3{45, 0, 0});
+    ASSERT_TRUE(pool.Destroy(a));
+
+    // b now sits in a's old dense position, and the next Create reuses a's slot
+    OrientationHandle c = pool.Create();
+    ASSERT_EQ(c.index, a.index);
+    pool.ApplyRotationDegrees(c, Float3{0, 10, 0});
+    Quaternion b_before = pool.GetGlobalRotationAsQuaternion(b);
+    Quaternion c_before = pool.GetGlobalRotationAsQuaternion(c);
+
+    ASSERT_EQ(pool.GetDenseIndex(a), pool.Size());
+    pool.ApplyRotation(a, Quaternion::FromYawRadians(1.0f));
+    pool.ApplyRotationDegrees(a, Float3{10, 20, 30});
+    pool.ApplyRotation_YawAxis(a, 0.5f);
+    pool.ApplyRotation_PitchAxis(a, 0.5f);
+    pool.ApplyRotation_RollAxis(a, 0.5f);
+    pool.SetRotation(a, Quaternion::FromPitchRadians(1.0f));
+    pool.SetGlobalRotation(a, Float3{1, 2, 3});
+    pool.Recenter(a);
+    pool.Reset(a);
+    ASSERT_TRUE(pool.GetGlobalRotationAsQuaternion(a).IsApproximatelyEqual(Quaternion{}));
+    ASSERT_TRUE(pool.GetGlobalRotationAsEulerDegrees(a).IsApproximatelyEqual(Float3{}));
+
+    ASSERT_EQ(pool.GetGlobalRotationAsQuaternion(b), b_before);
+    ASSERT_EQ(pool.GetGlobalRotationAsQuaternion(c), c_before);
+
+    // Once its slot is freed again, the stale handle must not read or write past the live range
+    ASSERT_TRUE(pool.Destroy(c));
+    pool.ApplyRotation(a, Quaternion::FromYawRadians(1.0f));
+    pool.Recenter(a);
+    ASSERT_EQ(pool.Size(), 1);
+    ASSERT_EQ(pool.GetGlobalRotationAsQuaternion(b), b_before);
+    ASSERT_TRUE(pool.GetGlobalRotationAsQuaternion(OrientationHandle{}).IsApproximatelyEqual(Quaternion{}));
+}
+
+TEST(OrientationPoolTests, StorageIsCacheLineAligned) {
+    using namespace Mach1;
+
+    OrientationPool pool;
+    for (int i = 0; i < 37; i++) {
+        pool.Create();
+    }
+
+    const QuaternionBatch &local = pool.GetLocalRotations();
+    for (const float *component : {local.W(), local.X(), local.Y(), local.Z()}) {
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(component) % 64, 0);
+    }
+}
+
+TEST(OrientationPoolTests, HandleOperationsMatchOrientation) {
+    using namespace Mach1;
+
+    OrientationPool pool;
+    OrientationHandle handle = pool.Create();
+    Orientation reference;
+
+    auto check = [&]() {
+        ASSERT_TRUE(pool.GetGlobalRotationAsQuaternion(handle).IsApproximatelyEqual(reference.GetGlobalRotationAsQuaternion()));
+        ASSERT_TRUE(pool.GetGlobalRotationAsEulerRadians(handle).IsApproximatelyEqual(reference.GetGlobalRotationAsEulerRadians()));
+        ASSERT_TRUE(pool.GetGlobalRotationAsEulerDegrees(handle).IsApproximatelyEqual(reference.GetGlobalRotationAsEulerDegrees()));
+    };
+
+    pool.ApplyRotationDegrees(handle, Float3{20, 10, -5});
+    reference.ApplyRotationDegrees(Float3{20, 10, -5});
+    check();
+
+    pool.ApplyRotationDegrees_YawAxis(handle, 15);
+    pool.ApplyRotationDegrees_PitchAxis(handle, -7);
+    pool.ApplyRotationDegrees_RollAxis(handle, 3);
+    reference.ApplyRotationDegrees_YawAxis(15);
+    reference.ApplyRotationDegrees_PitchAxis(-7);
+    reference.ApplyRotationDegrees_RollAxis(3);
+    check();
+
+    pool.Recenter(handle);
+    reference.Recenter();
+    check();
+
+    pool.ApplyRotation_YawAxis(handle, 0.2f);
+    pool.ApplyRotation_PitchAxis(handle, 0.1f);
+    pool.ApplyRotation_RollAxis(handle, -0.3f);
+    pool.ApplyRotation(handle, Float3{0.1f, 0.0f, 0.2f});
+    reference.ApplyRotation_YawAxis(0.2f);
+    reference.ApplyRotation_PitchAxis(0.1f);
+    reference.ApplyRotation_RollAxis(-0.3f);
+    reference.ApplyRotation(Float3{0.1f, 0.0f, 0.2f});
+    check();
+
+    pool.SetRotation(handle, Float3{0.5f, 0.2f, 0.0f});
+    reference.SetRotation(Float3{0.5f, 0.2f, 0.0f});
+    check();
+
+    pool.SetGlobalRotation(handle, Quaternion::FromEulerDegrees({10, 20, 30}));
+    reference.SetGlobalRotation(Quaternion::FromEulerDegrees({10, 20, 30}));
+    check();
+
+    pool.Reset(handle);
+    reference.Reset();
+    check();
+}
+
+TEST(OrientationPoolTests, RangeOperationsMatchOrientation) {
+    using namespace Mach1;
+
+    const size_t count = 50;
+    OrientationPool pool;
+    std::vector<Orientation> references(count);
+    for (size_t i = 0; i < count; i++) {
+        pool.Create();
+    }
+
+    std::vector<Float3> rotations;
+    std::vector<float> yaw;
+    QuaternionBatch deltas(count);
+    for (size_t i = 0; i < count; i++) {
+        rotations.push_back(Float3{float(i), float(i) * 0.5f, -float(i) * 0.25f});
+        yaw.push_back(float(i) * 2.0f);
+        deltas.Set(i, Quaternion::FromEulerDegrees({0, float(i) * 0.1f, 5.0f}));
+    }
+
+    pool.ApplyRotationDegrees(0, count, rotations.data());
+    pool.Recenter(0, count / 2);
+    pool.ApplyRotationDegrees_YawAxis(0, count, yaw.data());
+    pool.ApplyRotation(0, count, deltas);
+    pool.ApplyRotation(count / 2, count / 2, Quaternion::FromEulerDegrees({0, 0, 12}));
+
+    for (size_t i = 0; i < count; i++) {
+        references[i].ApplyRotationDegrees(rotations[i]);
+        if (i < count / 2) references[i].Recenter();
+        references[i].ApplyRotationDegrees_YawAxis(yaw[i]);
+        references[i].ApplyRotation(deltas.Get(i));
+        if (i >= count / 2) references[i].ApplyRotation(Quaternion::FromEulerDegrees({0, 0, 12}));
+    }
+
+    QuaternionBatch globals;
+    std::vector<Float3> eulers(count);
+    pool.GetGlobalRotationAsQuaternion(0, count, globals);
+    pool.GetGlobalRotationAsEulerDegrees(0, count, eulers.data());
+    ASSERT_EQ(globals.Size(), count);
+
+    for (size_t i = 0; i < count; i++) {
+        ASSERT_TRUE(globals.Get(i).IsApproximatelyEqual(references[i].GetGlobalRotationAsQuaternion())) << i;
+        ASSERT_TRUE(eulers[i].IsApproximatelyEqual(references[i].GetGlobalRotationAsEulerDegrees())) << i;
+    }
+
+    pool.Reset(0, count);
+    pool.GetGlobalRotationAsQuaternion(0, count, globals);
+    for (size_t i = 0; i < count; i++) {
+        ASSERT_TRUE(globals.Get(i).IsApproximatelyEqual(Quaternion{}));
+    }
+}
+
+TEST(OrientationPoolTests, SingleAxisRangesMatchOrientation) {
+    using namespace Mach1;
+
+    const size_t count = 20;
+    OrientationPool pool;
+    std::vector<Orientation> references(count);
+    std::vector<float> angles;
+    for (size_t i = 0; i < count; i++) {
+        OrientationHandle handle = pool.Create();
+        pool.ApplyRotationDegrees(handle, Float3{float(i) * 7.0f, 12.0f, -float(i)});
+        references[i].ApplyRotationDegrees(Float3{float(i) * 7.0f, 12.0f, -float(i)});
+        angles.push_back(float(i) * 0.1f - 1.0f);
+    }
+
+    pool.ApplyRotation_YawAxis(0, count, angles.data());
+    pool.ApplyRotation_PitchAxis(0, count, angles.data());
+    pool.ApplyRotation_RollAxis(0, count, angles.data());
+    pool.ApplyRotationDegrees_YawAxis(0, count, angles.data());
+    pool.ApplyRotationDegrees_PitchAxis(0, count, angles.data());
+    pool.ApplyRotationDegrees_RollAxis(0, count, angles.data());
+
+    for (size_t i = 0; i < count; i++) {
+        references[i].ApplyRotation_YawAxis(angles[i]);
+        references[i].ApplyRotation_PitchAxis(angles[i]);
+        references[i].ApplyRotation_RollAxis(angles[i]);
+        references[i].ApplyRotationDegrees_YawAxis(angles[i]);
+        references[i].ApplyRotationDegrees_PitchAxis(angles[i]);
+        references[i].ApplyRotationDegrees_RollAxis(angles[i]);
+
+        Quaternion expected = references[i].GetGlobalRotationAsQuaternion();
+        ASSERT_TRUE(pool.GetGlobalRotationAsQuaternion(pool.GetHandle(i)).IsApproximatelyEqual(expected)) << i;
+    }
+}
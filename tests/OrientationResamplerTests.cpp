@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include "m1_mathematics/OrientationResampler.h"
+#include "m1_mathematics/Float3.h"
+
+TEST(OrientationResamplerTests, EmptyTracksOutputIdentity) {
+    using namespace Mach1;
+
+    OrientationResampler resampler(3, 100.0);
+    QuaternionBatch output;
+    resampler.Process(2, output);
+
+    ASSERT_EQ(output.Size(), 6);
+    for (size_t i = 0; i < output.Size(); i++) {
+        ASSERT_TRUE(output.Get(i).IsApproximatelyEqual(Quaternion{}));
+    }
+}
+
+TEST(OrientationResamplerTests, SlerpBetweenJitteredSamples) {
+    using namespace Mach1;
+
+    OrientationResampler resampler(2, 10.0);
+
+    // Track 0 sweeps yaw at 100 degrees per second, with irregular sample times
+    ASSERT_TRUE(resampler.PushSample(0, 0.00, Quaternion::FromEulerDegrees({0, 0, 0})));
+    ASSERT_TRUE(resampler.PushSample(0, 0.13, Quaternion::FromEulerDegrees({13, 0, 0})));
+    ASSERT_TRUE(resampler.PushSample(0, 0.31, Quaternion::FromEulerDegrees({31, 0, 0})));
+
+    // Track 1 only has a single sample, which gets held
+    Quaternion held = Quaternion::FromEulerDegrees({0, 20, 0});
+    ASSERT_TRUE(resampler.PushSample(1, 0.05, held));
+
+    QuaternionBatch output;
+    resampler.Process(5, output);
+
+    for (size_t frame = 0; frame < 4; frame++) {
+        Quaternion expected = Quaternion::FromEulerDegrees({10.0f * frame, 0, 0});
+        ASSERT_TRUE(output.Get(frame * 2).IsApproximatelyEqual(expected)) << frame;
+        ASSERT_TRUE(output.Get(frame * 2 + 1).IsApproximatelyEqual(held)) << frame;
+    }
+
+    // Past the last sample the latest value is held
+    ASSERT_TRUE(output.Get(4 * 2).IsApproximatelyEqual(Quaternion::FromEulerDegrees({31, 0, 0})));
+    ASSERT_DOUBLE_EQ(resampler.GetOutputTime(), 0.5);
+}
+
+TEST(OrientationResamplerTests, RejectsOutOfOrderSamples) {
+    using namespace Mach1;
+
+    OrientationResampler resampler(1, 10.0);
+    ASSERT_TRUE(resampler.PushSample(0, 1.0, {}));
+    ASSERT_FALSE(resampler.PushSample(0, 1.0, {}));
+    ASSERT_FALSE(resampler.PushSample(0, 0.5, {}));
+    ASSERT_EQ(resampler.GetPendingSampleCount(0), 1);
+}
+
+TEST(OrientationResamplerTests, BoundedHistory) {
+    using namespace Mach1;
+
+    OrientationResampler resampler(1, 1000.0, OrientationResampler::Interpolation::Slerp, 4);
+    for (int i = 0; i < 100; i++) {
+        resampler.PushSample(0, i * 0.001, Quaternion::FromEulerDegrees({float(i), 0, 0}));
+    }
+    ASSERT_EQ(resampler.GetPendingSampleCount(0), 4);
+
+    // Only the last four samples survive, so early output holds the oldest surviving one
+    resampler.SetOutputTime(0.0);
+    QuaternionBatch output;
+    resampler.Process(1, output);
+    ASSERT_TRUE(output.Get(0).IsApproximatelyEqual(Quaternion::FromEulerDegrees({96, 0, 0})));
+
+    // Consumed samples are discarded as the output clock passes them, keeping one for squad tangents
+    resampler.SetOutputTime(0.0985);
+    resampler.Process(1, output);
+    ASSERT_TRUE(output.Get(0).IsApproximatelyEqual(Quaternion::FromEulerDegrees({98.5, 0, 0})));
+    ASSERT_EQ(resampler.GetPendingSampleCount(0), 3);
+}
+
+TEST(OrientationResamplerTests, SquadIsSmoothAndHitsSamples) {
+    using namespace Mach1;
+
+    OrientationResampler resampler(1, 20.0, OrientationResampler::Interpolation::Squad);
+    resampler.PushSample(0, 0.0, Quaternion::FromEulerDegrees({0, 0, 0}));
+    resampler.PushSample(0, 0.1, Quaternion::FromEulerDegrees({10, 5, 0}));
+    resampler.PushSample(0, 0.2, Quaternion::FromEulerDegrees({30, 0, -5}));
+    resampler.PushSample(0, 0.3, Quaternion::FromEulerDegrees({35, -5, 0}));
+
+    QuaternionBatch output;
+    resampler.Process(7, output);
+
+    // Every other frame lands exactly on a sample
+    ASSERT_TRUE(output.Get(0).IsApproximatelyEqual(Quaternion::FromEulerDegrees({0, 0, 0})));
+    ASSERT_TRUE(output.Get(2).IsApproximatelyEqual(Quaternion::FromEulerDegrees({10, 5, 0})));
+    ASSERT_TRUE(output.Get(4).IsApproximatelyEqual(Quaternion::FromEulerDegrees({30, 0, -5})));
+    ASSERT_TRUE(output.Get(6).IsApproximatelyEqual(Quaternion::FromEulerDegrees({35, -5, 0})));
+
+    for (size_t i = 0; i < output.Size(); i++) {
+        ASSERT_NEAR(output.Get(i).Length(), 1.0, 1e-5);
+    }
+}
+
+TEST(OrientationResamplerTests, AlignsHemispheres) {
+    using namespace Mach1;
+
+    OrientationResampler resampler(1, 2.0);
+    Quaternion start = Quaternion::FromEulerDegrees({0, 0, 0});
+    Quaternion end = Quaternion::FromEulerDegrees({40, 0, 0});
+    resampler.PushSample(0, 0.0, start);
+    resampler.PushSample(0, 1.0, end * -1.0f);
+
+    QuaternionBatch output;
+    resampler.Process(2, output);
+    ASSERT_TRUE(output.Get(1).IsApproximatelyEqual(Quaternion::FromEulerDegrees({20, 0, 0})));
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <sstream>
+
+#include "m1_mathematics/OrientationTrace.h"
+
+TEST(OrientationTraceTests, ReadsAllOps) {
+    using namespace Mach1;
+
+    std::istringstream text(
+            "# recorded session\n"
+            "\n"
+            "0 0 apply 0.9 0.1 0.2 0.3\n"
+            "10 1 apply_euler 0.1 0.2 0.3\n"
+            "20 1 apply_euler_deg 10 20 30\n"
+            "30 2 apply_yaw 0.5\n"
+            "40 2 apply_pitch -0.5\n"
+            "50 2 apply_roll 0.25\n"
+            "60 3 set 1 0 0 0\n"
+            "70 3 set_global 0 1 0 0\n"
+            "80 0 recenter\n"
+            "90 0 reset\n"
+            "100 4 get\n"
+            "  110 4 get_euler_deg\r\n");
+
+    OrientationTrace trace;
+    std::string error;
+    ASSERT_TRUE(trace.Read(text, &error)) << error;
+    ASSERT_EQ(trace.Size(), 12);
+    EXPECT_EQ(trace.ObjectCount(), 5);
+
+    const auto &events = trace.GetEvents();
+    EXPECT_EQ(events[0].type, OrientationTraceEvent::Type::ApplyRotation);
+    EXPECT_FLOAT_EQ(events[0].values[3], 0.3f);
+    EXPECT_EQ(events[3].type, OrientationTraceEvent::Type::ApplyRotationYaw);
+    EXPECT_EQ(events[3].timestamp_us, 30);
+    EXPECT_EQ(events[3].object, 2);
+    EXPECT_EQ(events[8].type, OrientationTraceEvent::Type::Recenter);
+    EXPECT_EQ(events[11].type, OrientationTraceEvent::Type::GetGlobalRotationDegrees);
+}
+
+TEST(OrientationTraceTests, RejectsMalformedLines) {
+    using namespace Mach1;
+
+    for (const char *line : {"0 0 spin 1\n", "0 0 apply 1 0 0\n", "0 0 apply_yaw 1 2\n", "x 0 reset\n", "0\n"}) {
+        std::istringstream text(std::string("0 0 reset\n") + line);
+        OrientationTrace trace;
+        std::string error;
+        EXPECT_FALSE(trace.Read(text, &error)) << line;
+        EXPECT_NE(error.find("line 2"), std::string::npos) << error;
+        EXPECT_EQ(trace.Size(), 0);
+    }
+}
+
+TEST(OrientationTraceTests, WriteRoundTrips) {
+    using namespace Mach1;
+
+    OrientationTrace trace;
+    Quaternion q = Quaternion::FromEulerDegrees({33.3f, -12.1f, 7.7f});
+    trace.Add(5, 0, OrientationTraceEvent::Type::ApplyRotation, q.GetW(), q.GetX(), q.GetY(), q.GetZ());
+    trace.Add(6, 7, OrientationTraceEvent::Type::ApplyRotationDegrees, 1.0f / 3.0f, 2e-7f, -90.0f);
+    trace.Add(7, 3, OrientationTraceEvent::Type::Recenter);
+    trace.Add(8000000000ull, 3, OrientationTraceEvent::Type::GetGlobalRotation);
+
+    std::stringstream text;
+    trace.Write(text);
+
+    OrientationTrace read;
+    ASSERT_TRUE(read.Read(text));
+    ASSERT_EQ(read.Size(), trace.Size());
+    EXPECT_EQ(read.ObjectCount(), 8);
+    for (size_t i = 0; i < trace.Size(); i++) {
+        const OrientationTraceEvent &expected = trace.GetEvents()[i];
+        const OrientationTraceEvent &actual = read.GetEvents()[i];
+        EXPECT_EQ(actual.timestamp_us, expected.timestamp_us);
+        EXPECT_EQ(actual.object, expected.object);
+        EXPECT_EQ(actual.type, expected.type);
+        for (int v = 0; v < 4; v++) {
+            EXPECT_EQ(actual.values[v], expected.values[v]) << i << " " << v;
+        }
+    }
+}
+
+TEST(OrientationTraceTests, ApplyMatchesDirectCalls) {
+    using namespace Mach1;
+
+    OrientationTrace trace;
+    trace.Add(0, 0, OrientationTraceEvent::Type::ApplyRotationDegrees, 30, 10, 0);
+    trace.Add(1, 0, OrientationTraceEvent::Type::Recenter);
+    trace.Add(2, 0, OrientationTraceEvent::Type::ApplyRotationYaw, 0.25f);
+    trace.Add(3, 0, OrientationTraceEvent::Type::ApplyRotationPitch, -0.1f);
+
+    Orientation replayed;
+    for (const OrientationTraceEvent &event : trace.GetEvents()) {
+        EXPECT_EQ(OrientationTrace::Apply(event, replayed), 0.0f);
+    }
+
+    Orientation direct;
+    direct.ApplyRotationDegrees({30, 10, 0});
+    direct.Recenter();
+    direct.ApplyRotation_YawAxis(0.25f);
+    direct.ApplyRotation_PitchAxis(-0.1f);
+
+    Quaternion expected = direct.GetGlobalRotationAsQuaternion();
+    EXPECT_TRUE(replayed.GetGlobalRotationAsQuaternion().IsApproximatelyEqual(expected));
+
+    OrientationTraceEvent read;
+    read.type = OrientationTraceEvent::Type::GetGlobalRotation;
+    EXPECT_NEAR(OrientationTrace::Apply(read, replayed),
+                expected.GetW() + expected.GetX() + expected.GetY() + expected.GetZ(), 1e-6f);
+
+    Float3 degrees = direct.GetGlobalRotationAsEulerDegrees();
+    read.type = OrientationTraceEvent::Type::GetGlobalRotationDegrees;
+    EXPECT_NEAR(OrientationTrace::Apply(read, replayed),
+                degrees.GetYaw() + degrees.GetPitch() + degrees.GetRoll(), 1e-3f);
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "m1_mathematics/ListenerTransform.h"
+#include "m1_mathematics/Pose.h"
+
+TEST(PoseTests, ApplyTransforms) {
+    using namespace Mach1;
+
+    Pose pose;
+    ASSERT_TRUE(pose.GetGlobalTransform().IsApproximatelyEqual(DualQuaternion()));
+
+    // Turn left, then walk forward in the turned frame
+    pose.ApplyRotation(Quaternion::FromEulerDegrees({90, 0, 0}));
+    pose.ApplyTranslation({0, 0, 2});
+    ASSERT_TRUE(pose.GetGlobalPosition().IsApproximatelyEqual({0, 2, 0}));
+    ASSERT_TRUE(pose.GetGlobalRotationAsQuaternion().IsApproximatelyEqual(Quaternion::FromEulerDegrees({90, 0, 0})));
+
+    pose.SetTransform(Quaternion::FromEulerDegrees({0, 10, 0}), {1, 1, 1});
+    ASSERT_TRUE(pose.GetGlobalPosition().IsApproximatelyEqual({1, 1, 1}));
+
+    pose.Reset();
+    ASSERT_TRUE(pose.GetGlobalTransform().IsApproximatelyEqual(DualQuaternion()));
+}
+
+TEST(PoseTests, Recenter) {
+    using namespace Mach1;
+
+    Orientation orientation;
+    orientation.ApplyRotationDegrees({45, -10, 5});
+    Pose pose(orientation, {3, -1, 2});
+    ASSERT_TRUE(pose.GetGlobalRotationAsQuaternion().IsApproximatelyEqual(orientation.GetGlobalRotationAsQuaternion()));
+    ASSERT_TRUE(pose.GetGlobalPosition().IsApproximatelyEqual({3, -1, 2}));
+
+    pose.Recenter();
+    ASSERT_TRUE(pose.GetGlobalTransform().IsEquivalent(DualQuaternion()));
+
+    // Movement after recentering is reported relative to the recentered pose, as with Orientation
+    pose.ApplyTranslation({0, 0, 1});
+    pose.ApplyRotation(Quaternion::FromEulerDegrees({20, 0, 0}));
+    orientation.Recenter();
+    orientation.ApplyRotationDegrees_YawAxis(20);
+    ASSERT_TRUE(pose.GetGlobalPosition().IsApproximatelyEqual({0, 0, 1}));
+    ASSERT_TRUE(pose.GetGlobalRotationAsQuaternion().IsApproximatelyEqual(orientation.GetGlobalRotationAsQuaternion()));
+
+    // Setting the local transform keeps the recentered offset, setting the global transform drops it
+    DualQuaternion target = DualQuaternion::FromTranslation({5, 0, 0});
+    pose.SetGlobalTransform(target);
+    ASSERT_TRUE(pose.GetGlobalTransform().IsApproximatelyEqual(target));
+}
+
+TEST(PoseTests, ListenerTransform) {
+    using namespace Mach1;
+
+    Pose listener;
+    listener.SetTransform(Quaternion::FromEulerDegrees({-30, 15, 0}), {1, 2, 3});
+
+    ListenerTransform from_pose;
+    from_pose.SetListener(listener);
+    ListenerTransform from_rotation;
+    from_rotation.SetListener(listener.GetGlobalRotationAsQuaternion(), listener.GetGlobalPosition());
+
+    Float3 source = {-2, 4, 0.5f};
+    ASSERT_TRUE(from_pose.GetDirection(source).IsApproximatelyEqual(from_rotation.GetDirection(source)));
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+#include "m1_mathematics/Float3.h"
+#include "m1_mathematics/Profiler.h"
+#include "m1_mathematics/Quaternion.h"
+
+TEST(ProfilerTests, ScopesAccumulatePerKernel) {
+    using namespace Mach1;
+
+    Profiler::Reset();
+    for (int i = 0; i < 10; i++) {
+        Profiler::Scope scope(Profiler::Kernel::Float3Normalized);
+    }
+    std::thread([] {
+        Profiler::AttachThread();
+        for (int i = 0; i < 5; i++) {
+            Profiler::Scope scope(Profiler::Kernel::Float3Normalized);
+        }
+    }).join();
+
+    Profiler::KernelStats stats = Profiler::GetStats(Profiler::Kernel::Float3Normalized);
+    EXPECT_EQ(stats.calls, 15);
+    EXPECT_EQ(Profiler::GetStats(Profiler::Kernel::QuaternionMultiply).calls, 0);
+    EXPECT_GE(stats.CyclesPerCall(), 0.0);
+    if (!Profiler::HasInstructions()) {
+        EXPECT_EQ(stats.instructions, 0);
+    }
+
+    Profiler::Reset();
+    EXPECT_EQ(Profiler::GetStats(Profiler::Kernel::Float3Normalized).calls, 0);
+    EXPECT_EQ(Profiler::GetStats(Profiler::Kernel::Float3Normalized).cycles, 0);
+}
+
+TEST(ProfilerTests, LibraryKernelsCountOnlyWhenEnabled) {
+    using namespace Mach1;
+
+    Profiler::Reset();
+    Quaternion q = Quaternion::FromEulerRadians({0.1f, 0.2f, 0.3f});
+    q *= Quaternion::FromEulerRadians({0.3f, 0.2f, 0.1f});
+    q = q * q;
+    Float3 euler = q.ToEulerRadians();
+    Float3 direction = euler.Normalized();
+    EXPECT_GT(direction.Length(), 0.0f);
+
+    uint64_t expected = Profiler::IsEnabled() ? 1 : 0;
+    EXPECT_EQ(Profiler::GetStats(Profiler::Kernel::QuaternionMultiply).calls, 2 * expected);
+    EXPECT_EQ(Profiler::GetStats(Profiler::Kernel::QuaternionFromEulerRadians).calls, 2 * expected);
+    EXPECT_EQ(Profiler::GetStats(Profiler::Kernel::QuaternionToEulerRadians).calls, expected);
+    EXPECT_EQ(Profiler::GetStats(Profiler::Kernel::Float3Normalized).calls, expected);
+    Profiler::Reset();
+}
+
+TEST(ProfilerTests, Json) {
+    using namespace Mach1;
+
+    Profiler::Reset();
+    {
+        Profiler::Scope scope(Profiler::Kernel::QuaternionToEulerRadians);
+    }
+
+    std::string json = Profiler::ToJson();
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.back(), '}');
+    EXPECT_NE(json.find(std::string("\"backend\": \"") + Profiler::GetBackendName(Profiler::GetBackend()) + "\""),
+              std::string::npos);
+    EXPECT_NE(json.find("\"Quaternion::ToEulerRadians\": {\"calls\": 1,"), std::string::npos);
+    EXPECT_NE(json.find("\"Quaternion::operator*=\": {\"calls\": 0,"), std::string::npos);
+    EXPECT_NE(json.find("\"Float3::Normalized\""), std::string::npos);
+    EXPECT_NE(json.find("\"Quaternion::FromEulerRadians\""), std::string::npos);
+    if (!Profiler::HasCacheMisses()) {
+        EXPECT_NE(json.find("\"cache_misses\": null"), std::string::npos);
+    }
+    Profiler::Reset();
+}
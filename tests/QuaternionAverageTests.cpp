@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+#include "m1_mathematics/QuaternionAverage.h"
+#include "m1_mathematics/Float3.h"
+
+namespace {
+
+Mach1::Quaternion Jittered(Mach1::Quaternion center, std::mt19937 &rng, float degrees) {
+    std::uniform_real_distribution<float> jitter(-degrees, degrees);
+    return center * Mach1::Quaternion::FromEulerDegrees({jitter(rng), jitter(rng), jitter(rng)});
+}
+
+bool SameRotation(Mach1::Quaternion a, Mach1::Quaternion b, float tolerance) {
+    return std::fabs(std::fabs(a.DotProduct(b)) - 1.0f) < tolerance;
+}
+
+} // namespace
+
+TEST(QuaternionAverageTests, EmptyAndSingleSample) {
+    using namespace Mach1;
+
+    QuaternionBatch empty;
+    ASSERT_TRUE(QuaternionAverage::LinearMean(empty).IsApproximatelyEqual(Quaternion{}));
+    ASSERT_TRUE(QuaternionAverage::MarkleyMean(empty).IsApproximatelyEqual(Quaternion{}));
+
+    Quaternion q = Quaternion::FromEulerDegrees({30, -20, 10});
+    QuaternionBatch single(1);
+    single.Set(0, q);
+    ASSERT_TRUE(SameRotation(QuaternionAverage::LinearMean(single), q, 1e-6));
+    ASSERT_TRUE(SameRotation(QuaternionAverage::MarkleyMean(single), q, 1e-6));
+}
+
+TEST(QuaternionAverageTests, SignFlippedSamples) {
+    using namespace Mach1;
+
+    // Half of the samples are antipodes, which a naive sum would cancel out
+    Quaternion a = Quaternion::FromEulerDegrees({10, 0, 0});
+    Quaternion b = Quaternion::FromEulerDegrees({30, 0, 0});
+    QuaternionBatch samples(2);
+    samples.Set(0, a);
+    samples.Set(1, b * -1.0f);
+
+    Quaternion expected = Quaternion::FromEulerDegrees({20, 0, 0});
+    ASSERT_TRUE(SameRotation(QuaternionAverage::LinearMean(samples), expected, 1e-6));
+    ASSERT_TRUE(SameRotation(QuaternionAverage::MarkleyMean(samples), expected, 1e-6));
+}
+
+TEST(QuaternionAverageTests, Weights) {
+    using namespace Mach1;
+
+    QuaternionBatch samples(2);
+    samples.Set(0, Quaternion::FromEulerDegrees({0, 0, 0}));
+    samples.Set(1, Quaternion::FromEulerDegrees({60, 0, 0}));
+
+    float only_second[] = {0.0f, 1.0f};
+    ASSERT_TRUE(SameRotation(QuaternionAverage::LinearMean(samples, only_second), samples.Get(1), 1e-6));
+    ASSERT_TRUE(SameRotation(QuaternionAverage::MarkleyMean(samples, only_second), samples.Get(1), 1e-6));
+}
+
+TEST(QuaternionAverageTests, LinearAndMarkleyAgreeOnClusters) {
+    using namespace Mach1;
+
+    std::mt19937 rng(42);
+    Quaternion center = Quaternion::FromEulerDegrees({120, 30, -45});
+
+    QuaternionBatch samples(500);
+    for (size_t i = 0; i < samples.Size(); i++) {
+        Quaternion q = Jittered(center, rng, 5);
+        samples.Set(i, (i % 2) ? q * -1.0f : q);
+    }
+
+    Quaternion linear = QuaternionAverage::LinearMean(samples);
+    Quaternion markley = QuaternionAverage::MarkleyMean(samples);
+    ASSERT_TRUE(SameRotation(linear, markley, 1e-5));
+    ASSERT_TRUE(SameRotation(markley, center, 1e-3));
+}
+
+TEST(QuaternionAverageTests, RobustMeanRejectsOutliers) {
+    using namespace Mach1;
+
+    std::mt19937 rng(1);
+    Quaternion center = Quaternion::FromEulerDegrees({-60, 10, 5});
+
+    QuaternionBatch samples(200);
+    for (size_t i = 0; i < samples.Size(); i++) {
+        samples.Set(i, Jittered(center, rng, 3));
+    }
+    // Tracker glitches: a fifth of the samples point somewhere else entirely
+    for (size_t i = 0; i < samples.Size(); i += 5) {
+        samples.Set(i, Quaternion::FromEulerDegrees({100, -40, 0}));
+    }
+
+    size_t inliers = 0;
+    Quaternion robust = QuaternionAverage::RobustMean(samples, 0.2f, &inliers);
+    ASSERT_EQ(inliers, 160);
+    ASSERT_TRUE(SameRotation(robust, center, 1e-4));
+    ASSERT_FALSE(SameRotation(QuaternionAverage::MarkleyMean(samples), center, 1e-3));
+}
+
+TEST(QuaternionAverageTests, RobustMeanIteratesUntilMembershipSettles) {
+    using namespace Mach1;
+
+    // With a 20 degree limit the first pass keeps {9, 11, 14, 26, 39, 45}. The second swaps 45 out for 5, keeping
+    // six inliers, and only the third settles on {5, 9, 11, 14, 26}
+    const float yaws[] = {11, 49, 5, 39, 45, 49, 26, 14, 9};
+    QuaternionBatch samples(9);
+    for (size_t i = 0; i < samples.Size(); i++) {
+        samples.Set(i, Quaternion::FromEulerDegrees({yaws[i], 0, 0}));
+    }
+
+    QuaternionBatch settled(5);
+    const float settled_yaws[] = {5, 9, 11, 14, 26};
+    for (size_t i = 0; i < settled.Size(); i++) {
+        settled.Set(i, Quaternion::FromEulerDegrees({settled_yaws[i], 0, 0}));
+    }
+
+    size_t inliers = 0;
+    Quaternion robust = QuaternionAverage::RobustMean(samples, 20.0f * float(M_PI) / 180.0f, &inliers);
+    ASSERT_EQ(inliers, 5);
+    ASSERT_TRUE(SameRotation(robust, QuaternionAverage::MarkleyMean(settled), 1e-6));
+}
+
+TEST(QuaternionAverageTests, SlidingWindowMatchesBatchMean) {
+    using namespace Mach1;
+
+    const size_t tracks = 3;
+    const size_t window = 32;
+    SlidingQuaternionAverage sliding(tracks, window);
+
+    std::mt19937 rng(7);
+    std::vector<Quaternion> history[tracks];
+    QuaternionBatch step(tracks);
+
+    for (size_t n = 0; n < 300; n++) {
+        for (size_t track = 0; track < tracks; track++) {
+            // Slowly rotating, noisy, and sometimes sign-flipped input
+            Quaternion q = Jittered(Quaternion::FromEulerDegrees({float(n) * 0.5f + 40.0f * track, 0, 0}), rng, 4);
+            if (n % 3 == 0) q *= -1.0f;
+            step.Set(track, q);
+            history[track].push_back(q);
+        }
+        sliding.Push(step);
+    }
+
+    for (size_t track = 0; track < tracks; track++) {
+        ASSERT_EQ(sliding.GetSampleCount(track), window);
+
+        QuaternionBatch last(window);
+        for (size_t i = 0; i < window; i++) {
+            last.Set(i, history[track][history[track].size() - window + i]);
+        }
+
+        ASSERT_TRUE(SameRotation(sliding.GetLinearMean(track), QuaternionAverage::LinearMean(last), 1e-5));
+        ASSERT_TRUE(SameRotation(sliding.GetMarkleyMean(track), QuaternionAverage::MarkleyMean(last), 1e-5));
+    }
+
+    QuaternionBatch means;
+    sliding.GetLinearMeans(means);
+    ASSERT_EQ(means.Size(), tracks);
+
+    sliding.Reset();
+    ASSERT_EQ(sliding.GetSampleCount(0), 0);
+    ASSERT_TRUE(sliding.GetLinearMean(0).IsApproximatelyEqual(Quaternion{}));
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+#include "m1_mathematics/QuaternionBatch.h"
+
+TEST(QuaternionBatchTests, Construction) {
+    Mach1::QuaternionBatch batch(4);
+    ASSERT_EQ(batch.Size(), 4);
+    for (size_t i = 0; i < batch.Size(); i++) {
+        ASSERT_EQ(batch.Get(i), Mach1::Quaternion{});
+    }
+
+    batch.Set(2, {1, 2, 3, 4});
+    ASSERT_EQ(batch.Get(2), Mach1::Quaternion(1, 2, 3, 4));
+    ASSERT_FLOAT_EQ(batch.Z()[2], 4);
+
+    batch.Resize(6);
+    ASSERT_EQ(batch.Get(5), Mach1::Quaternion{});
+    ASSERT_EQ(batch.Get(2), Mach1::Quaternion(1, 2, 3, 4));
+}
+
+TEST(QuaternionBatchTests, RotationVectorsMatchScalar) {
+    using namespace Mach1;
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> component(-1.5f, 1.5f);
+    std::uniform_real_distribution<float> tiny(-1e-3f, 1e-3f);
+
+    Float3Batch rotation_vectors(400);
+    for (size_t i = 0; i < rotation_vectors.Size(); i++) {
+        bool small = i % 4 == 0;
+        rotation_vectors.Set(i, small ? Float3(tiny(rng), tiny(rng), tiny(rng))
+                                      : Float3(component(rng), component(rng), component(rng)));
+    }
+    rotation_vectors.Set(0, {});
+
+    QuaternionBatch quaternions;
+    quaternions.FromRotationVectors(rotation_vectors);
+    ASSERT_EQ(quaternions.Size(), rotation_vectors.Size());
+
+    Float3Batch converted;
+    quaternions.ToRotationVectors(converted);
+
+    for (size_t i = 0; i < rotation_vectors.Size(); i++) {
+        Quaternion expected = Quaternion::FromRotationVector(rotation_vectors.Get(i));
+        ASSERT_TRUE(quaternions.Get(i).IsApproximatelyEqual(expected)) << i;
+        ASSERT_TRUE(converted.Get(i).IsApproximatelyEqual(expected.ToRotationVector())) << i;
+    }
+}
+
+TEST(QuaternionBatchTests, AxisAnglesMatchScalar) {
+    using namespace Mach1;
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> angle(-3.0f, 3.0f);
+
+    Float3Batch axes(100);
+    std::vector<float> angles(100);
+    for (size_t i = 0; i < axes.Size(); i++) {
+        axes.Set(i, {component(rng), component(rng), component(rng)});
+        angles[i] = angle(rng);
+    }
+    axes.Set(7, {});
+
+    QuaternionBatch quaternions;
+    quaternions.FromAxisAngles(axes, angles.data());
+
+    Float3Batch converted_axes;
+    std::vector<float> converted_angles(100);
+    quaternions.ToAxisAngles(converted_axes, converted_angles.data());
+
+    for (size_t i = 0; i < axes.Size(); i++) {
+        Quaternion expected = Quaternion::FromAxisAngle(axes.Get(i), angles[i]);
+        ASSERT_TRUE(quaternions.Get(i).IsApproximatelyEqual(expected)) << i;
+
+        Float3 expected_axis;
+        float expected_angle;
+        expected.ToAxisAngle(expected_axis, expected_angle);
+        ASSERT_TRUE(converted_axes.Get(i).IsApproximatelyEqual(expected_axis)) << i;
+        ASSERT_NEAR(converted_angles[i], expected_angle, 1e-5) << i;
+    }
+}
+
+TEST(QuaternionBatchTests, SwingTwistMatchesScalar) {
+    using namespace Mach1;
+
+    std::mt19937 rng(49);
+    std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+
+    QuaternionBatch quaternions(300);
+    for (size_t i = 0; i < quaternions.Size(); i++) {
+        quaternions.Set(i, Quaternion(component(rng), component(rng), component(rng), component(rng)).Normalized());
+    }
+    quaternions.Set(1, Quaternion::FromPitchRadians(3.14159265f));
+    quaternions.Set(2, Quaternion::FromEulerRadians({0.3f, 1.5707963f, 0.2f}));
+
+    for (Float3 axis : {Float3{1, 0, 0}, Float3{0.3f, -2.0f, 0.7f}, Float3{}}) {
+        QuaternionBatch swings;
+        QuaternionBatch twists;
+        quaternions.ToSwingTwists(axis, swings, twists);
+        ASSERT_EQ(swings.Size(), quaternions.Size());
+        ASSERT_EQ(twists.Size(), quaternions.Size());
+
+        QuaternionBatch clamped = quaternions;
+        clamped.ClampSwingTwist(axis, 0.6f, -0.3f, 0.9f);
+
+        for (size_t i = 0; i < quaternions.Size(); i++) {
+            Quaternion expected_swing;
+            Quaternion expected_twist;
+            quaternions.Get(i).ToSwingTwist(axis, expected_swing, expected_twist);
+            ASSERT_TRUE(swings.Get(i).IsApproximatelyEqual(expected_swing)) << i;
+            ASSERT_TRUE(twists.Get(i).IsApproximatelyEqual(expected_twist)) << i;
+
+            Quaternion expected = quaternions.Get(i).ClampedSwingTwist(axis, 0.6f, -0.3f, 0.9f);
+            ASSERT_TRUE(clamped.Get(i).IsApproximatelyEqual(expected)) << i;
+        }
+    }
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "m1_mathematics/QuaternionIndex.h"
+#include "m1_mathematics/Float3.h"
+
+namespace {
+
+Mach1::QuaternionBatch RandomOrientations(size_t count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> normal;
+
+    Mach1::QuaternionBatch batch(count);
+    for (size_t i = 0; i < count; i++) {
+        batch.Set(i, Mach1::Quaternion(normal(rng), normal(rng), normal(rng), normal(rng)).Normalized());
+    }
+    return batch;
+}
+
+float Angle(Mach1::Quaternion a, Mach1::Quaternion b) {
+    return 2.0f * std::acos(std::fmin(std::fabs(a.DotProduct(b)), 1.0f));
+}
+
+} // namespace
+
+TEST(QuaternionIndexTests, EmptyIndex) {
+    Mach1::QuaternionIndex index;
+    Mach1::QuaternionIndex::Match match = index.FindNearest({});
+    ASSERT_EQ(match.index, 0);
+    ASSERT_TRUE(std::isinf(match.angle));
+}
+
+TEST(QuaternionIndexTests, NearestMatchesBruteForce) {
+    using namespace Mach1;
+
+    for (size_t size : {10, 5000}) {
+        QuaternionBatch set = RandomOrientations(size, 7);
+        QuaternionBatch queries = RandomOrientations(200, 11);
+
+        QuaternionIndex index;
+        index.Build(set);
+        ASSERT_EQ(index.Size(), size);
+
+        for (size_t i = 0; i < queries.Size(); i++) {
+            Quaternion query = queries.Get(i);
+
+            float best_angle = 10.0f;
+            for (size_t j = 0; j < set.Size(); j++) {
+                best_angle = std::fmin(best_angle, Angle(query, set.Get(j)));
+            }
+
+            QuaternionIndex::Match match = index.FindNearest(query);
+            ASSERT_NEAR(match.angle, best_angle, 1e-3) << size << " " << i;
+            ASSERT_NEAR(Angle(query, set.Get(match.index)), match.angle, 1e-3);
+        }
+    }
+}
+
+TEST(QuaternionIndexTests, AntipodesAreTheSameOrientation) {
+    using namespace Mach1;
+
+    QuaternionBatch set = RandomOrientations(1000, 3);
+    QuaternionIndex index;
+    index.Build(set);
+
+    for (size_t i = 0; i < 50; i++) {
+        Quaternion stored = set.Get(i * 20);
+        ASSERT_EQ(index.FindNearest(stored).index, i * 20);
+        ASSERT_EQ(index.FindNearest(stored * -1.0f).index, i * 20);
+    }
+}
+
+TEST(QuaternionIndexTests, KNearestSortedAndExact) {
+    using namespace Mach1;
+
+    QuaternionBatch set = RandomOrientations(3000, 5);
+    QuaternionIndex index;
+    index.Build(set);
+
+    Quaternion query = Quaternion::FromEulerDegrees({30, 10, -5});
+
+    std::vector<float> angles;
+    for (size_t j = 0; j < set.Size(); j++) {
+        angles.push_back(Angle(query, set.Get(j)));
+    }
+    std::sort(angles.begin(), angles.end());
+
+    QuaternionIndex::Match matches[16];
+    ASSERT_EQ(index.FindKNearest(query, 16, matches), 16);
+    for (size_t i = 0; i < 16; i++) {
+        ASSERT_NEAR(matches[i].angle, angles[i], 1e-3) << i;
+    }
+
+    // k larger than the set is capped
+    QuaternionBatch small = RandomOrientations(5, 9);
+    QuaternionIndex small_index;
+    small_index.Build(small);
+    ASSERT_EQ(small_index.FindKNearest(query, 16, matches), 5);
+}
+
+TEST(QuaternionIndexTests, WithinAngle) {
+    using namespace Mach1;
+
+    QuaternionBatch set = RandomOrientations(4000, 13);
+    QuaternionIndex index;
+    index.Build(set);
+
+    Quaternion query = Quaternion::FromEulerDegrees({-120, 45, 10});
+    float max_angle = 0.6f;
+
+    size_t expected = 0;
+    for (size_t j = 0; j < set.Size(); j++) {
+        if (Angle(query, set.Get(j)) <= max_angle) expected++;
+    }
+    ASSERT_GT(expected, 0);
+
+    std::vector<QuaternionIndex::Match> matches;
+    index.FindWithinAngle(query, max_angle, matches);
+    ASSERT_EQ(matches.size(), expected);
+    for (size_t i = 1; i < matches.size(); i++) {
+        ASSERT_LE(matches[i - 1].angle, matches[i].angle);
+    }
+}
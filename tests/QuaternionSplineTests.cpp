@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "m1_mathematics/QuaternionSpline.h"
+#include "m1_mathematics/Float3.h"
+
+namespace {
+
+Mach1::QuaternionSpline MakeAutomationCurve() {
+    using namespace Mach1;
+
+    QuaternionSpline spline;
+    spline.AddKeyframe(0.0, Quaternion::FromEulerDegrees({0, 0, 0}));
+    spline.AddKeyframe(1.0, Quaternion::FromEulerDegrees({45, 10, 0}));
+    spline.AddKeyframe(1.5, Quaternion::FromEulerDegrees({90, 0, -20}));
+    spline.AddKeyframe(3.0, Quaternion::FromEulerDegrees({170, -15, 0}));
+    spline.AddKeyframe(4.0, Quaternion::FromEulerDegrees({-160, 0, 0}));
+    return spline;
+}
+
+} // namespace
+
+TEST(QuaternionSplineTests, EmptyAndSingleKeyframe) {
+    using namespace Mach1;
+
+    QuaternionSpline spline;
+    ASSERT_TRUE(spline.Evaluate(1.0).IsApproximatelyEqual(Quaternion{}));
+
+    Quaternion key = Quaternion::FromEulerDegrees({10, 20, 30});
+    ASSERT_TRUE(spline.AddKeyframe(2.0, key));
+    ASSERT_TRUE(spline.Evaluate(0.0).IsApproximatelyEqual(key));
+    ASSERT_TRUE(spline.Evaluate(5.0).IsApproximatelyEqual(key));
+}
+
+TEST(QuaternionSplineTests, RejectsOutOfOrderKeyframes) {
+    using namespace Mach1;
+
+    QuaternionSpline spline = MakeAutomationCurve();
+    ASSERT_FALSE(spline.AddKeyframe(4.0, {}));
+    ASSERT_FALSE(spline.AddKeyframe(2.0, {}));
+    ASSERT_EQ(spline.GetKeyframeCount(), 5);
+    ASSERT_DOUBLE_EQ(spline.GetStartTime(), 0.0);
+    ASSERT_DOUBLE_EQ(spline.GetEndTime(), 4.0);
+}
+
+TEST(QuaternionSplineTests, PassesThroughKeyframes) {
+    using namespace Mach1;
+
+    QuaternionSpline spline = MakeAutomationCurve();
+    Float3 keys[] = {{0, 0, 0}, {45, 10, 0}, {90, 0, -20}, {170, -15, 0}, {-160, 0, 0}};
+    double times[] = {0.0, 1.0, 1.5, 3.0, 4.0};
+
+    for (int i = 0; i < 5; i++) {
+        Quaternion expected = Quaternion::FromEulerDegrees(keys[i]);
+        Quaternion actual = spline.Evaluate(times[i]);
+        // Keys may have been flipped into a neighbour's hemisphere
+        ASSERT_NEAR(std::fabs(actual.DotProduct(expected)), 1.0, 1e-5) << i;
+    }
+
+    // Held outside the keyed range
+    ASSERT_TRUE(spline.Evaluate(-1.0).IsApproximatelyEqual(spline.Evaluate(0.0)));
+    ASSERT_TRUE(spline.Evaluate(10.0).IsApproximatelyEqual(spline.Evaluate(4.0)));
+}
+
+TEST(QuaternionSplineTests, MatchesUncachedSquad) {
+    using namespace Mach1;
+
+    QuaternionSpline spline = MakeAutomationCurve();
+
+    Quaternion q0 = Quaternion::FromEulerDegrees({0, 0, 0});
+    Quaternion q1 = Quaternion::FromEulerDegrees({45, 10, 0});
+    Quaternion q2 = Quaternion::FromEulerDegrees({90, 0, -20});
+    Quaternion q3 = Quaternion::FromEulerDegrees({170, -15, 0});
+
+    Quaternion s1 = Quaternion::SquadControlPoint(q0, q1, q2);
+    Quaternion s2 = Quaternion::SquadControlPoint(q1, q2, q3);
+
+    for (float t : {0.1f, 0.25f, 0.5f, 0.9f}) {
+        Quaternion expected = Quaternion::Squad(q1, q2, s1, s2, t);
+        Quaternion actual = spline.Evaluate(1.0 + 0.5 * t);
+        ASSERT_NEAR(actual.DotProduct(expected), 1.0, 1e-5) << t;
+    }
+}
+
+TEST(QuaternionSplineTests, SequentialAndRandomAccessAgree) {
+    using namespace Mach1;
+
+    QuaternionSpline sequential = MakeAutomationCurve();
+    QuaternionSpline random = MakeAutomationCurve();
+
+    QuaternionBatch block;
+    sequential.EvaluateRange(-0.5, 0.01, 500, block);
+    ASSERT_EQ(block.Size(), 500);
+
+    // Visit the same times in a scrambled order
+    for (size_t i = 0; i < 500; i++) {
+        size_t index = (i * 337) % 500;
+        Quaternion expected = block.Get(index);
+        Quaternion actual = random.Evaluate(-0.5 + 0.01 * static_cast<double>(index));
+        ASSERT_TRUE(actual.IsApproximatelyEqual(expected)) << index;
+        ASSERT_NEAR(actual.Length(), 1.0, 1e-5);
+    }
+}
+
+TEST(QuaternionSplineTests, WrapsAcrossHemispheres) {
+    using namespace Mach1;
+
+    // 170 -> -160 yaw crosses the +-180 seam; the curve must take the short 30 degree route
+    QuaternionSpline spline;
+    spline.AddKeyframe(0.0, Quaternion::FromEulerDegrees({170, 0, 0}));
+    spline.AddKeyframe(1.0, Quaternion::FromEulerDegrees({-160, 0, 0}));
+
+    Quaternion middle = spline.Evaluate(0.5);
+    ASSERT_NEAR(std::fabs(middle.DotProduct(Quaternion::FromEulerDegrees({-175, 0, 0}))), 1.0, 1e-5);
+}
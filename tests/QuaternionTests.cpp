@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <sstream>
+#include <cmath>
+#include <random>
 
 #include "m1_mathematics/Quaternion.h"
 #include "m1_mathematics/Float3.h"
@@ -114,3 +116,250 @@ TEST(QuaternionTests, Multiplication) {
 
     ASSERT_TRUE(convTestVec.IsApproximatelyEqual(testVec)) << convTestVec.ToString() << " != " << testVec.ToString();
 }
+
+TEST(QuaternionTests, Slerp) {
+    using namespace Mach1;
+
+    Quaternion from = Quaternion::FromEulerDegrees({0, 0, 0});
+    Quaternion to = Quaternion::FromEulerDegrees({90, 0, 0});
+    Quaternion halfway = Quaternion::FromEulerDegrees({45, 0, 0});
+
+    ASSERT_TRUE(Quaternion::Slerp(from, to, 0).IsApproximatelyEqual(from));
+    ASSERT_TRUE(Quaternion::Slerp(from, to, 1).IsApproximatelyEqual(to));
+    ASSERT_TRUE(Quaternion::Slerp(from, to, 0.5).IsApproximatelyEqual(halfway));
+
+    // The antipode of `to` is the same rotation, so the shortest arc must still pass through 45 degrees
+    ASSERT_TRUE(Quaternion::Slerp(from, to * -1.0f, 0.5).IsApproximatelyEqual(halfway));
+
+    // Nearly identical inputs take the normalized-lerp path
+    Quaternion nudged = Quaternion::FromEulerDegrees({0.0001, 0, 0});
+    ASSERT_NEAR(Quaternion::Slerp(from, nudged, 0.5).Length(), 1.0, 1e-6);
+}
+
+TEST(QuaternionTests, LogExp) {
+    using namespace Mach1;
+
+    Quaternion identity = {};
+    ASSERT_TRUE(identity.Log().IsApproximatelyEqual(Quaternion(0, 0, 0, 0)));
+    ASSERT_TRUE(identity.Log().Exp().IsApproximatelyEqual(identity));
+
+    // Log of a 90 degree yaw is the half angle along the yaw (z) axis
+    Quaternion yaw = Quaternion::FromEulerDegrees({90, 0, 0});
+    ASSERT_TRUE(yaw.Log().IsApproximatelyEqual(Quaternion(0, 0, 0, M_PI_4)));
+
+    Quaternion q = Quaternion::FromEulerDegrees({45, 30, -10});
+    ASSERT_TRUE(q.Log().Exp().IsApproximatelyEqual(q));
+}
+
+TEST(QuaternionTests, Squad) {
+    using namespace Mach1;
+
+    Quaternion q0 = Quaternion::FromEulerDegrees({0, 0, 0});
+    Quaternion q1 = Quaternion::FromEulerDegrees({30, 10, 0});
+    Quaternion q2 = Quaternion::FromEulerDegrees({60, 0, 5});
+    Quaternion q3 = Quaternion::FromEulerDegrees({90, -10, 0});
+
+    Quaternion s1 = Quaternion::SquadControlPoint(q0, q1, q2);
+    Quaternion s2 = Quaternion::SquadControlPoint(q1, q2, q3);
+
+    ASSERT_TRUE(Quaternion::Squad(q1, q2, s1, s2, 0).IsApproximatelyEqual(q1));
+    ASSERT_TRUE(Quaternion::Squad(q1, q2, s1, s2, 1).IsApproximatelyEqual(q2));
+    ASSERT_NEAR(Quaternion::Squad(q1, q2, s1, s2, 0.37).Length(), 1.0, 1e-5);
+
+    // Keys on a single great arc with even spacing make squad collapse to slerp
+    Quaternion a = Quaternion::FromEulerDegrees({0, 0, 0});
+    Quaternion b = Quaternion::FromEulerDegrees({20, 0, 0});
+    Quaternion c = Quaternion::FromEulerDegrees({40, 0, 0});
+    Quaternion d = Quaternion::FromEulerDegrees({60, 0, 0});
+    Quaternion sb = Quaternion::SquadControlPoint(a, b, c);
+    Quaternion sc = Quaternion::SquadControlPoint(b, c, d);
+    ASSERT_TRUE(Quaternion::Squad(b, c, sb, sc, 0.5).IsApproximatelyEqual(Quaternion::FromEulerDegrees({30, 0, 0})));
+}
+
+TEST(QuaternionTests, SingleAxisRotations) {
+    using namespace Mach1;
+
+    Quaternion base = Quaternion::FromEulerDegrees({25, -40, 70});
+
+    for (float angle : {-3.0f, -1.0f, 0.0f, 0.3f, 1.5707964f, 2.5f, 6.0f}) {
+        ASSERT_TRUE(Quaternion::FromYawRadians(angle).IsApproximatelyEqual(Quaternion::FromEulerRadians({angle, 0, 0})));
+        ASSERT_TRUE(Quaternion::FromPitchRadians(angle).IsApproximatelyEqual(Quaternion::FromEulerRadians({0, angle, 0})));
+        ASSERT_TRUE(Quaternion::FromRollRadians(angle).IsApproximatelyEqual(Quaternion::FromEulerRadians({0, 0, angle})));
+
+        Quaternion yawed = base;
+        yawed.RotateYaw(angle);
+        ASSERT_TRUE(yawed.IsApproximatelyEqual(base * Quaternion::FromEulerRadians({angle, 0, 0}))) << angle;
+
+        Quaternion pitched = base;
+        pitched.RotatePitch(angle);
+        ASSERT_TRUE(pitched.IsApproximatelyEqual(base * Quaternion::FromEulerRadians({0, angle, 0}))) << angle;
+
+        Quaternion rolled = base;
+        rolled.RotateRoll(angle);
+        ASSERT_TRUE(rolled.IsApproximatelyEqual(base * Quaternion::FromEulerRadians({0, 0, angle}))) << angle;
+    }
+}
+
+TEST(QuaternionTests, AxisAngle) {
+    using namespace Mach1;
+
+    // Axis components follow Euler Float3s: yaw (z), pitch (y), roll (x)
+    ASSERT_TRUE(Quaternion::FromAxisAngle({2, 0, 0}, 0.7f).IsApproximatelyEqual(Quaternion::FromYawRadians(0.7f)));
+    ASSERT_TRUE(Quaternion::FromAxisAngle({0, 1, 0}, 0.7f).IsApproximatelyEqual(Quaternion::FromPitchRadians(0.7f)));
+    ASSERT_TRUE(Quaternion::FromAxisAngle({0, 0, 1}, 0.7f).IsApproximatelyEqual(Quaternion::FromRollRadians(0.7f)));
+    ASSERT_TRUE(Quaternion::FromAxisAngle({}, 1.0f).IsApproximatelyEqual(Quaternion{}));
+
+    Float3 axis = Float3{1, -2, 0.5f}.Normalized();
+    Quaternion q = Quaternion::FromAxisAngle(axis, 2.0f);
+
+    Float3 converted_axis;
+    float converted_angle;
+    q.ToAxisAngle(converted_axis, converted_angle);
+    ASSERT_TRUE(converted_axis.IsApproximatelyEqual(axis));
+    ASSERT_NEAR(converted_angle, 2.0f, 1e-5);
+
+    // The antipode reports the same axis and angle
+    (q * -1.0f).ToAxisAngle(converted_axis, converted_angle);
+    ASSERT_TRUE(converted_axis.IsApproximatelyEqual(axis));
+    ASSERT_NEAR(converted_angle, 2.0f, 1e-5);
+
+    Quaternion{}.ToAxisAngle(converted_axis, converted_angle);
+    ASSERT_EQ(converted_angle, 0.0f);
+    ASSERT_FLOAT_EQ(converted_axis.Length(), 1.0f);
+}
+
+TEST(QuaternionTests, RotationVector) {
+    using namespace Mach1;
+
+    ASSERT_TRUE(Quaternion::FromRotationVector({0.4f, 0, 0}).IsApproximatelyEqual(Quaternion::FromYawRadians(0.4f)));
+    ASSERT_TRUE(Quaternion::FromRotationVector({0, 0.4f, 0}).IsApproximatelyEqual(Quaternion::FromPitchRadians(0.4f)));
+    ASSERT_TRUE(Quaternion::FromRotationVector({0, 0, 0.4f}).IsApproximatelyEqual(Quaternion::FromRollRadians(0.4f)));
+    ASSERT_TRUE(Quaternion::FromRotationVector({}).IsApproximatelyEqual(Quaternion{}));
+
+    // Round trips across the exact and Taylor branches, and across the branch threshold
+    for (float length : {1e-8f, 1e-5f, 1e-3f, 0.00999f, 0.01001f, 0.1f, 1.0f, 3.0f}) {
+        Float3 rotation_vector = Float3{0.3f, -0.8f, 0.52f}.Normalized() * length;
+        Quaternion q = Quaternion::FromRotationVector(rotation_vector);
+
+        ASSERT_NEAR(q.Length(), 1.0f, 1e-6) << length;
+        ASSERT_TRUE(q.IsApproximatelyEqual(Quaternion::FromAxisAngle(rotation_vector, length))) << length;
+
+        Float3 converted = q.ToRotationVector();
+        for (int axis = 0; axis < 3; axis++) {
+            ASSERT_NEAR(converted[axis], rotation_vector[axis], 1e-6f + 1e-5f * length) << length;
+        }
+    }
+
+    // The shorter rotation is reported for the antipode of a large rotation
+    Quaternion large = Quaternion::FromRotationVector({3.0f, 0, 0});
+    ASSERT_TRUE((large * -1.0f).ToRotationVector().IsApproximatelyEqual({3.0f, 0, 0}));
+}
+
+TEST(QuaternionTests, SwingTwist) {
+    using namespace Mach1;
+
+    // Around the Yaw axis, a nod after a head turn splits into the two
+    Quaternion swing;
+    Quaternion twist;
+    (Quaternion::FromPitchRadians(0.3f) * Quaternion::FromYawRadians(0.7f)).ToSwingTwist({1, 0, 0}, swing, twist);
+    ASSERT_TRUE(swing.IsApproximatelyEqual(Quaternion::FromPitchRadians(0.3f)));
+    ASSERT_TRUE(twist.IsApproximatelyEqual(Quaternion::FromYawRadians(0.7f)));
+
+    std::mt19937 rng(49);
+    std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+    for (int i = 0; i < 200; i++) {
+        Quaternion q = Quaternion(component(rng), component(rng), component(rng), component(rng)).Normalized();
+        Float3 axis{component(rng), component(rng), component(rng)};
+        q.ToSwingTwist(axis, swing, twist);
+
+        ASSERT_TRUE((swing * twist).IsApproximatelyEqual(q)) << i;
+        ASSERT_NEAR(swing.Length(), 1.0f, 1e-5f) << i;
+        ASSERT_NEAR(twist.Length(), 1.0f, 1e-5f) << i;
+        ASSERT_GE(swing.GetW(), 0.0f) << i;
+
+        // Twist turns around the axis, swing around a perpendicular one
+        Float3 unit = axis.Normalized();
+        Float3 twist_vector{twist.GetZ(), twist.GetY(), twist.GetX()};
+        Float3 swing_vector{swing.GetZ(), swing.GetY(), swing.GetX()};
+        float twist_along = twist_vector.GetYaw() * unit.GetYaw() + twist_vector.GetPitch() * unit.GetPitch() +
+                            twist_vector.GetRoll() * unit.GetRoll();
+        ASSERT_NEAR(std::fabs(twist_along), twist_vector.Length(), 1e-5f) << i;
+        ASSERT_NEAR(swing_vector.GetYaw() * unit.GetYaw() + swing_vector.GetPitch() * unit.GetPitch() +
+                    swing_vector.GetRoll() * unit.GetRoll(), 0.0f, 1e-5f) << i;
+    }
+
+    // A half turn around a perpendicular axis has no defined twist
+    Quaternion half_turn = Quaternion::FromPitchRadians(static_cast<float>(M_PI));
+    half_turn.ToSwingTwist({1, 0, 0}, swing, twist);
+    ASSERT_TRUE(twist.IsApproximatelyEqual(Quaternion{}));
+    ASSERT_TRUE(swing.IsApproximatelyEqual(half_turn));
+}
+
+TEST(QuaternionTests, ClampedSwingTwist) {
+    using namespace Mach1;
+
+    Float3 neck{1, 0, 0};
+
+    // Inside the limits nothing changes
+    Quaternion inside = Quaternion::FromPitchRadians(0.2f) * Quaternion::FromYawRadians(0.5f);
+    ASSERT_TRUE(inside.ClampedSwingTwist(neck, 0.4f, -1.0f, 1.0f).IsApproximatelyEqual(inside));
+
+    // Twist clamps to the nearer end of its range, swing to the cone, each keeping the other
+    ASSERT_TRUE(Quaternion::FromYawRadians(1.2f).ClampedSwingTwist(neck, 0.4f, -0.5f, 0.8f)
+                        .IsApproximatelyEqual(Quaternion::FromYawRadians(0.8f)));
+    ASSERT_TRUE(Quaternion::FromYawRadians(-1.0f).ClampedSwingTwist(neck, 0.4f, -0.5f, 0.8f)
+                        .IsApproximatelyEqual(Quaternion::FromYawRadians(-0.5f)));
+    ASSERT_TRUE((Quaternion::FromPitchRadians(0.9f) * Quaternion::FromYawRadians(0.2f))
+                        .ClampedSwingTwist(neck, 0.4f, -0.5f, 0.8f)
+                        .IsApproximatelyEqual(Quaternion::FromPitchRadians(0.4f) * Quaternion::FromYawRadians(0.2f)));
+    ASSERT_TRUE((Quaternion::FromRollRadians(-0.9f) * Quaternion::FromYawRadians(1.5f))
+                        .ClampedSwingTwist(neck, 0.4f, -0.5f, 0.8f)
+                        .IsApproximatelyEqual(Quaternion::FromRollRadians(-0.4f) * Quaternion::FromYawRadians(0.8f)));
+
+    // Limits hold for any rotation, including pitches at the poles where an Euler clamp breaks down
+    std::mt19937 rng(490);
+    std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+    for (int i = 0; i < 200; i++) {
+        Quaternion q = Quaternion(component(rng), component(rng), component(rng), component(rng)).Normalized();
+        if (i == 0) {
+            q = Quaternion::FromEulerRadians({0.3f, static_cast<float>(M_PI_2), 0.2f});
+        }
+        Quaternion clamped = q.ClampedSwingTwist(neck, 0.6f, -0.3f, 0.9f);
+        ASSERT_NEAR(clamped.Length(), 1.0f, 1e-5f) << i;
+
+        Quaternion swing;
+        Quaternion twist;
+        clamped.ToSwingTwist(neck, swing, twist);
+        float sign = twist.GetW() < 0 ? -1.0f : 1.0f;
+        float swing_angle = 2.0f * std::atan2(std::sqrt(swing.GetX() * swing.GetX() + swing.GetY() * swing.GetY() +
+                                                        swing.GetZ() * swing.GetZ()), swing.GetW());
+        float twist_angle = 2.0f * std::atan2(twist.GetZ() * sign, twist.GetW() * sign);
+        ASSERT_LE(swing_angle, 0.6f + 1e-4f) << i;
+        ASSERT_GE(twist_angle, -0.3f - 1e-4f) << i;
+        ASSERT_LE(twist_angle, 0.9f + 1e-4f) << i;
+    }
+}
+
+TEST(QuaternionTests, RotateVector) {
+    using namespace Mach1;
+
+    // Vectors are (up, left, forward), matching the yaw, pitch and roll axes
+    Float3 up = {1, 0, 0};
+    Float3 left = {0, 1, 0};
+    Float3 forward = {0, 0, 1};
+
+    // Positive yaw turns to the left, positive pitch tilts forward down
+    ASSERT_TRUE(Quaternion::FromEulerDegrees({90, 0, 0}).Rotate(forward).IsApproximatelyEqual(left));
+    ASSERT_TRUE(Quaternion::FromEulerDegrees({90, 0, 0}).Rotate(up).IsApproximatelyEqual(up));
+    ASSERT_TRUE(Quaternion::FromEulerDegrees({0, 90, 0}).Rotate(forward).IsApproximatelyEqual(up * -1.0f));
+    ASSERT_TRUE(Quaternion::FromEulerDegrees({0, 0, 90}).Rotate(left).IsApproximatelyEqual(up));
+
+    Quaternion q = Quaternion::FromEulerDegrees({30, -20, 45});
+    Float3 v = {0.5f, -2.0f, 1.25f};
+    ASSERT_NEAR(q.Rotate(v).Length(), v.Length(), 1e-5);
+    ASSERT_TRUE(q.Inversed().Rotate(q.Rotate(v)).IsApproximatelyEqual(v));
+
+    // Matches rotating by quaternion products, applied right to left
+    Quaternion r = Quaternion::FromEulerDegrees({-60, 10, 5});
+    ASSERT_TRUE((q * r).Rotate(v).IsApproximatelyEqual(q.Rotate(r.Rotate(v))));
+}
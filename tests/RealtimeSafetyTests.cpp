@@ -0,0 +1,428 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "m1_mathematics/DualQuaternion.h"
+#include "m1_mathematics/EulerQuaternionCache.h"
+#include "m1_mathematics/FixedOrientation.h"
+#include "m1_mathematics/Float3Batch.h"
+#include "m1_mathematics/ListenerTransform.h"
+#include "m1_mathematics/Orientation.h"
+#include "m1_mathematics/OrientationChangeDetector.h"
+#include "m1_mathematics/OrientationCommandQueue.h"
+#include "m1_mathematics/OrientationPipeline.h"
+#include "m1_mathematics/OrientationPool.h"
+#include "m1_mathematics/Pose.h"
+#include "m1_mathematics/QuaternionAverage.h"
+#include "m1_mathematics/QuaternionBatch.h"
+#include "m1_mathematics/QuaternionIndex.h"
+#include "m1_mathematics/QuaternionSpline.h"
+#include "m1_mathematics/RealtimeSafety.h"
+#include "m1_mathematics/RelativeRotation.h"
+#include "m1_mathematics/SourceCuller.h"
+
+namespace {
+
+// Results are folded in here so the compiler cannot drop the calls under test
+volatile float g_sink = 0;
+
+void Consume(float value) {
+    g_sink = g_sink + value;
+}
+
+void Consume(Mach1::Quaternion q) {
+    Consume(q.GetW() + q.GetX() + q.GetY() + q.GetZ());
+}
+
+void Consume(Mach1::Float3 f) {
+    Consume(f.GetYaw() + f.GetPitch() + f.GetRoll());
+}
+
+/**
+ * Run a function inside a RealtimeSafety::Scope and return the violations it caused
+ */
+template <typename Function>
+Mach1::RealtimeSafety::Violations RunRealtime(Function &&function) {
+    Mach1::RealtimeSafety::ResetViolations();
+    {
+        Mach1::RealtimeSafety::Scope scope;
+        function();
+    }
+    return Mach1::RealtimeSafety::GetViolations();
+}
+
+template <typename Function>
+void ExpectRealtimeSafe(const char *name, Function &&function) {
+    Mach1::RealtimeSafety::Violations violations = RunRealtime(std::forward<Function>(function));
+    EXPECT_EQ(violations.Total(), 0u) << name << " called " << (violations.last ? violations.last : "") << " ("
+                                      << violations.allocations << " allocations, " << violations.blocking_calls
+                                      << " blocking calls, " << violations.unsafe_calls << " unsafe calls)";
+}
+
+size_t g_handler_calls = 0;
+
+void CountingHandler(const char *) {
+    // Allocating here must not be reported, nor recurse into the handler
+    std::unique_ptr<int> allocation(new int(0));
+    g_handler_calls++;
+}
+
+Mach1::Float3Batch MakeDirections(size_t count) {
+    Mach1::Float3Batch directions(count);
+    for (size_t i = 0; i < count; i++) {
+        float angle = 0.1f * static_cast<float>(i);
+        directions.Set(i, {std::sin(3.0f * angle), std::sin(angle), std::cos(angle)});
+    }
+    return directions;
+}
+
+Mach1::QuaternionBatch MakeRotations(size_t count) {
+    Mach1::QuaternionBatch rotations(count);
+    for (size_t i = 0; i < count; i++) {
+        float step = static_cast<float>(i);
+        rotations.Set(i, Mach1::Quaternion::FromEulerDegrees({7.0f * step, 3.0f * step, -2.0f * step}));
+    }
+    return rotations;
+}
+
+} // namespace
+
+TEST(RealtimeSafetyTests, DetectsAllocations) {
+    using namespace Mach1;
+
+    RealtimeSafety::Violations violations = RunRealtime([]() {
+        std::unique_ptr<float[]> buffer(new float[64]);
+        buffer[0] = 1.0f;
+        Consume(buffer[0]);
+    });
+    EXPECT_EQ(violations.allocations, 2u);
+    EXPECT_EQ(violations.blocking_calls, 0u);
+
+    violations = RunRealtime([]() {
+        std::vector<float> grown;
+        grown.resize(100);
+        Consume(static_cast<float>(grown.size()));
+    });
+    EXPECT_GT(violations.allocations, 0u);
+
+    // Nothing is counted outside a scope
+    RealtimeSafety::ResetViolations();
+    std::vector<float> outside(100);
+    EXPECT_EQ(RealtimeSafety::GetViolations().Total(), 0u);
+}
+
+TEST(RealtimeSafetyTests, DetectsBlockingCalls) {
+    using namespace Mach1;
+
+#if defined(__GLIBC__)
+    std::mutex mutex;
+    RealtimeSafety::Violations violations = RunRealtime([&mutex]() {
+        std::lock_guard<std::mutex> lock(mutex);
+    });
+    EXPECT_EQ(violations.blocking_calls, 1u);
+    EXPECT_STREQ(violations.last, "pthread_mutex_lock");
+
+    // Spreading work over threads starts and joins them
+    QuaternionBatch listeners = MakeRotations(2);
+    QuaternionBatch objects = MakeRotations(4 * RelativeRotation::TILE_SIZE);
+    QuaternionBatch output;
+    RelativeRotation::Compute(listeners, objects, output, 1);
+    violations = RunRealtime([&]() {
+        RelativeRotation::Compute(listeners, objects, output, 4);
+    });
+    EXPECT_GT(violations.blocking_calls, 0u);
+#else
+    GTEST_SKIP() << "lock interposition needs glibc";
+#endif
+}
+
+TEST(RealtimeSafetyTests, ScopesNestAndCallHandler) {
+    using namespace Mach1;
+
+    g_handler_calls = 0;
+    RealtimeSafety::SetHandler(CountingHandler);
+    RealtimeSafety::Violations violations = RunRealtime([]() {
+        EXPECT_TRUE(RealtimeSafety::IsInScope());
+        {
+            RealtimeSafety::Scope inner;
+        }
+        EXPECT_TRUE(RealtimeSafety::IsInScope());
+        std::unique_ptr<float> allocation(new float(1.0f));
+        *allocation += 1.0f;
+        Consume(*allocation);
+    });
+    RealtimeSafety::SetHandler(nullptr);
+
+    EXPECT_FALSE(RealtimeSafety::IsInScope());
+    EXPECT_EQ(violations.allocations, 2u);
+    EXPECT_EQ(g_handler_calls, 2u);
+}
+
+TEST(RealtimeSafetyTests, ToStringIsNotRealtimeSafe) {
+    using namespace Mach1;
+
+    RealtimeSafety::Violations violations = RunRealtime([]() {
+        std::string text = Quaternion::FromEulerDegrees({10, 20, 30}).ToString();
+        Consume(static_cast<float>(text.size()));
+    });
+    EXPECT_GT(violations.allocations, 0u);
+
+#if defined(M1_MATHEMATICS_REALTIME_CHECKS)
+    // In checking builds the call itself is reported, even before it allocates
+    violations = RunRealtime([]() {
+        std::string text = Float3(1, 2, 3).ToString();
+        Consume(static_cast<float>(text.size()));
+    });
+    EXPECT_EQ(violations.unsafe_calls, 1u);
+#endif
+}
+
+TEST(RealtimeSafetyTests, QuaternionAndFloat3) {
+    using namespace Mach1;
+
+    Quaternion a = Quaternion::FromEulerDegrees({30, -20, 10});
+    Quaternion b = Quaternion::FromEulerDegrees({-60, 5, 45});
+    Float3 f(0.3f, -0.2f, 0.9f);
+
+    ExpectRealtimeSafe("Quaternion", [&]() {
+        Consume(Quaternion::FromEulerDegrees(f));
+        Consume(Quaternion::FromEulerRadians(f));
+        Consume(Quaternion::FromAxisAngle(f, 0.5f));
+        Consume(Quaternion::FromRotationVector(f));
+        Consume(Quaternion::FromYawRadians(0.1f) * Quaternion::FromPitchRadians(0.2f) *
+                Quaternion::FromRollRadians(0.3f));
+        Quaternion c = a;
+        c.RotateYaw(0.1f);
+        c.RotatePitch(0.2f);
+        c.RotateRoll(0.3f);
+        c *= b;
+        Consume(c);
+        Consume(Quaternion::Slerp(a, b, 0.3f));
+        Consume(Quaternion::Squad(a, b, Quaternion::SquadControlPoint(b, a, b),
+                                  Quaternion::SquadControlPoint(a, b, a), 0.6f));
+        Consume(a.Log().Exp());
+        Consume(a.Normalized() + b.Inversed() - a * 0.5f);
+        Consume(a.DotProduct(b) + a.Length() + a.LengthSquared());
+        Consume(a.ToEulerDegrees());
+        Consume(a.ToEulerRadians());
+        Consume(a.Rotate(f));
+        Float3 axis;
+        float angle;
+        a.ToAxisAngle(axis, angle);
+        Consume(axis);
+        Consume(angle + (a.IsApproximatelyEqual(b) ? 1.0f : 0.0f) + (a == b ? 1.0f : 0.0f));
+    });
+
+    ExpectRealtimeSafe("Float3", [&]() {
+        Consume(f.Normalized());
+        Consume(f.EulerDegrees().EulerRadians());
+        Consume(f.Clamped({-0.1f}, {0.1f}));
+        Consume(f.Modulus({-1}, {1}));
+        Consume(f.Wrapped({-180}, {180}));
+        Float3 mapped = f;
+        Consume(mapped.Map(-1, 1, 0, 10));
+        Consume(f.Length() + (f.IsApproximatelyEqual(mapped) ? 1.0f : 0.0f));
+        Consume(f + f - f * 2.0f);
+    });
+}
+
+TEST(RealtimeSafetyTests, Orientation) {
+    using namespace Mach1;
+
+    Orientation orientation;
+    Pose pose;
+    DualQuaternion transform = DualQuaternion::FromRotationTranslation(Quaternion::FromEulerDegrees({20, 0, 0}),
+                                                                       {1, 2, 3});
+
+    ExpectRealtimeSafe("Orientation", [&]() {
+        orientation.ApplyRotation(Quaternion::FromEulerDegrees({1, 2, 3}));
+        orientation.ApplyRotationDegrees({1, 2, 3});
+        orientation.ApplyRotationDegrees_YawAxis(1);
+        orientation.ApplyRotationDegrees_PitchAxis(1);
+        orientation.ApplyRotationDegrees_RollAxis(1);
+        orientation.ApplyRotation(Float3(0.01f, 0.02f, 0.03f));
+        orientation.ApplyRotation_YawAxis(0.01f);
+        orientation.ApplyRotation_PitchAxis(0.01f);
+        orientation.ApplyRotation_RollAxis(0.01f);
+        Consume(orientation.GetGlobalRotationAsQuaternion());
+        Consume(orientation.GetGlobalRotationAsEulerDegrees());
+        Consume(orientation.GetGlobalRotationAsEulerRadians());
+        orientation.Recenter();
+        orientation.SetRotation(Float3(0.1f, 0.2f, 0.3f));
+        orientation.SetRotation(Quaternion::FromEulerDegrees({4, 5, 6}));
+        orientation.SetGlobalRotation(Float3(0.1f, 0.2f, 0.3f));
+        orientation.SetGlobalRotation(Quaternion::FromEulerDegrees({4, 5, 6}));
+        orientation.Reset();
+    });
+
+    ExpectRealtimeSafe("DualQuaternion and Pose", [&]() {
+        DualQuaternion blended = DualQuaternion::Sclerp(transform, transform.Inversed(), 0.3f);
+        Consume(blended.TransformPoint({1, 1, 1}));
+        Consume(blended.GetRotation());
+        Consume(blended.GetTranslation());
+        pose.ApplyTransform(transform);
+        pose.ApplyRotation(Quaternion::FromEulerDegrees({0, 10, 0}));
+        pose.ApplyTranslation({0, 0, 1});
+        pose.Recenter();
+        Consume(pose.GetGlobalRotationAsQuaternion());
+        Consume(pose.GetGlobalPosition());
+    });
+
+    OrientationQ31 fixed;
+    FixedQuaternion<int32_t> step = FixedQuaternion<int32_t>::FromQuaternion(Quaternion::FromEulerDegrees({1, 0, 0}));
+    ExpectRealtimeSafe("FixedOrientation", [&]() {
+        fixed.ApplyRotation(step);
+        fixed.Recenter();
+        fixed.ApplyRotation(step);
+        Consume(fixed.GetGlobalRotation().ToQuaternion());
+    });
+}
+
+TEST(RealtimeSafetyTests, BatchApis) {
+    using namespace Mach1;
+
+    const size_t count = 300;
+    QuaternionBatch rotations = MakeRotations(count);
+    QuaternionBatch output(count);
+    Float3Batch directions = MakeDirections(count);
+    Float3Batch scratch(count);
+    std::vector<float> values(count, 0.5f);
+    std::vector<float> azimuth(count), elevation(count), distance(count);
+
+    ExpectRealtimeSafe("QuaternionBatch and Float3Batch", [&]() {
+        output.FromRotationVectors(directions);
+        output.ToRotationVectors(scratch);
+        output.FromAxisAngles(directions, values.data());
+        output.ToAxisAngles(scratch, values.data());
+        scratch.Normalize();
+        scratch.ToEulerDegrees();
+        scratch.Wrap({-180}, {180});
+        scratch.ToEulerRadians();
+        scratch.Clamp({-1}, {1});
+        scratch.Modulus({-1}, {1});
+        scratch.Map(-1, 1, 0, 1);
+        scratch += directions;
+        scratch *= 0.5f;
+        scratch.Length(values.data());
+        Consume(values[7]);
+    });
+
+    OrientationPool pool;
+    std::vector<OrientationHandle> handles;
+    for (size_t i = 0; i < count; i++) {
+        handles.push_back(pool.Create());
+    }
+    std::vector<Float3> euler(count);
+    QuaternionBatch globals(count);
+    ExpectRealtimeSafe("OrientationPool", [&]() {
+        pool.ApplyRotation(handles[3], Quaternion::FromEulerDegrees({1, 2, 3}));
+        pool.ApplyRotation(0, count, rotations);
+        pool.ApplyRotation_YawAxis(0, count, values.data());
+        pool.Recenter(0, count / 2);
+        pool.SetRotation(count / 2, count / 2, rotations);
+        pool.GetGlobalRotationAsQuaternion(0, count, globals);
+        pool.GetGlobalRotationAsEulerDegrees(0, count, euler.data());
+        pool.Reset(0, count);
+        Consume(euler[5]);
+    });
+
+    ListenerTransform listener(Orientation(), {0, 0, 0});
+    QuaternionBatch listeners = MakeRotations(4);
+    QuaternionBatch relative;
+    RelativeRotation::Compute(listeners, rotations, relative);
+    ExpectRealtimeSafe("ListenerTransform and RelativeRotation", [&]() {
+        listener.SetListener(Quaternion::FromEulerDegrees({30, 0, 0}), {1, 0, 0});
+        listener.GetDirections(directions, azimuth.data(), elevation.data(), distance.data());
+        RelativeRotation::Compute(listeners, rotations, relative);
+        RelativeRotation::ComputeRange(listeners, rotations, relative, 0, count);
+        Consume(azimuth[9] + relative.W()[11]);
+    });
+
+    // These keep their working storage between calls, so only the first call with a new size may allocate
+    OrientationChangeDetector detector(count, 0.01f);
+    SourceCuller culler;
+    detector.Detect(rotations);
+    culler.Classify(directions);
+    culler.Select(count);
+    ExpectRealtimeSafe("OrientationChangeDetector and SourceCuller", [&]() {
+        Consume(static_cast<float>(detector.Detect(rotations)));
+        culler.SetListener(Quaternion::FromEulerDegrees({90, 0, 0}));
+        Consume(static_cast<float>(culler.Classify(directions)));
+        Consume(static_cast<float>(culler.Select(count / 3).size()));
+    });
+
+    OrientationCommandQueue queue(64);
+    Orientation target;
+    ExpectRealtimeSafe("OrientationCommandQueue", [&]() {
+        queue.PushApplyRotation(Quaternion::FromEulerDegrees({1, 0, 0}));
+        queue.PushApplyRotation(Quaternion::FromEulerDegrees({1, 0, 0}));
+        queue.PushRecenter();
+        queue.PushSetRotation(Quaternion::FromEulerDegrees({0, 1, 0}));
+        queue.PushReset();
+        Consume(static_cast<float>(queue.Drain(target)));
+    });
+}
+
+TEST(RealtimeSafetyTests, StreamApis) {
+    using namespace Mach1;
+
+    const size_t track_count = 8;
+    OrientationResampler resampler(track_count, 100.0);
+    auto push_samples = [&](int first, int last) {
+        for (int i = first; i < last; i++) {
+            for (size_t track = 0; track < track_count; track++) {
+                resampler.PushSample(track, 0.01 * i, Quaternion::FromEulerDegrees({static_cast<float>(i), 0, 0}));
+            }
+        }
+    };
+    push_samples(0, 8);
+
+    auto pipeline = MakeOrientationPipeline(track_count, ResamplerSource(resampler, 4), SmoothStage(0.5f),
+                                            PredictStage(2.0f), RecenterStage());
+    QuaternionBatch chunk;
+    pipeline.Pull(chunk);
+    ExpectRealtimeSafe("OrientationResampler and OrientationPipeline", [&]() {
+        push_samples(8, 12);
+        pipeline.GetStage<2>().RecenterAll();
+        Consume(static_cast<float>(pipeline.Pull(chunk)));
+        Consume(chunk.W()[3]);
+    });
+
+    QuaternionSpline spline;
+    for (int key = 0; key < 8; key++) {
+        spline.AddKeyframe(key, Quaternion::FromEulerDegrees({20.0f * static_cast<float>(key), 0, 0}));
+    }
+    QuaternionBatch evaluated;
+    spline.EvaluateRange(0.0, 0.01, 256, evaluated);
+    ExpectRealtimeSafe("QuaternionSpline", [&]() {
+        Consume(spline.Evaluate(3.3));
+        spline.EvaluateRange(1.0, 0.01, 256, evaluated);
+        Consume(evaluated.X()[100]);
+    });
+
+    QuaternionBatch samples = MakeRotations(32);
+    SlidingQuaternionAverage average(track_count, 16);
+    ExpectRealtimeSafe("QuaternionAverage", [&]() {
+        Consume(QuaternionAverage::LinearMean(samples));
+        Consume(QuaternionAverage::MarkleyMean(samples));
+        Consume(QuaternionAverage::RobustMean(samples, 1.0f));
+        for (size_t track = 0; track < track_count; track++) {
+            average.Push(track, samples.Get(track));
+            Consume(average.GetLinearMean(track));
+            Consume(average.GetMarkleyMean(track));
+        }
+    });
+
+    QuaternionIndex index;
+    index.Build(MakeRotations(200));
+    QuaternionIndex::Match matches[4];
+    EulerQuaternionCache cache(360);
+    ExpectRealtimeSafe("QuaternionIndex and EulerQuaternionCache", [&]() {
+        Consume(index.FindNearest(Quaternion::FromEulerDegrees({12, 3, 4})).angle);
+        Consume(static_cast<float>(index.FindKNearest(Quaternion::FromEulerDegrees({-40, 0, 9}), 4, matches)));
+        Consume(cache.FromEulerDegrees({12.5f, -3.0f, 90.0f}));
+    });
+}
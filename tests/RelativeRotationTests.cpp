@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+#include "m1_mathematics/RelativeRotation.h"
+
+namespace {
+
+Mach1::QuaternionBatch MakeRotations(size_t count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> angle(-180.0f, 180.0f);
+
+    Mach1::QuaternionBatch batch(count);
+    for (size_t i = 0; i < count; i++) {
+        batch.Set(i, Mach1::Quaternion::FromEulerDegrees({angle(rng), angle(rng) * 0.5f, angle(rng)}));
+    }
+    return batch;
+}
+
+void ExpectMatchesScalar(const Mach1::QuaternionBatch &listeners, const Mach1::QuaternionBatch &objects,
+                         const Mach1::QuaternionBatch &output) {
+    ASSERT_EQ(output.Size(), listeners.Size() * objects.Size());
+    for (size_t l = 0; l < listeners.Size(); l++) {
+        for (size_t o = 0; o < objects.Size(); o++) {
+            Mach1::Quaternion expected = listeners.Get(l).Inversed() * objects.Get(o);
+            ASSERT_TRUE(output.Get(l * objects.Size() + o).IsApproximatelyEqual(expected)) << l << " " << o;
+        }
+    }
+}
+
+} // namespace
+
+TEST(RelativeRotationTests, MatchesScalarProduct) {
+    using namespace Mach1;
+
+    // Object counts that do and do not fill the last tile
+    for (size_t object_count : {1, 255, 256, 700}) {
+        QuaternionBatch listeners = MakeRotations(5, 1);
+        QuaternionBatch objects = MakeRotations(object_count, 2);
+        QuaternionBatch output;
+        RelativeRotation::Compute(listeners, objects, output);
+        ExpectMatchesScalar(listeners, objects, output);
+    }
+
+    // A listener facing the same way as an object sees it straight ahead
+    QuaternionBatch same = MakeRotations(3, 4);
+    QuaternionBatch output;
+    RelativeRotation::Compute(same, same, output);
+    for (size_t i = 0; i < same.Size(); i++) {
+        ASSERT_TRUE(output.Get(i * same.Size() + i).IsApproximatelyEqual(Quaternion()));
+    }
+}
+
+TEST(RelativeRotationTests, Threads) {
+    using namespace Mach1;
+
+    QuaternionBatch listeners = MakeRotations(16, 5);
+    QuaternionBatch objects = MakeRotations(3000, 6);
+
+    QuaternionBatch single;
+    RelativeRotation::Compute(listeners, objects, single, 1);
+    for (unsigned threads : {2u, 3u, 8u, 64u}) {
+        QuaternionBatch threaded;
+        RelativeRotation::Compute(listeners, objects, threaded, threads);
+        ASSERT_EQ(threaded.Size(), single.Size());
+        for (size_t i = 0; i < single.Size(); i++) {
+            ASSERT_EQ(threaded.Get(i), single.Get(i)) << threads << " " << i;
+        }
+    }
+    ExpectMatchesScalar(listeners, objects, single);
+}
+
+TEST(RelativeRotationTests, ComputeRange) {
+    using namespace Mach1;
+
+    QuaternionBatch listeners = MakeRotations(4, 7);
+    QuaternionBatch objects = MakeRotations(100, 8);
+    QuaternionBatch output(listeners.Size() * objects.Size());
+
+    RelativeRotation::ComputeRange(listeners, objects, output, 0, 37);
+    RelativeRotation::ComputeRange(listeners, objects, output, 37, 63);
+    ExpectMatchesScalar(listeners, objects, output);
+
+    QuaternionBatch empty;
+    RelativeRotation::Compute(empty, objects, output);
+    ASSERT_EQ(output.Size(), 0u);
+}
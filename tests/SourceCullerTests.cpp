@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+#include "m1_mathematics/SourceCuller.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+
+// A horizontal direction at the given azimuth, positive to the left, as (up, left, forward)
+Mach1::Float3 Horizontal(float azimuth_degrees) {
+    float azimuth = azimuth_degrees * static_cast<float>(M_PI) / 180.0f;
+    return {0.0f, std::sin(azimuth), std::cos(azimuth)};
+}
+
+} // namespace
+
+TEST(SourceCullerTests, DefaultBucketsKeepEverything) {
+    using namespace Mach1;
+
+    Float3Batch directions(6);
+    directions.Set(0, Horizontal(0));
+    directions.Set(1, Horizontal(45));
+    directions.Set(2, Horizontal(-90));
+    directions.Set(3, Horizontal(180));
+    directions.Set(4, {0, 0, 0});
+    directions.Set(5, {0, 0, -5});
+
+    SourceCuller culler;
+    ASSERT_EQ(culler.GetBucketCount(), 4);
+    EXPECT_EQ(culler.Classify(directions), 6);
+
+    EXPECT_EQ(culler.GetBucket(0), 0);
+    EXPECT_EQ(culler.GetBucket(1), 1);
+    EXPECT_EQ(culler.GetBucket(2), 2);
+    EXPECT_EQ(culler.GetBucket(3), 3);
+    EXPECT_EQ(culler.GetBucket(4), 0);
+    EXPECT_EQ(culler.GetBucket(5), 3);
+
+    EXPECT_NEAR(culler.GetAngularOffset(1), M_PI / 4.0, 1e-5);
+    EXPECT_NEAR(culler.GetAngularOffset(3), M_PI, 1e-3);
+
+    std::vector<uint32_t> expected = {0, 4, 1, 2, 3, 5};
+    EXPECT_EQ(culler.GetSortedIndices(), expected);
+    EXPECT_EQ(culler.GetBucketBegin(3), 4);
+    EXPECT_EQ(culler.GetBucketEnd(3), 6);
+}
+
+TEST(SourceCullerTests, FollowsListenerRotation) {
+    using namespace Mach1;
+
+    Float3Batch directions(3);
+    directions.Set(0, Horizontal(0));
+    directions.Set(1, Horizontal(90));
+    directions.Set(2, {1, 0, 0});
+
+    SourceCuller culler({static_cast<float>(M_PI / 6.0)});
+
+    // Turned left to face the second source
+    Orientation listener;
+    listener.ApplyRotationDegrees({90, 0, 0});
+    culler.SetListener(listener);
+    EXPECT_EQ(culler.Classify(directions), 1);
+    EXPECT_EQ(culler.GetSortedIndices(), std::vector<uint32_t>{1});
+    EXPECT_EQ(culler.GetBucket(0), culler.GetBucketCount());
+
+    // Pitched to face straight up at the third; negative pitch raises the forward axis
+    culler.SetListener(Quaternion::FromEulerDegrees({0, -90, 0}));
+    Float3 forward = Quaternion::FromEulerDegrees({0, -90, 0}).Rotate({0, 0, 1});
+    ASSERT_GT(forward.GetYaw(), 0.99f);
+    EXPECT_EQ(culler.Classify(directions), 1);
+    EXPECT_EQ(culler.GetSortedIndices(), std::vector<uint32_t>{2});
+}
+
+TEST(SourceCullerTests, MatchesAngleBetweenDirections) {
+    using namespace Mach1;
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> component(-10.0f, 10.0f);
+    Float3Batch directions(500);
+    for (size_t i = 0; i < directions.Size(); i++) {
+        directions.Set(i, {component(rng), component(rng), component(rng)});
+    }
+
+    Quaternion listener = Quaternion::FromEulerDegrees({-37, 21, 64});
+    SourceCuller culler;
+    culler.SetListener(listener);
+    culler.Classify(directions);
+
+    Float3 forward = listener.Rotate({0, 0, 1});
+    for (size_t i = 0; i < directions.Size(); i++) {
+        Float3 direction = directions.Get(i);
+        float cosine = (forward.GetYaw() * direction.GetYaw() + forward.GetPitch() * direction.GetPitch() +
+                        forward.GetRoll() * direction.GetRoll()) / direction.Length();
+        EXPECT_NEAR(culler.GetCosines()[i], cosine, 1e-5f) << i;
+
+        size_t expected_bucket = 0;
+        while (expected_bucket < culler.GetBucketCount() &&
+               culler.GetAngularOffset(i) > culler.GetBucketEdges()[expected_bucket] + 1e-4f) {
+            expected_bucket++;
+        }
+        EXPECT_EQ(culler.GetBucket(i), expected_bucket) << i;
+    }
+}
+
+TEST(SourceCullerTests, SelectWithinBudget) {
+    using namespace Mach1;
+
+    // Bucket 0: sources 0 (5 deg) and 1 (20 deg); bucket 1: 2 (50), 3 (35), 4 (40); bucket 2: 5 (100)
+    Float3Batch directions(7);
+    directions.Set(0, Horizontal(5));
+    directions.Set(1, Horizontal(-20));
+    directions.Set(2, Horizontal(50));
+    directions.Set(3, Horizontal(-35));
+    directions.Set(4, Horizontal(40));
+    directions.Set(5, Horizontal(100));
+    directions.Set(6, Horizontal(170));
+
+    SourceCuller culler({static_cast<float>(M_PI / 6.0), static_cast<float>(M_PI / 3.0),
+                         static_cast<float>(M_PI * 2.0 / 3.0)});
+    ASSERT_EQ(culler.Classify(directions), 6);
+
+    EXPECT_EQ(culler.Select(0), std::vector<uint32_t>{});
+    EXPECT_EQ(culler.Select(1), std::vector<uint32_t>{0});
+    EXPECT_EQ(culler.Select(2), (std::vector<uint32_t>{0, 1}));
+    EXPECT_EQ(culler.Select(3), (std::vector<uint32_t>{0, 1, 3}));
+    EXPECT_EQ(culler.Select(4), (std::vector<uint32_t>{0, 1, 3, 4}));
+    EXPECT_EQ(culler.Select(5), (std::vector<uint32_t>{0, 1, 2, 3, 4}));
+    EXPECT_EQ(culler.Select(100), (std::vector<uint32_t>{0, 1, 2, 3, 4, 5}));
+}
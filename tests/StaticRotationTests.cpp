@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "m1_mathematics/StaticRotation.h"
+
+namespace {
+
+constexpr bool IsNear(double a, double b, double tolerance) {
+    return (a - b) < tolerance && (b - a) < tolerance;
+}
+
+using Mach1::EulerAngles;
+using Mach1::StaticRotation;
+
+// Built entirely by the compiler
+constexpr EulerAngles QUAD_LAYOUT[] = {{45, 0, 0}, {-45, 0, 0}, {135, 0, 0}, {-135, 0, 0}};
+constexpr auto QUAD_ROTATIONS = StaticRotation::FromEulerDegrees(QUAD_LAYOUT);
+constexpr auto QUAD_MATRICES = StaticRotation::MatricesFromEulerDegrees(QUAD_LAYOUT);
+constexpr auto MOUNTING_OFFSET = StaticRotation::FromEulerDegrees(0, -15, 0);
+
+static_assert(IsNear(Mach1::MathUtility::ConstexprSin(0.5), 0.479425538604203, 1e-15), "");
+static_assert(IsNear(Mach1::MathUtility::ConstexprCos(-7.0), 0.753902254343305, 1e-14), "");
+static_assert(IsNear(Mach1::MathUtility::ConstexprSin(100.0), -0.506365641109759, 1e-13), "");
+static_assert(IsNear(QUAD_ROTATIONS[0].GetW(), 0.923879532511287, 1e-7), "");
+static_assert(IsNear(QUAD_ROTATIONS[0].GetZ(), 0.382683432365090, 1e-7), "");
+static_assert(IsNear(QUAD_MATRICES[2].m[0][0], -0.707106781186548, 1e-6), "");
+static_assert(IsNear(MOUNTING_OFFSET.GetY(), -0.130526192220052, 1e-7), "");
+
+} // namespace
+
+TEST(StaticRotationTests, ConstexprTrigonometry) {
+    using namespace Mach1;
+
+    for (double x = -20.0; x <= 20.0; x += 0.0137) {
+        ASSERT_NEAR(MathUtility::ConstexprSin(x), std::sin(x), 1e-13) << x;
+        ASSERT_NEAR(MathUtility::ConstexprCos(x), std::cos(x), 1e-13) << x;
+    }
+}
+
+TEST(StaticRotationTests, MatchesFromEulerDegrees) {
+    using namespace Mach1;
+
+    for (float yaw = -180; yaw <= 180; yaw += 22.5f) {
+        for (float pitch = -90; pitch <= 90; pitch += 15) {
+            for (float roll = -180; roll <= 180; roll += 30) {
+                Quaternion expected = Quaternion::FromEulerDegrees({yaw, pitch, roll});
+                Quaternion actual = StaticRotation::FromEulerDegrees(yaw, pitch, roll);
+                for (int c = 0; c < 4; c++) {
+                    ASSERT_NEAR(actual[c], expected[c], 1e-6) << yaw << " " << pitch << " " << roll;
+                }
+            }
+        }
+    }
+
+    ASSERT_EQ(QUAD_ROTATIONS.size(), 4u);
+    ASSERT_TRUE(QUAD_ROTATIONS[3].IsApproximatelyEqual(Quaternion::FromEulerDegrees({-135, 0, 0})));
+}
+
+TEST(StaticRotationTests, RotationMatrix) {
+    using namespace Mach1;
+
+    Quaternion rotation = StaticRotation::FromEulerDegrees(30, -20, 50);
+    RotationMatrix matrix = StaticRotation::ToRotationMatrix(rotation);
+
+    Float3 vector = {0.3f, -1.2f, 2.0f};
+    ASSERT_TRUE(matrix.Rotate(vector).IsApproximatelyEqual(rotation.Rotate(vector)));
+
+    // The front-left speaker direction
+    ASSERT_TRUE(QUAD_MATRICES[0].Rotate({0, 0, 1}).IsApproximatelyEqual({0, float(M_SQRT1_2), float(M_SQRT1_2)}));
+}